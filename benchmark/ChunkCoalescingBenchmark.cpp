@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2017-2024. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <wrench-dev.h>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(chunk_coalescing_benchmark, "Log category for Chunk Coalescing Benchmark");
+
+using namespace wrench;
+
+/**
+ * @brief An actor that copies the same file from a storage service that transfers data in buffer-size
+ *        chunks and from a storage service that coalesces chunks, and compares the two copies
+ */
+class ChunkCoalescingBenchmarkController : public ExecutionController {
+public:
+    ChunkCoalescingBenchmarkController(const std::string &hostname,
+                                       std::shared_ptr<DataFile> file,
+                                       std::shared_ptr<StorageService> chunked_storage_service,
+                                       std::shared_ptr<StorageService> coalesced_storage_service,
+                                       std::shared_ptr<StorageService> dst_storage_service) : ExecutionController(hostname, "chunk_benchmark"),
+                                                                                              file(std::move(file)),
+                                                                                              chunked_storage_service(std::move(chunked_storage_service)),
+                                                                                              coalesced_storage_service(std::move(coalesced_storage_service)),
+                                                                                              dst_storage_service(std::move(dst_storage_service)) {
+    }
+
+private:
+    int main() override {
+        auto chunked = this->copy(this->chunked_storage_service);
+        StorageService::deleteFileAtLocation(FileLocation::LOCATION(this->dst_storage_service, this->file));
+        auto coalesced = this->copy(this->coalesced_storage_service);
+
+        std::cout << "chunk-by-chunk: " << chunked.first << " simulated s in " << chunked.second << " s\n";
+        std::cout << "coalesced:      " << coalesced.first << " simulated s in " << coalesced.second << " s\n";
+        std::cout << "relative error: " << 100.0 * std::fabs(coalesced.first - chunked.first) / chunked.first << "%, "
+                  << "speedup: " << chunked.second / coalesced.second << "\n";
+        return 0;
+    }
+
+    /**
+     * @brief Copy the file from a storage service to the destination storage service
+     * @param src_storage_service: the source storage service
+     * @return the simulated duration and the wall-clock duration of the copy
+     */
+    std::pair<double, double> copy(const std::shared_ptr<StorageService> &src_storage_service) {
+        auto start = std::chrono::steady_clock::now();
+        double start_date = Simulation::getCurrentSimulatedDate();
+        StorageService::copyFile(FileLocation::LOCATION(src_storage_service, this->file),
+                                 FileLocation::LOCATION(this->dst_storage_service, this->file));
+        double simulated = Simulation::getCurrentSimulatedDate() - start_date;
+        return {simulated, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+    }
+
+    std::shared_ptr<DataFile> file;
+    std::shared_ptr<StorageService> chunked_storage_service;
+    std::shared_ptr<StorageService> coalesced_storage_service;
+    std::shared_ptr<StorageService> dst_storage_service;
+};
+
+int main(int argc, char **argv) {
+    // Create and initialize a simulation
+    auto simulation = wrench::Simulation::createSimulation();
+    simulation->init(&argc, argv);
+
+    // Parse command-line arguments
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <file size> <buffer size>  (e.g., \"100GB 10MB\")"
+                  << "\n";
+        exit(1);
+    }
+    std::string file_size = argv[1];
+    std::string buffer_size = argv[2];
+
+    // Create the platform file
+    std::string xml = "<?xml version='1.0'?>\n";
+    xml += "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">\n";
+    xml += "<platform version=\"4.1\">\n";
+    xml += "   <zone id=\"AS0\" routing=\"Full\">\n";
+    xml += "     <host id=\"Host1\" speed=\"1f\" core=\"1\">\n";
+    xml += "       <disk id=\"disk1\" read_bw=\"200MBps\" write_bw=\"200MBps\">\n";
+    xml += "         <prop id=\"size\" value=\"1000000TB\"/>\n";
+    xml += "         <prop id=\"mount\" value=\"/chunked\"/>\n";
+    xml += "       </disk>\n";
+    xml += "       <disk id=\"disk2\" read_bw=\"200MBps\" write_bw=\"200MBps\">\n";
+    xml += "         <prop id=\"size\" value=\"1000000TB\"/>\n";
+    xml += "         <prop id=\"mount\" value=\"/coalesced\"/>\n";
+    xml += "       </disk>\n";
+    xml += "     </host>\n";
+    xml += "     <host id=\"Host2\" speed=\"1f\" core=\"1\">\n";
+    xml += "       <disk id=\"disk\" read_bw=\"150MBps\" write_bw=\"150MBps\">\n";
+    xml += "         <prop id=\"size\" value=\"1000000TB\"/>\n";
+    xml += "         <prop id=\"mount\" value=\"/\"/>\n";
+    xml += "       </disk>\n";
+    xml += "     </host>\n";
+    xml += "     <link id=\"link\" bandwidth=\"100MBps\" latency=\"10us\"/>\n";
+    xml += "     <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"link\"/> </route>\n";
+    xml += "   </zone>\n";
+    xml += "</platform>\n";
+
+    FILE *platform_file = fopen("/tmp/chunk_coalescing_benchmark_platform.xml", "w");
+    fprintf(platform_file, "%s", xml.c_str());
+    fclose(platform_file);
+    simulation->instantiatePlatform("/tmp/chunk_coalescing_benchmark_platform.xml");
+
+    // Create the storage services
+    std::shared_ptr<StorageService> chunked_storage_service, coalesced_storage_service, dst_storage_service;
+    try {
+        chunked_storage_service = simulation->add(SimpleStorageService::createSimpleStorageService(
+                "Host1", {"/chunked"}, {{SimpleStorageServiceProperty::BUFFER_SIZE, buffer_size}}, {}));
+        coalesced_storage_service = simulation->add(SimpleStorageService::createSimpleStorageService(
+                "Host1", {"/coalesced"}, {{SimpleStorageServiceProperty::BUFFER_SIZE, buffer_size}, {SimpleStorageServiceProperty::COALESCE_DATA_CHUNKS, "true"}}, {}));
+        dst_storage_service = simulation->add(SimpleStorageService::createSimpleStorageService(
+                "Host2", {"/"}, {{SimpleStorageServiceProperty::BUFFER_SIZE, buffer_size}}, {}));
+    } catch (std::invalid_argument &e) {
+        std::cerr << "Invalid buffer size: " << e.what() << "\n";
+        exit(1);
+    }
+
+    // Create the file on both source storage services
+    std::shared_ptr<DataFile> file;
+    try {
+        file = Simulation::addFile("file", file_size);
+    } catch (std::invalid_argument &e) {
+        std::cerr << "Invalid file size: " << e.what() << "\n";
+        exit(1);
+    }
+    chunked_storage_service->createFile(file);
+    coalesced_storage_service->createFile(file);
+
+    // Create the controller
+    simulation->add(new ChunkCoalescingBenchmarkController("Host2", file, chunked_storage_service, coalesced_storage_service, dst_storage_service));
+
+    // Launch the simulation
+    try {
+        simulation->launch();
+    } catch (std::runtime_error &e) {
+        std::cerr << "Simulation failed: " << e.what() << "\n";
+        exit(1);
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2017-2024. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <wrench-dev.h>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(commport_benchmark, "Log category for CommPort Benchmark");
+
+using namespace wrench;
+
+/**
+ * @brief The message exchanged by the benchmark's actors
+ */
+class BenchmarkMessage : public SimulationMessage {
+public:
+    BenchmarkMessage(S4U_CommPort *reply_commport, sg_size_t payload) : SimulationMessage(payload), reply_commport(reply_commport) {
+    }
+
+    /** @brief The commport to reply to (nullptr means "stop") */
+    S4U_CommPort *reply_commport;
+};
+
+/**
+ * @brief An actor that replies to every message it receives, until told to stop
+ */
+class PongController : public ExecutionController {
+public:
+    PongController(const std::string &hostname, sg_size_t payload) : ExecutionController(hostname, "pong"), payload(payload) {
+    }
+
+private:
+    int main() override {
+        while (true) {
+            auto msg = this->_commport->getMessage<BenchmarkMessage>("PongController::main(): Received an");
+            if (msg->reply_commport == nullptr) {
+                break;
+            }
+            msg->reply_commport->putMessage(new BenchmarkMessage(nullptr, this->payload));
+        }
+        return 0;
+    }
+
+    sg_size_t payload;
+};
+
+/**
+ * @brief An actor that sends messages to a PongController and waits for each reply
+ */
+class PingController : public ExecutionController {
+public:
+    PingController(const std::string &hostname, std::shared_ptr<PongController> pong, unsigned long num_messages, sg_size_t payload) : ExecutionController(hostname, "ping"), pong(std::move(pong)), num_messages(num_messages), payload(payload) {
+    }
+
+private:
+    int main() override {
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned long i = 0; i < this->num_messages; i++) {
+            this->pong->_commport->putMessage(new BenchmarkMessage(this->recv_commport, this->payload));
+            this->recv_commport->getMessage<BenchmarkMessage>("PingController::main(): Received an");
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        this->pong->_commport->putMessage(new BenchmarkMessage(nullptr, this->payload));
+
+        std::cout << 2 * this->num_messages << " messages (payload: " << this->payload << " bytes) in " << elapsed << " s ("
+                  << static_cast<double>(2 * this->num_messages) / elapsed << " messages/sec)\n";
+        return 0;
+    }
+
+    std::shared_ptr<PongController> pong;
+    unsigned long num_messages;
+    sg_size_t payload;
+};
+
+int main(int argc, char **argv) {
+    // Create and initialize a simulation
+    auto simulation = wrench::Simulation::createSimulation();
+    simulation->init(&argc, argv);
+
+    // Parse command-line arguments
+    unsigned long num_messages;
+    unsigned long payload = 0;
+    if (((argc != 2) and (argc != 3)) or
+        ((sscanf(argv[1], "%lu", &num_messages) != 1) or (num_messages < 1)) or
+        ((argc == 3) and (sscanf(argv[2], "%lu", &payload) != 1))) {
+        std::cerr << "Usage: " << argv[0] << " <num round trips> [payload in bytes (default: 0)]"
+                  << "\n";
+        exit(1);
+    }
+
+    // Create the platform file
+    std::string xml = "<?xml version='1.0'?>\n";
+    xml += "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">\n";
+    xml += "<platform version=\"4.1\">\n";
+    xml += "   <zone id=\"AS0\" routing=\"Full\">\n";
+    xml += "     <host id=\"Host1\" speed=\"1f\" core=\"1\"/>\n";
+    xml += "     <host id=\"Host2\" speed=\"1f\" core=\"1\"/>\n";
+    xml += "     <link id=\"link\" bandwidth=\"10GBps\" latency=\"100ns\"/>\n";
+    xml += "     <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"link\"/> </route>\n";
+    xml += "   </zone>\n";
+    xml += "</platform>\n";
+
+    FILE *platform_file = fopen("/tmp/commport_benchmark_platform.xml", "w");
+    fprintf(platform_file, "%s", xml.c_str());
+    fclose(platform_file);
+    simulation->instantiatePlatform("/tmp/commport_benchmark_platform.xml");
+
+    // Create the actors
+    auto pong = std::shared_ptr<PongController>(new PongController("Host2", payload));
+    simulation->add(pong);
+    simulation->add(new PingController("Host1", pong, num_messages, payload));
+
+    // Launch the simulation
+    try {
+        simulation->launch();
+    } catch (std::runtime_error &e) {
+        std::cerr << "Simulation failed: " << e.what() << "\n";
+        exit(1);
+    }
+
+    return 0;
+}
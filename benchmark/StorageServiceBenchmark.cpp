@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2017-2024. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <wrench-dev.h>
+#include <wrench/services/storage/StorageServiceMessage.h>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(storage_service_benchmark, "Log category for Storage Service Benchmark");
+
+using namespace wrench;
+
+/**
+ * @brief An actor that initiates rounds of concurrent file copies between two non-bufferized
+ *        storage services, doubling the number of copies at each round
+ */
+class StorageServiceBenchmarkController : public ExecutionController {
+public:
+    StorageServiceBenchmarkController(const std::string &hostname,
+                                      std::shared_ptr<StorageService> src_storage_service,
+                                      std::shared_ptr<StorageService> dst_storage_service,
+                                      unsigned long max_num_copies,
+                                      unsigned long num_rounds) : ExecutionController(hostname, "storage_benchmark"),
+                                                                  src_storage_service(std::move(src_storage_service)),
+                                                                  dst_storage_service(std::move(dst_storage_service)),
+                                                                  max_num_copies(max_num_copies), num_rounds(num_rounds) {
+    }
+
+private:
+    int main() override {
+        unsigned long num_copies = this->max_num_copies >> (this->num_rounds - 1);
+        for (unsigned long round = 0; round < this->num_rounds; round++, num_copies *= 2) {
+            // Create the files (in zero time)
+            std::vector<std::shared_ptr<FileLocation>> src_locations;
+            std::vector<std::shared_ptr<FileLocation>> dst_locations;
+            for (unsigned long i = 0; i < num_copies; i++) {
+                auto file = Simulation::addFile("file_" + std::to_string(round) + "_" + std::to_string(i), 1000);
+                src_locations.push_back(FileLocation::LOCATION(this->src_storage_service, file));
+                dst_locations.push_back(FileLocation::LOCATION(this->dst_storage_service, file));
+                this->src_storage_service->createFile(src_locations.back());
+            }
+
+            // Initiate all copies, and wait for all of them to complete
+            auto start = std::chrono::steady_clock::now();
+            for (unsigned long i = 0; i < num_copies; i++) {
+                StorageService::initiateFileCopy(this->recv_commport, src_locations[i], dst_locations[i]);
+            }
+            for (unsigned long i = 0; i < num_copies; i++) {
+                auto msg = this->recv_commport->getMessage<StorageServiceFileCopyAnswerMessage>("StorageServiceBenchmarkController::main(): Received an");
+                if (not msg->success) {
+                    throw std::runtime_error("File copy failed: " + msg->failure_cause->toString());
+                }
+            }
+            auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << num_copies << " concurrent file copies in " << elapsed << " s ("
+                      << 1000000.0 * elapsed / static_cast<double>(num_copies) << " us/copy)\n";
+        }
+        return 0;
+    }
+
+    std::shared_ptr<StorageService> src_storage_service;
+    std::shared_ptr<StorageService> dst_storage_service;
+    unsigned long max_num_copies;
+    unsigned long num_rounds;
+};
+
+int main(int argc, char **argv) {
+    // Create and initialize a simulation
+    auto simulation = wrench::Simulation::createSimulation();
+    simulation->init(&argc, argv);
+
+    // Parse command-line arguments
+    unsigned long max_num_copies;
+    unsigned long num_rounds = 4;
+    if (((argc != 2) and (argc != 3)) or
+        (sscanf(argv[1], "%lu", &max_num_copies) != 1) or
+        ((argc == 3) and ((sscanf(argv[2], "%lu", &num_rounds) != 1) or (num_rounds < 1) or (num_rounds > 32))) or
+        ((max_num_copies >> (num_rounds - 1)) < 1)) {
+        std::cerr << "Usage: " << argv[0] << " <max num concurrent file copies> [num rounds (default: 4)]"
+                  << "\n";
+        std::cerr << "  (the number of concurrent copies is doubled at each round, up to the max; linear scaling\n"
+                  << "   means that the time per copy remains constant across rounds)\n";
+        exit(1);
+    }
+
+    // Create the platform file
+    std::string xml = "<?xml version='1.0'?>\n";
+    xml += "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">\n";
+    xml += "<platform version=\"4.1\">\n";
+    xml += "   <zone id=\"AS0\" routing=\"Full\">\n";
+    xml += "     <host id=\"Host1\" speed=\"1f\" core=\"1\">\n";
+    xml += "       <disk id=\"disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">\n";
+    xml += "         <prop id=\"size\" value=\"1000000TB\"/>\n";
+    xml += "         <prop id=\"mount\" value=\"/\"/>\n";
+    xml += "       </disk>\n";
+    xml += "     </host>\n";
+    xml += "     <host id=\"Host2\" speed=\"1f\" core=\"1\">\n";
+    xml += "       <disk id=\"disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">\n";
+    xml += "         <prop id=\"size\" value=\"1000000TB\"/>\n";
+    xml += "         <prop id=\"mount\" value=\"/\"/>\n";
+    xml += "       </disk>\n";
+    xml += "     </host>\n";
+    xml += "     <link id=\"link\" bandwidth=\"10GBps\" latency=\"100ns\"/>\n";
+    xml += "     <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"link\"/> </route>\n";
+    xml += "   </zone>\n";
+    xml += "</platform>\n";
+
+    FILE *platform_file = fopen("/tmp/storage_service_benchmark_platform.xml", "w");
+    fprintf(platform_file, "%s", xml.c_str());
+    fclose(platform_file);
+    simulation->instantiatePlatform("/tmp/storage_service_benchmark_platform.xml");
+
+    // Create two non-bufferized storage services that allow all copies to proceed concurrently
+    WRENCH_PROPERTY_COLLECTION_TYPE properties = {
+            {SimpleStorageServiceProperty::BUFFER_SIZE, "0"},
+            {SimpleStorageServiceProperty::MAX_NUM_CONCURRENT_DATA_CONNECTIONS, std::to_string(max_num_copies)}};
+    auto src_storage_service = simulation->add(SimpleStorageService::createSimpleStorageService("Host1", {"/"}, properties, {}));
+    auto dst_storage_service = simulation->add(SimpleStorageService::createSimpleStorageService("Host2", {"/"}, properties, {}));
+
+    // Create the controller
+    simulation->add(new StorageServiceBenchmarkController("Host1", src_storage_service, dst_storage_service, max_num_copies, num_rounds));
+
+    // Launch the simulation
+    try {
+        simulation->launch();
+    } catch (std::runtime_error &e) {
+        std::cerr << "Simulation failed: " << e.what() << "\n";
+        exit(1);
+    }
+
+    return 0;
+}
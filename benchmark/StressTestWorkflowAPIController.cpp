@@ -8,6 +8,7 @@
  */
 
 #include <set>
+#include <vector>
 #include "StressTestWorkflowAPIController.h"
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(stress_test_workflow_controller, "Log category for Stress Test Workflow Controller");
@@ -17,14 +18,25 @@ namespace wrench {
     int StressTestWorkflowAPIController::main() {
         WRENCH_INFO("New WMS starting");
 
+        unsigned long max_num_pending_tasks = 10;
+
         // Creating workflow
         shared_ptr<Workflow> workflow = Workflow::createWorkflow();
-        // One task per job, all independent
+        // One task per job
+        std::vector<shared_ptr<WorkflowTask>> tasks;
         for (unsigned int i = 0; i < this->num_jobs; i++) {
             shared_ptr<WorkflowTask> task = workflow->addTask("task_" + std::to_string(i), 1000.0, 1, 1, 1.0);
             task->addOutputFile(wrench::Simulation::addFile("outfile_" + std::to_string(i), 100000000));
             task->addInputFile(wrench::Simulation::addFile("infile_" + std::to_string(i), 100000000));
+            tasks.push_back(task);
+        }
+        // Tasks form as many independent chains as there can be pending tasks, with all
+        // control dependencies added in bulk
+        workflow->beginBulkDependencyInsertion();
+        for (unsigned long i = max_num_pending_tasks; i < tasks.size(); i++) {
+            workflow->addControlDependency(tasks[i - max_num_pending_tasks], tasks[i]);
         }
+        workflow->commitBulkDependencyInsertion();
 
         std::shared_ptr<JobManager> job_manager = this->createJobManager();
 
@@ -38,14 +50,17 @@ namespace wrench {
         //REMOVE//std::set<std::shared_ptr<ComputeService>> compute_services = this->getAvailableComputeServices<ComputeService>();
         //REMOVE//std::set<std::shared_ptr<StorageService>> storage_services = this->getAvailableStorageServices();
 
-        unsigned long max_num_pending_tasks = 10;
-
         WRENCH_INFO("%zu tasks to run", tasks_to_do.size());
 
         while ((not tasks_to_do.empty()) or (not tasks_pending.empty())) {
             while ((!tasks_to_do.empty()) and (tasks_pending.size() < max_num_pending_tasks)) {
                 WRENCH_INFO("Looking at scheduling another task");
-                shared_ptr<WorkflowTask> to_submit = *(tasks_to_do.begin());
+                // Only tasks whose parents have completed can be submitted
+                auto ready_tasks = workflow->getReadyTasks();
+                if (ready_tasks.empty()) {
+                    break;
+                }
+                shared_ptr<WorkflowTask> to_submit = ready_tasks.at(0);
                 tasks_to_do.erase(to_submit);
                 tasks_pending.insert(to_submit);
 
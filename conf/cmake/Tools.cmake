@@ -8,3 +8,6 @@ add_subdirectory("${CMAKE_HOME_DIRECTORY}/tools/wrench/wrench-init")
 add_subdirectory("${CMAKE_HOME_DIRECTORY}/tools/wrench/wrench-daemon")
 
 
+
+# Compile/install wrench-trace-to-json
+add_subdirectory("${CMAKE_HOME_DIRECTORY}/tools/wrench/wrench-trace-to-json")
@@ -194,13 +194,9 @@ namespace wrench {
             for (auto const &cs: compute_services) {
                 if (this->core_utilization_map[cs] > 0) {
                     // Specify that ALL files are read/written from the one storage service
-                    std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> file_locations;
-                    for (auto const &f: task->getInputFiles()) {
-                        file_locations[f] = wrench::FileLocation::LOCATION(this->storage_service, f);
-                    }
-                    for (auto const &f: task->getOutputFiles()) {
-                        file_locations[f] = wrench::FileLocation::LOCATION(this->storage_service, f);
-                    }
+                    auto file_locations = wrench::FileLocation::LOCATIONS(this->storage_service, task->getInputFiles());
+                    auto output_file_locations = wrench::FileLocation::LOCATIONS(this->storage_service, task->getOutputFiles());
+                    file_locations.insert(output_file_locations.begin(), output_file_locations.end());
                     try {
                         auto job = job_manager->createStandardJob(task, file_locations);
                         WRENCH_INFO(
@@ -45,10 +45,13 @@
 // Simulation Output Analysis
 #include "wrench/simulation/SimulationTimestamp.h"
 #include "wrench/simulation/SimulationTimestampTypes.h"
+#include "wrench/simulation/SimulationTraceFileSink.h"
+#include "wrench/simulation/SimulationTraceView.h"
 
 // Workflow
 #include "wrench/workflow/Workflow.h"
 #include "wrench/workflow/WorkflowTask.h"
+#include "wrench/workflow/WorkflowSnapshot.h"
 
 // Tools
 #include "wrench/tools/wfcommons/WfCommonsWorkflowParser.h"
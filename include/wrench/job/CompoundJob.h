@@ -191,6 +191,7 @@ namespace wrench {
         friend class BatchComputeService;
         friend class JobManager;
         friend class Action;
+        friend class StandardJob;
 
         CompoundJob(const std::string& name, const std::shared_ptr<JobManager> &job_manager);
 
@@ -234,6 +235,9 @@ namespace wrench {
 
         void addAction(const std::shared_ptr<Action> &action);
 
+        void addTrustedActionDependency(const std::shared_ptr<Action> &parent, const std::shared_ptr<Action> &child);
+        void updateActionStates();
+
         bool pathExists(const std::shared_ptr<Action> &a, const std::shared_ptr<Action> &b);
         static bool pathExists(const std::shared_ptr<CompoundJob> &a, const std::shared_ptr<CompoundJob> &b);
 
@@ -81,6 +81,8 @@ namespace wrench {
 
         bool usesScratch();
 
+        std::shared_ptr<CompoundJob> getCompoundJob();
+
         /** @brief The job's computational tasks */
         std::vector<std::shared_ptr<WorkflowTask>> tasks;
 
@@ -107,6 +109,8 @@ namespace wrench {
         void setPreJobOverheadInSeconds(double overhead);
         double getPostJobOverheadInSeconds() const;
         void setPostJobOverheadInSeconds(double overhead);
+        bool getUseBarrierActions() const;
+        void setUseBarrierActions(bool use_barrier_actions);
 
 
     private:
@@ -140,6 +144,7 @@ namespace wrench {
         State state;
         double pre_overhead = 0.0;
         double post_overhead = 0.0;
+        bool use_barrier_actions = false;
 
         std::shared_ptr<CompoundJob> compound_job;
         std::shared_ptr<Action> pre_overhead_action = nullptr;
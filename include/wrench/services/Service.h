@@ -15,6 +15,7 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "wrench/simgrid_S4U_util/S4U_Daemon.h"
 #include "wrench/services/ServiceProperty.h"
@@ -147,6 +148,36 @@ namespace wrench {
                 WRENCH_PROPERTY_TYPE property,
                 const std::function<double(std::string &s)> &unit_parsing_function) const;
 
+        /**
+         * @brief The types to which a property value can be converted (and cached), as bit flags
+         */
+        enum PropertyCacheType : unsigned char {
+            PROPERTY_CACHE_DOUBLE = 1 << 0,
+            PROPERTY_CACHE_UNSIGNED_LONG = 1 << 1,
+            PROPERTY_CACHE_BOOLEAN = 1 << 2,
+            PROPERTY_CACHE_TIME = 1 << 3,
+            PROPERTY_CACHE_SIZE = 1 << 4,
+            PROPERTY_CACHE_BANDWIDTH = 1 << 5
+        };
+
+        /**
+         * @brief A property value, converted to the types in which it has been read so far
+         */
+        struct PropertyCacheEntry {
+            unsigned char valid = 0;// Bitwise OR of the PropertyCacheType values that are cached
+            bool as_boolean = false;
+            unsigned long as_unsigned_long = 0;
+            sg_size_t as_size = 0;
+            double as_double = 0.0;
+            double as_time = 0.0;
+            double as_bandwidth = 0.0;
+        };
+
+        PropertyCacheEntry *getPropertyCacheEntry(WRENCH_PROPERTY_TYPE property) const;
+
+        /** @brief Converted property values, indexed by property (invalidated by setProperty()) */
+        mutable std::vector<PropertyCacheEntry> property_cache;
+
         static std::set<std::shared_ptr<Service>> servicesSetToAutoRestart;
 
         /***********************/
@@ -77,6 +77,12 @@ namespace wrench {
 
         std::map<std::string, double> getResourceInformation(const std::string &key);
 
+        unsigned long getNumActionsConsideredForDispatch() const;
+
+        unsigned long getNumActionsDispatched() const;
+
+        unsigned long getNumActionsSkippedForDispatch() const;
+
         ~ActionExecutionService() override;
 
         /***********************/
@@ -97,6 +103,19 @@ namespace wrench {
         std::unordered_map<simgrid::s4u::Host *, sg_size_t> ram_availabilities;
         std::unordered_map<simgrid::s4u::Host *, unsigned long> running_thread_counts;
 
+        // Host availability index used by pickAllocation(): the hosts that are on and have non-zero speed, grouped
+        // by <num cores, speed>, and ordered within each group by <running thread count, host>, so that within
+        // a group the first host has the lowest load
+        typedef std::pair<unsigned long, double> HostGroup;
+        std::map<HostGroup, std::set<std::pair<unsigned long, simgrid::s4u::Host *>>> host_availability_index;
+        // The group and running thread count with which each host is currently indexed
+        std::unordered_map<simgrid::s4u::Host *, std::pair<HostGroup, unsigned long>> host_availability_index_entries;
+        // Hosts that have turned on/off or changed speed since the index was last updated
+        std::set<simgrid::s4u::Host *> hosts_with_changed_state;
+        bool host_state_call_backs_connected = false;
+        unsigned int on_state_change_call_back_id = 0;
+        unsigned int on_speed_change_call_back_id = 0;
+
         std::shared_ptr<Service> parent_service = nullptr;
 
         std::unordered_map<std::shared_ptr<StandardJob>, std::set<std::shared_ptr<DataFile>>> files_in_scratch;
@@ -110,9 +129,23 @@ namespace wrench {
         std::set<std::shared_ptr<Action>> all_actions;
         std::deque<std::shared_ptr<Action>> ready_actions;
 
+        // Requirements of an action that determine whether/where it can run: <min num cores, max num cores,
+        // min RAM footprint, required host, required num cores>
+        typedef std::tuple<unsigned long, unsigned long, sg_size_t, simgrid::s4u::Host *, unsigned long> ActionRequirements;
+        // Number of ready actions with each requirements
+        std::map<ActionRequirements, unsigned long> ready_action_requirements;
+
+        // Dispatch counters
+        unsigned long num_actions_considered_for_dispatch = 0;
+        unsigned long num_actions_dispatched = 0;
+        unsigned long num_actions_skipped_for_dispatch = 0;
+
         // Set of running ActionExecutors
         std::unordered_map<std::shared_ptr<Action>, std::shared_ptr<ActionExecutor>> action_executors;
 
+        // Pools of idle (long-lived) ActionExecutors, for each host
+        std::unordered_map<simgrid::s4u::Host *, std::vector<std::shared_ptr<ActionExecutor>>> idle_action_executors;
+
         int main() override;
 
         // Helper functions to make main() a bit more palatable
@@ -131,6 +164,20 @@ namespace wrench {
 
         void dispatchReadyActions();
 
+        ActionRequirements getActionRequirements(const std::shared_ptr<Action> &action);
+
+        void addReadyAction(const std::shared_ptr<Action> &action);
+
+        void forgetReadyActionRequirements(const std::shared_ptr<Action> &action);
+
+        void indexHost(simgrid::s4u::Host *host);
+
+        void updateHostAvailabilityIndex();
+
+        std::shared_ptr<ActionExecutor> getIdleActionExecutor(simgrid::s4u::Host *host);
+
+        void killIdleActionExecutors();
+
         //        void someHostIsBackOn(simgrid::s4u::Host const &h);
         //        bool host_back_on = false;
 
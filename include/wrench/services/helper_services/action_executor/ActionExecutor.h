@@ -47,6 +47,16 @@ namespace wrench {
             const std::shared_ptr<Action>& action,
             const std::shared_ptr<ActionExecutionService>& action_execution_service);
 
+        ActionExecutor(
+            const std::string& hostname,
+            double thread_creation_overhead,
+            bool simulate_computation_as_sleep,
+            S4U_CommPort* callback_commport,
+            const std::shared_ptr<ActionExecutionService>& action_execution_service);
+
+        void assignAction(const std::shared_ptr<Action>& action, unsigned long num_cores, sg_size_t ram_footprint);
+        void releaseAction();
+
         int main() override;
         void kill(bool job_termination);
         void cleanup(bool has_returned_from_main, int return_value) override;
@@ -55,8 +65,10 @@ namespace wrench {
         void setActionTimeout(const double timeout);
 
     protected:
+        void run_action();
         void execute_action();
         void execute_action_with_timeout();
+        void renewCommPorts();
 
         std::shared_ptr<Action> action;
         std::shared_ptr<ActionExecutionService> action_execution_service;
@@ -71,6 +83,9 @@ namespace wrench {
         unsigned long num_cores;
         sg_size_t ram_footprint;
 
+        // Whether this is a long-lived executor that runs the actions assigned to it via its commport
+        bool pooled = false;
+
 
         /***********************/
         /** \endcond           */
@@ -22,6 +22,7 @@ namespace wrench {
     /***********************/
 
     class ActionExecutor;
+    class Action;
 
     /**
      * @brief Top-level class for messages received/sent by an ActionExecutor
@@ -41,6 +42,16 @@ namespace wrench {
         std::shared_ptr<ActionExecutor> action_executor;
     };
 
+    /**
+     * @brief A message sent to a pooled ActionExecutor to have it run the action that has been assigned to it
+     */
+    class ActionExecutorRunActionMessage : public ActionExecutorMessage {
+    public:
+        explicit ActionExecutorRunActionMessage(std::shared_ptr<Action> action);
+        /** @brief The action */
+        std::shared_ptr<Action> action;
+    };
+
     /***********************/
     /** \endcond           */
     /***********************/
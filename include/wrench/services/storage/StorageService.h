@@ -70,7 +70,7 @@ namespace wrench {
          * @return true if the file is present, or false
          */
         virtual bool lookupFile(const std::shared_ptr<DataFile> &file, const std::string &path) {
-            return this->lookupFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), FileLocation::sanitizePath(path), file));
+            return this->lookupFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), path, file));
         }
         /**
          * @brief Lookup whether a file exists at a location on the storage service (incurs simulated overheads)
@@ -106,7 +106,7 @@ namespace wrench {
          * @param path a path
          */
         virtual void deleteFile(const std::shared_ptr<DataFile> &file, const std::string &path) {
-            this->deleteFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), FileLocation::sanitizePath(path), file));
+            this->deleteFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), path, file));
         }
         /**
          * @brief Delete a file at the storage service (incurs simulated overheads)
@@ -159,7 +159,7 @@ namespace wrench {
          * @param path a path
          */
         virtual void readFile(const std::shared_ptr<DataFile> &file, const std::string &path) {
-            this->readFile(file, FileLocation::sanitizePath(path), file->getSize());
+            this->readFile(file, path, file->getSize());
         }
         /**
          * @brief Read a file at the storage service (incurs simulated overheads)
@@ -168,7 +168,7 @@ namespace wrench {
          * @param num_bytes a number of bytes to read
          */
         virtual void readFile(const std::shared_ptr<DataFile> &file, const std::string &path, sg_size_t num_bytes) {
-            this->readFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), FileLocation::sanitizePath(path), file), num_bytes);
+            this->readFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), path, file), num_bytes);
         }
         /**
          * @brief Read a file at the storage service (incurs simulated overheads)
@@ -212,7 +212,7 @@ namespace wrench {
          * @param path a path
          */
         virtual void writeFile(const std::shared_ptr<DataFile> &file, const std::string &path) {
-            this->writeFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), FileLocation::sanitizePath(path), file));
+            this->writeFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), path, file));
         }
 
         /**
@@ -255,7 +255,7 @@ namespace wrench {
          * @return true if the file is present, false otherwise
          */
         virtual bool hasFile(const std::shared_ptr<DataFile> &file, const std::string &path) {
-            return this->hasFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), FileLocation::sanitizePath(path), file));
+            return this->hasFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), path, file));
         }
 
         /**
@@ -316,7 +316,7 @@ namespace wrench {
          * @param path: a path
          */
         virtual void createFile(const std::shared_ptr<DataFile> &file, const std::string &path) {
-            this->createFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), FileLocation::sanitizePath(path), file));
+            this->createFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), path, file));
         }
 
         /**
@@ -350,7 +350,7 @@ namespace wrench {
          * @param path: a path
          */
         virtual void removeFile(const std::shared_ptr<DataFile> &file, const std::string &path) {
-            this->removeFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), FileLocation::sanitizePath(path), file));
+            this->removeFile(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), path, file));
         }
         /**
          * @brief Remove a file at the storage service (in zero simulated time)
@@ -392,7 +392,7 @@ namespace wrench {
          * @return a date in seconds
          */
         virtual double getFileLastWriteDate(const std::shared_ptr<DataFile> &file, const std::string &path) {
-            return this->getFileLastWriteDate(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), FileLocation::sanitizePath(path), file));
+            return this->getFileLastWriteDate(wrench::FileLocation::LOCATION(this->getSharedPtr<StorageService>(), path, file));
         }
         /**
          * @brief Get a file's last write date at the storage service (in zero simulated time)
@@ -133,6 +133,7 @@ namespace wrench {
         StorageServiceFileCopyRequestMessage(S4U_CommPort *answer_commport,
                                              std::shared_ptr<FileLocation> src,
                                              std::shared_ptr<FileLocation> dst,
+                                             SimulationTimestampFileCopyStart *start_timestamp,
                                              sg_size_t payload);
 
         /** @brief CommPort to which the answer message should be sent */
@@ -141,6 +142,8 @@ namespace wrench {
         std::shared_ptr<FileLocation> src;
         /** @brief The destination location */
         std::shared_ptr<FileLocation> dst;
+        /** @brief The file copy start timestamp (nullptr if file copy timestamps are disabled) */
+        SimulationTimestampFileCopyStart *start_timestamp;
     };
 
     /**
@@ -40,7 +40,9 @@ namespace wrench {
      *        data chunk operations are not simulated, thus achieving both accuracy (unless one specifically wishes
      *        to study the effects of buffering) and quick simulation times. For now, setting the buffer
      *        size to "0" is not implemented. The default buffer size is 10 MiB (note that the user can
-     *        always declare a disk with arbitrary bandwidth in the platform description XML).
+     *        always declare a disk with arbitrary bandwidth in the platform description XML). Setting
+     *        SimpleStorageServiceProperty::COALESCE_DATA_CHUNKS to "true" makes large transfers much
+     *        cheaper to simulate with a small buffer size, at a small cost in accuracy.
      */
     class SimpleStorageService : public StorageService {
 
@@ -49,6 +51,7 @@ namespace wrench {
         WRENCH_PROPERTY_COLLECTION_TYPE default_property_values = {
                 {SimpleStorageServiceProperty::MAX_NUM_CONCURRENT_DATA_CONNECTIONS, "infinity"},
                 {SimpleStorageServiceProperty::BUFFER_SIZE, "10000000"},// 10 MEGA BYTE
+                {SimpleStorageServiceProperty::COALESCE_DATA_CHUNKS, "false"},
                 {SimpleStorageServiceProperty::CACHING_BEHAVIOR, "NONE"}};
 
         /** @brief Default message payload values */
@@ -150,6 +153,7 @@ namespace wrench {
         }
 
         std::shared_ptr<simgrid::fsmod::File> openFile(const std::shared_ptr<FileLocation> &location);
+        std::shared_ptr<simgrid::fsmod::File> openFile(const PathHandle &path, const std::shared_ptr<DataFile> &file);
 
         /***********************/
         /** \endcond          **/
@@ -89,7 +89,8 @@ namespace wrench {
         bool processFileCopyRequest(
                 std::shared_ptr<FileLocation> &src_location,
                 std::shared_ptr<FileLocation> &dst_location,
-                S4U_CommPort *answer_commport);
+                S4U_CommPort *answer_commport,
+                SimulationTimestampFileCopyStart *start_timestamp);
 
         bool processFileTransferThreadNotification(
                 const std::shared_ptr<FileTransferThread> &ftt,
@@ -111,6 +112,8 @@ namespace wrench {
         std::map<std::shared_ptr<FileTransferThread>, S4U_CommPort *> ongoing_tmp_commports;
 
         std::shared_ptr<MemoryManager> memory_manager;
+
+        bool coalesce_data_chunks = false;
     };
 
 }// namespace wrench
@@ -63,6 +63,8 @@ namespace wrench {
             sg_size_t transfer_size;
             /** @brief SG IO op */
             simgrid::s4u::IoPtr stream;
+            /** @brief file copy start timestamp (nullptr if not a copy, or if file copy timestamps are disabled) */
+            SimulationTimestampFileCopyStart *copy_start_timestamp = nullptr;
 
 
         public:
@@ -138,7 +140,8 @@ namespace wrench {
         bool processFileCopyRequest(
                 std::shared_ptr<FileLocation> &src_location,
                 std::shared_ptr<FileLocation> &dst_location,
-                S4U_CommPort *answer_commport);
+                S4U_CommPort *answer_commport,
+                SimulationTimestampFileCopyStart *start_timestamp);
 
         bool processFileCopyRequestIAmTheSource(
                 std::shared_ptr<FileLocation> &src_location,
@@ -158,9 +161,12 @@ namespace wrench {
 
 
         std::deque<std::shared_ptr<Transaction>> pending_transactions;
-        std::set<std::shared_ptr<Transaction>> running_transactions;
+        // Running transactions, indexed by their streams
+        std::unordered_map<simgrid::s4u::Activity *, std::shared_ptr<Transaction>> running_transactions;
 
-        std::unordered_map<simgrid::s4u::IoPtr, std::shared_ptr<Transaction>> stream_to_transactions;
+        // Activities the main loop waits on (the control message receives and the running transactions'
+        // streams), updated incrementally rather than rebuilt at each iteration
+        simgrid::s4u::ActivitySet pending_activities;
 
         std::shared_ptr<MemoryManager> memory_manager;
     };
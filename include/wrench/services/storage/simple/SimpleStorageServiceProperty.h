@@ -23,6 +23,14 @@ namespace wrench {
     public:
         /** @brief The maximum number of concurrent data connections supported by the service (default = "infinity") **/
         DECLARE_PROPERTY_NAME(MAX_NUM_CONCURRENT_DATA_CONNECTIONS);
+
+        /** @brief Whether a (bufferized) service coalesces the buffer-size data chunks of a transfer into larger
+         *         chunks (default = "false"). When enabled, a transfer still starts and ends with buffer-size chunks,
+         *         but steady-state chunks grow geometrically up to a size that keeps at least 128 chunks per transfer,
+         *         which preserves the disk/network pipelining behavior (typically within 1% of the simulated transfer
+         *         time) while simulating far fewer chunk operations for large files.
+         **/
+        DECLARE_PROPERTY_NAME(COALESCE_DATA_CHUNKS);
     };
 
 }// namespace wrench
@@ -10,10 +10,12 @@
 #ifndef WRENCH_FILELOCATION_H
 #define WRENCH_FILELOCATION_H
 
+#include <map>
 #include <memory>
 #include <iostream>
 #include <utility>
 #include <unordered_map>
+#include <vector>
 
 #include <wrench/data_file/DataFile.h>
 
@@ -27,6 +29,65 @@ namespace wrench {
     class StorageService;
     class SimpleStorageService;
 
+    /**
+     * @brief A lightweight handle to a sanitized path interned by FileLocation::internPath(), which
+     *        can be passed around and compared in constant time, and used to create file locations
+     *        without re-sanitizing the path
+     */
+    class PathHandle {
+
+    public:
+        /**
+         * @brief Constructor (the empty path)
+         */
+        PathHandle() : entry(&PathHandle::empty_path_entry) {
+        }
+
+        /**
+         * @brief Get the (sanitized) path
+         * @return a path
+         */
+        [[nodiscard]] const std::string &getPath() const {
+            return this->entry->first;
+        }
+
+        /**
+         * @brief Get the path's ID, which is unique among interned paths
+         * @return an ID
+         */
+        [[nodiscard]] unsigned long getID() const {
+            return this->entry->second;
+        }
+
+        /**
+         * @brief Equality operator
+         * @param other: another handle
+         * @return true if both handles are for the same path
+         */
+        bool operator==(const PathHandle &other) const {
+            return this->entry == other.entry;
+        }
+
+        /**
+         * @brief Inequality operator
+         * @param other: another handle
+         * @return true if the handles are for different paths
+         */
+        bool operator!=(const PathHandle &other) const {
+            return this->entry != other.entry;
+        }
+
+    private:
+        friend class FileLocation;
+
+        explicit PathHandle(const std::pair<const std::string, unsigned long> *entry) : entry(entry) {
+        }
+
+        static const std::pair<const std::string, unsigned long> empty_path_entry;
+
+        const std::pair<const std::string, unsigned long> *entry;
+    };
+
     /**
      * @brief  A class that encodes  a file location
      */
@@ -50,6 +111,21 @@ namespace wrench {
                                                       const std::string &path,
                                                       const std::shared_ptr<DataFile> &file);
 
+        static std::shared_ptr<FileLocation> LOCATION(const std::shared_ptr<StorageService> &ss,
+                                                      const PathHandle &path,
+                                                      const std::shared_ptr<DataFile> &file);
+
+        static std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> LOCATIONS(const std::shared_ptr<StorageService> &ss,
+                                                                                            const std::vector<std::shared_ptr<DataFile>> &files);
+
+        static std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> LOCATIONS(const std::shared_ptr<StorageService> &ss,
+                                                                                            const std::string &path,
+                                                                                            const std::vector<std::shared_ptr<DataFile>> &files);
+
+        static std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> LOCATIONS(const std::shared_ptr<StorageService> &ss,
+                                                                                            const PathHandle &path,
+                                                                                            const std::vector<std::shared_ptr<DataFile>> &files);
+
         static std::shared_ptr<FileLocation> SCRATCH(const std::shared_ptr<DataFile> &file);
 
         std::shared_ptr<DataFile> getFile();
@@ -58,8 +134,9 @@ namespace wrench {
 #ifdef PAGE_CACHE_SIMULATION
         std::shared_ptr<StorageService> getServerStorageService();
 #endif
-        std::string getDirectoryPath();
-        std::string getFilePath() const;
+        const std::string &getDirectoryPath() const;
+        PathHandle getDirectoryPathHandle() const;
+        const std::string &getFilePath() const;
         [[nodiscard]] bool isScratch() const;
         std::string toString() const;
 
@@ -78,7 +155,7 @@ namespace wrench {
             return ((not lhs->is_scratch) and
                     (not rhs->is_scratch) and
                     (lhs->getStorageService() == rhs->getStorageService()) and
-                    (lhs->getDirectoryPath() == rhs->getDirectoryPath()) and
+                    (lhs->directory_path == rhs->directory_path) and
                     (lhs->file == rhs->file));
         }
         /**
@@ -93,11 +170,12 @@ namespace wrench {
             return ((not this->is_scratch) and
                     (not other->is_scratch) and
                     (this->getStorageService() == other->getStorageService()) and
-                    (this->getDirectoryPath() == other->getDirectoryPath()) and
+                    (this->directory_path == other->directory_path) and
                     (this->getFile() == other->getFile()));
         }
 
         static std::string sanitizePath(const std::string &path);
+        static PathHandle internPath(const std::string &path);
         static bool properPathPrefix(const std::string &path1, const std::string &path2);
 
     private:
@@ -114,35 +192,91 @@ namespace wrench {
          * @brief Constructor
          * @param ss: the storage service
          * @param file: the file
-         * @param path: the file path
+         * @param path: the (interned) directory path
 	     * @param is_scratch: whether the location is a SCRATCH location
          */
-        FileLocation(std::shared_ptr<StorageService> ss, std::shared_ptr<DataFile> file, std::string path, bool is_scratch) : storage_service(std::move(ss)),
-                                                                                                                              directory_path(std::move(path)),
-                                                                                                                              file(std::move(file)),
-                                                                                                                              is_scratch(is_scratch) {
+        FileLocation(std::shared_ptr<StorageService> ss, std::shared_ptr<DataFile> file, PathHandle path, bool is_scratch) : storage_service(std::move(ss)),
+                                                                                                                             directory_path(path),
+                                                                                                                             file(std::move(file)),
+                                                                                                                             is_scratch(is_scratch) {
+            if (not is_scratch) {
+                this->file_path = this->directory_path.getPath() + "/" + this->file->getID();
+            }
         }
 
+        /**
+         * @brief The key under which a file location is interned (the storage service and the file
+         *        cannot be destroyed while interned locations refer to them, so their addresses
+         *        identify them)
+         */
+        struct FileLocationKey {
+            /** @brief The storage service (nullptr for a SCRATCH location) */
+            const StorageService *storage_service;
+            /** @brief The (interned) path's ID */
+            unsigned long path_id;
+            /** @brief The file */
+            const DataFile *file;
+            /** @brief Whether the location is a SCRATCH location */
+            bool is_scratch;
+
+            /**
+             * @brief Equality operator
+             * @param other: another key
+             * @return true or false
+             */
+            bool operator==(const FileLocationKey &other) const {
+                return (this->storage_service == other.storage_service) and (this->path_id == other.path_id) and
+                       (this->file == other.file) and (this->is_scratch == other.is_scratch);
+            }
+        };
+
+        /**
+         * @brief Hash function for file location keys
+         */
+        struct FileLocationKeyHash {
+            /**
+             * @brief Compute the hash of a key
+             * @param key: the key
+             * @return a hash value
+             */
+            size_t operator()(const FileLocationKey &key) const {
+                size_t hash = std::hash<const void *>()(key.storage_service);
+                hash ^= std::hash<const void *>()(key.file) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                hash ^= std::hash<unsigned long>()(2 * key.path_id + key.is_scratch) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                return hash;
+            }
+        };
+
         static std::shared_ptr<FileLocation> createFileLocation(const std::shared_ptr<StorageService> &ss,
                                                                 const std::shared_ptr<DataFile> &file,
-                                                                const std::string &path,
+                                                                const PathHandle &path,
                                                                 bool is_scratch);
 
         simgrid::s4u::Disk *getDiskOrNull() const;
 
         static void reclaimFileLocations();
+        static void clearFileLocations();
 
 #ifdef PAGE_CACHE_SIMULATION
         std::shared_ptr<StorageService> server_storage_service;
 #endif
 
         std::shared_ptr<StorageService> storage_service;
-        std::string directory_path;
+        PathHandle directory_path;
         std::shared_ptr<DataFile> file;
+        std::string file_path;
         bool is_scratch;
 
-        static std::unordered_map<std::string, std::shared_ptr<FileLocation>> file_location_map;
-        static size_t file_location_map_previous_size;
+        static std::unordered_map<FileLocationKey, std::shared_ptr<FileLocation>, FileLocationKeyHash> file_location_map;
+        // Sanitized path -> path ID (entries are never removed, so that path handles remain valid)
+        static std::unordered_map<std::string, unsigned long> path_ids;
+        // Path (sanitized or not) -> handle to the interned sanitized path
+        static std::unordered_map<std::string, PathHandle> path_handles;
+        // Keys of the locations interned since the last reclaim (the "young" generation)
+        static std::vector<FileLocationKey> young_file_locations;
+        // Number of interned locations that survived a reclaim (the "old" generation)
+        static size_t num_old_file_locations;
+        static size_t num_old_file_locations_after_last_full_reclaim;
     };
 
     /***********************/
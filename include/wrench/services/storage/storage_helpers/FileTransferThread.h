@@ -75,6 +75,9 @@ namespace wrench {
         int main() override;
         void cleanup(bool has_returned_from_main, int return_value) override;
 
+        static sg_size_t getMaxChunkSize(sg_size_t num_bytes, sg_size_t buffer_size, bool coalesce_data_chunks);
+        static sg_size_t getNextChunkSize(sg_size_t previous_chunk_size, sg_size_t remaining, sg_size_t buffer_size, sg_size_t max_chunk_size);
+
 
     private:
         friend class SimpleStorageServiceBufferized;
@@ -98,6 +101,10 @@ namespace wrench {
         S4U_CommPort *answer_commport_if_write;
         S4U_CommPort *answer_commport_if_copy;
         sg_size_t buffer_size;
+        bool coalesce_data_chunks = false;
+
+        // Only valid for a file copy (and if file copy timestamps are enabled)
+        SimulationTimestampFileCopyStart *copy_start_timestamp = nullptr;
 
         void receiveFileFromNetwork(const std::shared_ptr<DataFile> &f, S4U_CommPort *commport, const std::shared_ptr<FileLocation> &location);
         void sendLocalFileToNetwork(const std::shared_ptr<DataFile> &f, const std::shared_ptr<FileLocation> &location, sg_size_t num_bytes, S4U_CommPort *commport);
@@ -59,14 +59,14 @@ namespace wrench {
         std::unique_ptr<TMessageType> getMessage(const std::string &error_prefix = "") {
             auto id = ++messageCounter;
 #ifndef NDEBUG
-            this->templateWaitingLog(get_type_name<TMessageType>(), id);
+            this->templateWaitingLog(typeid(TMessageType), id);
 #endif
 
             auto message = this->getMessage(false);
 
             if (auto msg = dynamic_cast<TMessageType *>(message.get())) {
 #ifndef NDEBUG
-                this->templateWaitingLogUpdate(get_type_name<TMessageType>(), id);
+                this->templateWaitingLogUpdate(typeid(TMessageType), id);
 #endif
                 message.release(); // NOLINT(bugprone-unused-return-value)
                 return std::unique_ptr<TMessageType>(msg);
@@ -90,8 +90,7 @@ namespace wrench {
         std::unique_ptr<TMessageType> getMessage(double timeout, const std::string &error_prefix = "") {
             auto id = ++messageCounter;
 #ifndef NDEBUG
-            auto tn = get_type_name<TMessageType>();
-            this->templateWaitingLog(tn, id);
+            this->templateWaitingLog(typeid(TMessageType), id);
 #endif
 
 
@@ -100,7 +99,7 @@ namespace wrench {
             if (auto msg = dynamic_cast<TMessageType *>(message.get())) {
                 message.release(); // NOLINT(bugprone-unused-return-value)
 #ifndef NDEBUG
-                this->templateWaitingLogUpdate(tn, id);
+                this->templateWaitingLogUpdate(typeid(TMessageType), id);
 #endif
                 return std::unique_ptr<TMessageType>(msg);
             } else {
@@ -193,8 +192,8 @@ namespace wrench {
         std::unique_ptr<SimulationMessage> getMessage(double timeout, bool log);
 
 
-        void templateWaitingLog(const std::string &type, unsigned long long id);
-        void templateWaitingLogUpdate(const std::string &type, unsigned long long id);
+        void templateWaitingLog(const std::type_info &type, unsigned long long id);
+        void templateWaitingLogUpdate(const std::type_info &type, unsigned long long id);
 
         /** Statics **/
         friend class S4U_Simulation;
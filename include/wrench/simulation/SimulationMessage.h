@@ -11,6 +11,7 @@
 #ifndef WRENCH_SIMGRIDMESSAGES_H
 #define WRENCH_SIMGRIDMESSAGES_H
 
+#include <cstddef>
 #include <string>
 #include <map>
 #include <iostream>
@@ -34,6 +35,9 @@ namespace wrench {
 
         virtual std::string getName();
 
+        static void *operator new(std::size_t size);
+        static void operator delete(void *ptr, std::size_t size);
+
         /** @brief The message name */
         //std::string name;//we dont need this anymore :)
         /** @brief The message size in bytes */
@@ -10,12 +10,15 @@
 #ifndef WRENCH_SIMULATIONOUTPUT_H
 #define WRENCH_SIMULATIONOUTPUT_H
 
-#include <typeinfo>
-#include <typeindex>
+#include <array>
 #include <iostream>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
 
 #include "wrench/simulation/SimulationTimestamp.h"
 #include "wrench/simulation/SimulationTrace.h"
+#include "wrench/simulation/SimulationTraceSink.h"
 
 
 namespace wrench {
@@ -36,19 +39,72 @@ namespace wrench {
          */
         template<class T>
         std::vector<SimulationTimestamp<T> *> getTrace() {
-            std::type_index type_index = std::type_index(typeid(T));
-
-            // Is the trace empty?
-            if (this->traces.find(type_index) == this->traces.end()) {
-                return {};
-            }
-
-            std::vector<SimulationTimestamp<T> *> non_generic_vector;
-            auto trace = (SimulationTrace<T> *) (this->traces[type_index]);
-            for (auto ts: trace->getTrace()) {
-                non_generic_vector.push_back((SimulationTimestamp<T> *) ts);
-            }
-            return non_generic_vector;
+            return std::get<SimulationTrace<T>>(this->traces).getTrace();
+        }
+
+        /**
+         * @brief Retrieve a view of a simulation output trace, which unlike getTrace() does not
+         *        copy the trace (the view is invalidated when timestamps are added to the trace)
+         *
+         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @return a view of the timestamps, in the order in which they were added
+         */
+        template<class T>
+        SimulationTraceView<T> getTraceView() {
+            return std::get<SimulationTrace<T>>(this->traces).getTraceView();
+        }
+
+        /**
+         * @brief Retrieve a view of the timestamps of a simulation output trace whose dates are
+         *        in a time window (the view is invalidated when timestamps are added to the trace)
+         *
+         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @param start_date: the start of the time window
+         * @param end_date: the end of the time window (inclusive)
+         * @return a view of the timestamps, in date order
+         */
+        template<class T>
+        SimulationTraceView<T> getTraceView(double start_date, double end_date) {
+            return std::get<SimulationTrace<T>>(this->traces).getTraceView(start_date, end_date);
+        }
+
+        /**
+         * @brief Retrieve a view of the timestamps of a simulation output trace that pertain to a host
+         *
+         * @tparam a SimulationTimestampXXXX class whose instances have a hostname (e.g., SimulationTimestampDiskReadStart, SimulationTimestampPstateSet)
+         * @param hostname: the host's name
+         * @return a view of the timestamps, in the order in which they were added (the
+         *         trace is indexed by host incrementally, so that it is not scanned for each query)
+         */
+        template<class T>
+        SimulationTraceView<T> getTraceForHost(const std::string &hostname) {
+            return std::get<SimulationTrace<T>>(this->traces).getTraceViewForHost(hostname);
+        }
+
+        /**
+         * @brief Retrieve a view of the timestamps of a simulation output trace that pertain to a file
+         *
+         * @tparam a SimulationTimestampXXXX class whose instances have a file (e.g., SimulationTimestampFileReadStart, SimulationTimestampFileCopyStart)
+         * @param file: the file
+         * @return a view of the timestamps, in the order in which they were added (the
+         *         trace is indexed by file incrementally, so that it is not scanned for each query)
+         */
+        template<class T>
+        SimulationTraceView<T> getTraceForFile(const std::shared_ptr<DataFile> &file) {
+            return std::get<SimulationTrace<T>>(this->traces).getTraceViewForFile(file);
+        }
+
+        /**
+         * @brief Retrieve a view of the timestamps of a simulation output trace that pertain to a task
+         *
+         * @tparam a SimulationTimestampXXXX class whose instances have a task (e.g., SimulationTimestampTaskStart, SimulationTimestampFileReadStart)
+         * @param task: the task
+         * @return a view of the timestamps, in the order in which they were added (the
+         *         trace is indexed by task incrementally, so that it is not scanned for each query)
+         */
+        template<class T>
+        SimulationTraceView<T> getTraceForTask(const std::shared_ptr<WorkflowTask> &task) {
+            return std::get<SimulationTrace<T>>(this->traces).getTraceViewForTask(task);
         }
 
         void dumpWorkflowExecutionJSON(const std::shared_ptr<Workflow> &workflow, const std::string &file_path,
@@ -83,62 +139,88 @@ namespace wrench {
 
         void enableBandwidthTimestamps(bool enabled);
 
+        void setTraceSink(std::shared_ptr<SimulationTraceSink> sink);
+
+        std::shared_ptr<SimulationTraceSink> getTraceSink() const;
+
         /***********************/
         /** \cond INTERNAL     */
         /***********************/
 
-        void addTimestampTaskStart(double date, const std::shared_ptr<WorkflowTask> &task);
+        /**
+         * @brief A handle on a disk read or write, obtained when its start timestamp is added and
+         *        passed back when its failure or completion timestamp is added
+         * @tparam T: the start timestamp type
+         */
+        template<class T>
+        struct DiskTimestampHandle {
+            /** @brief The unique sequence number of the disk operation */
+            int unique_sequence_number = 0;
+            /** @brief The start timestamp (nullptr if disabled or streamed) */
+            T *start = nullptr;
+            /** @brief Whether the disk operation is streamed to the trace sink */
+            bool streamed = false;
+            /** @brief The start date (only set if the disk operation is streamed) */
+            double start_date = -1.0;
+        };
+
+        /** @brief A handle on a disk read */
+        typedef DiskTimestampHandle<SimulationTimestampDiskReadStart> DiskReadTimestampHandle;
+        /** @brief A handle on a disk write */
+        typedef DiskTimestampHandle<SimulationTimestampDiskWriteStart> DiskWriteTimestampHandle;
 
-        void addTimestampTaskFailure(double date, const std::shared_ptr<WorkflowTask> &task);
+        SimulationTimestampTaskStart *addTimestampTaskStart(double date, const std::shared_ptr<WorkflowTask> &task);
 
-        void addTimestampTaskCompletion(double date, const std::shared_ptr<WorkflowTask> &task);
+        void addTimestampTaskFailure(double date, const std::shared_ptr<WorkflowTask> &task, SimulationTimestampTaskStart *start);
 
-        void addTimestampTaskTermination(double date, const std::shared_ptr<WorkflowTask> &task);
+        void addTimestampTaskCompletion(double date, const std::shared_ptr<WorkflowTask> &task, SimulationTimestampTaskStart *start);
 
-        void addTimestampFileReadStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                       std::shared_ptr<WorkflowTask> task = nullptr);
+        void addTimestampTaskTermination(double date, const std::shared_ptr<WorkflowTask> &task, SimulationTimestampTaskStart *start);
+
+        SimulationTimestampFileReadStart *addTimestampFileReadStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
+                                                                    std::shared_ptr<WorkflowTask> task = nullptr);
 
         void addTimestampFileReadFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                         std::shared_ptr<WorkflowTask> task = nullptr);
+                                         std::shared_ptr<WorkflowTask> task, SimulationTimestampFileReadStart *start);
 
         void addTimestampFileReadCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                            std::shared_ptr<WorkflowTask> task = nullptr);
+                                            std::shared_ptr<WorkflowTask> task, SimulationTimestampFileReadStart *start);
 
-        void addTimestampFileWriteStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                        std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileWriteStart *addTimestampFileWriteStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
+                                                                      std::shared_ptr<WorkflowTask> task = nullptr);
 
         void addTimestampFileWriteFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                          std::shared_ptr<WorkflowTask> task = nullptr);
+                                          std::shared_ptr<WorkflowTask> task, SimulationTimestampFileWriteStart *start);
 
         void addTimestampFileWriteCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service,
-                                             std::shared_ptr<WorkflowTask> task = nullptr);
+                                             std::shared_ptr<WorkflowTask> task, SimulationTimestampFileWriteStart *start);
 
-        void addTimestampFileCopyStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src,
-                                       const std::shared_ptr<FileLocation> &dst);
+        SimulationTimestampFileCopyStart *addTimestampFileCopyStart(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src,
+                                                                    const std::shared_ptr<FileLocation> &dst);
 
         void addTimestampFileCopyFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src,
-                                         const std::shared_ptr<FileLocation> &dst);
+                                         const std::shared_ptr<FileLocation> &dst, SimulationTimestampFileCopyStart *start);
 
         void addTimestampFileCopyCompletion(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src,
-                                            std::shared_ptr<FileLocation> dst);
+                                            std::shared_ptr<FileLocation> dst, SimulationTimestampFileCopyStart *start);
 
-        int
+        DiskReadTimestampHandle
         addTimestampDiskReadStart(double date, std::string hostname, std::string path, sg_size_t bytes);
 
         void
-        addTimestampDiskReadFailure(double date, const std::string &hostname, const std::string &path, sg_size_t bytes, int unique_sequence_number);
+        addTimestampDiskReadFailure(double date, const std::string &hostname, const std::string &path, sg_size_t bytes, const DiskReadTimestampHandle &handle);
 
         void addTimestampDiskReadCompletion(double date, const std::string &hostname, const std::string &path, sg_size_t bytes,
-                                            int unique_sequence_number);
+                                            const DiskReadTimestampHandle &handle);
 
-        int
+        DiskWriteTimestampHandle
         addTimestampDiskWriteStart(double date, std::string hostname, const std::string& path, sg_size_t bytes);
 
         void
-        addTimestampDiskWriteFailure(double date, const std::string &hostname, const std::string &path, sg_size_t bytes, int unique_sequence_number);
+        addTimestampDiskWriteFailure(double date, const std::string &hostname, const std::string &path, sg_size_t bytes, const DiskWriteTimestampHandle &handle);
 
         void addTimestampDiskWriteCompletion(double date, const std::string &hostname, const std::string &path, sg_size_t bytes,
-                                             int unique_sequence_number);
+                                             const DiskWriteTimestampHandle &handle);
 
         void addTimestampPstateSet(double date, const std::string &hostname, int pstate);
 
@@ -147,18 +229,19 @@ namespace wrench {
         void addTimestampLinkUsage(double date, const std::string &link_name, double bytes_per_second);
 
         /**
-        * @brief Append a simulation timestamp to a simulation output trace
+        * @brief Append a simulation timestamp to a simulation output trace, constructing
+        *        its content directly in the trace's storage
         *
         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
-        * @param timestamp: a pointer to a SimulationTimestampXXXX object
+        * @param args: the arguments passed to the SimulationTimestampXXXX constructor
+        * @return a pointer to the SimulationTimestampXXXX object (owned by the trace)
         */
-        template<class T>
-        void addTimestamp(T *timestamp) {
-            std::type_index type_index = std::type_index(typeid(T));
-            if (this->traces.find(type_index) == this->traces.end()) {
-                this->traces[type_index] = new SimulationTrace<T>();
-            }
-            ((SimulationTrace<T> *) (this->traces[type_index]))->addTimestamp(new SimulationTimestamp<T>(timestamp));
+        template<class T, typename... Args>
+        T *addTimestamp(Args &&...args) {
+            auto &trace = std::get<SimulationTrace<T>>(this->traces);
+            auto content = new (trace.getContentStorage()) T(std::forward<Args>(args)...);
+            trace.addTimestamp(content);
+            return content;
         }
 
         /***********************/
@@ -178,7 +261,52 @@ namespace wrench {
         /***********************/
 
     private:
-        std::map<std::type_index, GenericSimulationTrace *> traces;
+        /** @brief All simulation output traces, one per timestamp type (resolved at compile time) */
+        typedef std::tuple<
+                SimulationTrace<SimulationTimestampTaskStart>,
+                SimulationTrace<SimulationTimestampTaskFailure>,
+                SimulationTrace<SimulationTimestampTaskCompletion>,
+                SimulationTrace<SimulationTimestampTaskTermination>,
+                SimulationTrace<SimulationTimestampFileReadStart>,
+                SimulationTrace<SimulationTimestampFileReadFailure>,
+                SimulationTrace<SimulationTimestampFileReadCompletion>,
+                SimulationTrace<SimulationTimestampFileWriteStart>,
+                SimulationTrace<SimulationTimestampFileWriteFailure>,
+                SimulationTrace<SimulationTimestampFileWriteCompletion>,
+                SimulationTrace<SimulationTimestampFileCopyStart>,
+                SimulationTrace<SimulationTimestampFileCopyFailure>,
+                SimulationTrace<SimulationTimestampFileCopyCompletion>,
+                SimulationTrace<SimulationTimestampDiskReadStart>,
+                SimulationTrace<SimulationTimestampDiskReadFailure>,
+                SimulationTrace<SimulationTimestampDiskReadCompletion>,
+                SimulationTrace<SimulationTimestampDiskWriteStart>,
+                SimulationTrace<SimulationTimestampDiskWriteFailure>,
+                SimulationTrace<SimulationTimestampDiskWriteCompletion>,
+                SimulationTrace<SimulationTimestampPstateSet>,
+                SimulationTrace<SimulationTimestampEnergyConsumption>,
+                SimulationTrace<SimulationTimestampLinkUsage>>
+                Traces;
+
+        /**
+         * @brief Compile-time index of a trace type in the Traces tuple
+         */
+        template<class Trace, class Tuple>
+        struct TraceIndex;
+
+        /**
+         * @brief Compile-time index of a trace type in the Traces tuple (found)
+         */
+        template<class Trace, class... Rest>
+        struct TraceIndex<Trace, std::tuple<Trace, Rest...>> : std::integral_constant<size_t, 0> {};
+
+        /**
+         * @brief Compile-time index of a trace type in the Traces tuple (recursion)
+         */
+        template<class Trace, class First, class... Rest>
+        struct TraceIndex<Trace, std::tuple<First, Rest...>>
+            : std::integral_constant<size_t, 1 + TraceIndex<Trace, std::tuple<Rest...>>::value> {};
+
+        Traces traces;
         nlohmann::json platform_json_part;
         nlohmann::json workflow_exec_json_part;
         nlohmann::json workflow_graph_json_part;
@@ -188,7 +316,22 @@ namespace wrench {
 
         static int unique_disk_sequence_number;
 
-        std::map<std::type_index, bool> enabledStatus;
+        /** @brief The file read and write start timestamps of an attempted execution of a task */
+        struct TaskExecutionIOTimestamps {
+            /** @brief The file read start timestamps */
+            std::vector<SimulationTimestampFileReadStart *> reads;
+            /** @brief The file write start timestamps */
+            std::vector<SimulationTimestampFileWriteStart *> writes;
+        };
+
+        TaskExecutionIOTimestamps &getTaskExecutionIOTimestamps(const std::shared_ptr<WorkflowTask> &task);
+
+        // File read/write start timestamps, indexed by task and then by execution attempt
+        std::unordered_map<std::shared_ptr<WorkflowTask>, std::vector<TaskExecutionIOTimestamps>> task_io_timestamps;
+
+        std::shared_ptr<SimulationTraceSink> trace_sink;
+
+        std::array<bool, std::tuple_size<Traces>::value> enabledStatus{};
 
         /**
          * @brief  Determines whether a time stamp time is enabled
@@ -197,8 +340,7 @@ namespace wrench {
          */
         template<class T>
         bool isEnabled() {
-            std::type_index type_index = std::type_index(typeid(T));
-            return this->enabledStatus[type_index];
+            return this->enabledStatus[TraceIndex<SimulationTrace<T>, Traces>::value];
         }
 
         /**
@@ -208,8 +350,7 @@ namespace wrench {
          */
         template<class T>
         void setEnabled(bool enabled) {
-            std::type_index type_index = std::type_index(typeid(T));
-            this->enabledStatus[type_index] = enabled;
+            this->enabledStatus[TraceIndex<SimulationTrace<T>, Traces>::value] = enabled;
         }
     };
 }// namespace wrench
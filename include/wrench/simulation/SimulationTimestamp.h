@@ -33,7 +33,7 @@ namespace wrench {
          * @return a pointer to a object of class T, i.e., a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
          */
         T *const getContent() {
-            return this->content.get();
+            return this->content;
         }
 
         /**
@@ -50,10 +50,10 @@ namespace wrench {
 
         /**
          * @brief Constructor
-         * @param content: a pointer to a object of class T, i.e., a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @param content: a pointer to a object of class T, i.e., a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h),
+         *                 which is owned by the simulation trace in which this timestamp is stored
          */
-        SimulationTimestamp(T *content) {
-            this->content = std::unique_ptr<T>(content);
+        SimulationTimestamp(T *content) : content(content) {
 	        TRACK_OBJECT("timestamp");
         }
 
@@ -69,7 +69,7 @@ namespace wrench {
         /***********************/
 
     private:
-        std::unique_ptr<T> content;
+        T *content;
     };
 
 }// namespace wrench
@@ -14,55 +14,9 @@
 #include "wrench/data_file/DataFile.h"
 #include "wrench/workflow/WorkflowTask.h"
 #include <unordered_map>
+#include <unordered_set>
 
 using namespace std;
-/***********************/
-/** \cond              */
-/***********************/
-
-typedef std::tuple<std::shared_ptr<wrench::DataFile>, std::shared_ptr<wrench::FileLocation>, std::shared_ptr<wrench::StorageService>> FileReadWrite;
-typedef std::tuple<std::shared_ptr<wrench::DataFile>, std::shared_ptr<wrench::FileLocation>, std::shared_ptr<wrench::FileLocation>> FileCopy;
-
-//struct FileCopy {
-//    std::shared_ptr<wrench::DataFile> file;
-//    std::shared_ptr<wrench::FileLocation> src;
-//    std::shared_ptr<wrench::FileLocation> dst;
-//};
-
-typedef std::tuple<std::string, std::string, int> DiskAccess;
-
-namespace std {
-    template<>
-    struct hash<FileCopy> {
-    public:
-        size_t operator()(const FileCopy &file) const {
-            return std::hash<void *>()(std::get<0>(file).get()) ^ std::hash<void *>()(std::get<1>(file).get()) ^ std::hash<void *>()(std::get<2>(file).get());
-            //            return std::hash<void *>()(file.file.get()) ^ std::hash<void *>()(file.src.get()) ^ std::hash<void *>()(file.dst.get());
-        }
-    };
-
-    template<>
-    struct hash<FileReadWrite> {
-    public:
-        size_t operator()(const FileReadWrite &file) const {
-            return std::hash<void *>()(std::get<0>(file).get()) ^ std::hash<void *>()(std::get<1>(file).get()) ^ std::hash<void *>()(std::get<2>(file).get());
-        }
-    };
-
-
-    template<>
-    struct hash<DiskAccess> {
-    public:
-        size_t operator()(const DiskAccess &diskAccess) const {
-            return std::hash<std::string>()(std::get<0>(diskAccess)) ^ std::hash<std::string>()(std::get<1>(diskAccess)) ^ std::hash<int>()(std::get<2>(diskAccess));
-        }
-    };
-};// namespace std
-
-/***********************/
-/** \endcond           */
-/***********************/
-
 namespace wrench {
 
     class WorkflowTask;
@@ -95,8 +49,12 @@ namespace wrench {
          */
         double date = -0.1;
 
+        static const std::string *internString(const std::string &string);
+
     private:
         friend class SimulationOutput;
+        template<class T>
+        friend class SimulationTrace;
         void setDate(double d);
     };
 
@@ -120,6 +78,8 @@ namespace wrench {
     protected:
         /** @brief An optional associated "endpoint" simulation timestamp */
         SimulationTimestampPair *endpoint = nullptr;
+
+        void setEndpoints(SimulationTimestampPair *start);
     };
 
     /**
@@ -131,8 +91,6 @@ namespace wrench {
         SimulationTimestampTask *getEndpoint() override;
 
     protected:
-        static std::map<std::string, SimulationTimestampTask *> pending_task_timestamps;
-        void setEndpoints();
         SimulationTimestampTask(double date, const std::shared_ptr<WorkflowTask> &task);
 
     private:
@@ -155,7 +113,7 @@ namespace wrench {
     class SimulationTimestampTaskFailure : public SimulationTimestampTask {
     private:
         friend class SimulationOutput;
-        SimulationTimestampTaskFailure(double date, const std::shared_ptr<WorkflowTask> &task);
+        SimulationTimestampTaskFailure(double date, const std::shared_ptr<WorkflowTask> &task, SimulationTimestampTaskStart *start);
     };
 
     /**
@@ -164,7 +122,7 @@ namespace wrench {
     class SimulationTimestampTaskCompletion : public SimulationTimestampTask {
     private:
         friend class SimulationOutput;
-        SimulationTimestampTaskCompletion(double date, const std::shared_ptr<WorkflowTask> &task);
+        SimulationTimestampTaskCompletion(double date, const std::shared_ptr<WorkflowTask> &task, SimulationTimestampTaskStart *start);
     };
 
     /**
@@ -173,7 +131,7 @@ namespace wrench {
     class SimulationTimestampTaskTermination : public SimulationTimestampTask {
     private:
         friend class SimulationOutput;
-        SimulationTimestampTaskTermination(double date, const std::shared_ptr<WorkflowTask> &);
+        SimulationTimestampTaskTermination(double date, const std::shared_ptr<WorkflowTask> &, SimulationTimestampTaskStart *start);
     };
 
     class SimulationTimestampFileReadStart;
@@ -214,13 +172,6 @@ namespace wrench {
          */
         std::shared_ptr<WorkflowTask> task;
 
-        /**
-         * @brief the data structure that holds the ongoing file reads.
-         */
-        ///static std::unordered_multimap<File, std::pair<SimulationTimestampFileRead *, double>, decltype(&file_hash)> pending_file_reads;
-        static std::unordered_multimap<FileReadWrite, std::pair<SimulationTimestampFileRead *, std::shared_ptr<WorkflowTask>>> pending_file_reads;
-
-        void setEndpoints();
         friend class SimulationOutput;
         SimulationTimestampFileRead(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src_location, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task = nullptr);
     };
@@ -246,7 +197,7 @@ namespace wrench {
     class SimulationTimestampFileReadFailure : public SimulationTimestampFileRead {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileReadFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileReadFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task, SimulationTimestampFileReadStart *start);
     };
 
     /**
@@ -255,7 +206,7 @@ namespace wrench {
     class SimulationTimestampFileReadCompletion : public SimulationTimestampFileRead {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileReadCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileReadCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &src, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task, SimulationTimestampFileReadStart *start);
     };
 
     class SimulationTimestampFileWriteStart;
@@ -296,14 +247,6 @@ namespace wrench {
          */
         std::shared_ptr<WorkflowTask> task;
 
-        /**
-         * @brief the data structure that holds the ongoing file writes.
-         */
-        ///static std::unordered_multimap<File, std::pair<SimulationTimestampFileWrite *, double>, decltype(&file_hash)> pending_file_writes;
-        static std::unordered_multimap<FileReadWrite, std::pair<SimulationTimestampFileWrite *, std::shared_ptr<WorkflowTask>>> pending_file_writes;
-
-        void setEndpoints();
-
         friend class SimulationOutput;
         SimulationTimestampFileWrite(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> dst_location, std::shared_ptr<StorageService> service, std::shared_ptr<WorkflowTask> task = nullptr);
     };
@@ -328,7 +271,7 @@ namespace wrench {
     class SimulationTimestampFileWriteFailure : public SimulationTimestampFileWrite {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileWriteFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &dst, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileWriteFailure(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &dst, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task, SimulationTimestampFileWriteStart *start);
     };
 
     /**
@@ -337,7 +280,7 @@ namespace wrench {
     class SimulationTimestampFileWriteCompletion : public SimulationTimestampFileWrite {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileWriteCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &dst, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task = nullptr);
+        SimulationTimestampFileWriteCompletion(double date, const std::shared_ptr<DataFile> &file, const std::shared_ptr<FileLocation> &dst, const std::shared_ptr<StorageService> &service, std::shared_ptr<WorkflowTask> task, SimulationTimestampFileWriteStart *start);
     };
 
     class SimulationTimestampFileCopyStart;
@@ -373,13 +316,6 @@ namespace wrench {
          * @brief The location where the DataFile was being copied to
          */
         std::shared_ptr<FileLocation> destination;
-
-        /**
-         * @brief the data structure that holds the ongoing file writes.
-         */
-        static std::unordered_multimap<FileCopy, SimulationTimestampFileCopy *> pending_file_copies;
-
-        void setEndpoints();
     };
 
     class SimulationTimestampFileCopyFailure;
@@ -402,7 +338,7 @@ namespace wrench {
     class SimulationTimestampFileCopyFailure : public SimulationTimestampFileCopy {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileCopyFailure(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src, std::shared_ptr<FileLocation> dst);
+        SimulationTimestampFileCopyFailure(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src, std::shared_ptr<FileLocation> dst, SimulationTimestampFileCopyStart *start);
     };
 
     /**
@@ -411,7 +347,7 @@ namespace wrench {
     class SimulationTimestampFileCopyCompletion : public SimulationTimestampFileCopy {
     private:
         friend class SimulationOutput;
-        SimulationTimestampFileCopyCompletion(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src, std::shared_ptr<FileLocation> dst);
+        SimulationTimestampFileCopyCompletion(double date, std::shared_ptr<DataFile> file, std::shared_ptr<FileLocation> src, std::shared_ptr<FileLocation> dst, SimulationTimestampFileCopyStart *start);
     };
 
     class SimulationTimestampDiskReadStart;
@@ -433,14 +369,14 @@ namespace wrench {
 
     protected:
         /**
-         * @brief hostname of disk being read from
+         * @brief hostname of disk being read from (interned)
          */
-        std::string hostname;
+        const std::string *hostname;
 
         /**
-         * @brief mount point of disk being read from
+         * @brief mount point of disk being read from (interned)
          */
-        std::string mount;
+        const std::string *mount;
 
         /**
          * @brief amount of bytes being read
@@ -452,13 +388,6 @@ namespace wrench {
          */
         int counter;
 
-
-        /**
-         * @brief the data structure that holds the ongoing disk reads.
-         */
-        static std::unordered_multimap<DiskAccess, SimulationTimestampDiskRead *> pending_disk_reads;
-
-        void setEndpoints();
         friend class SimulationOutput;
         SimulationTimestampDiskRead(double date, std::string hostname, std::string mount, sg_size_t bytes, int counter);
     };
@@ -484,7 +413,7 @@ namespace wrench {
     class SimulationTimestampDiskReadFailure : public SimulationTimestampDiskRead {
     private:
         friend class SimulationOutput;
-        SimulationTimestampDiskReadFailure(double date, const std::string &hostname, const std::string &mount, sg_size_t bytes, int counter);
+        SimulationTimestampDiskReadFailure(double date, const std::string &hostname, const std::string &mount, sg_size_t bytes, int counter, SimulationTimestampDiskReadStart *start);
     };
 
     /**
@@ -493,7 +422,7 @@ namespace wrench {
     class SimulationTimestampDiskReadCompletion : public SimulationTimestampDiskRead {
     private:
         friend class SimulationOutput;
-        SimulationTimestampDiskReadCompletion(double date, const std::string &hostname, const std::string &mount, sg_size_t bytes, int counter);
+        SimulationTimestampDiskReadCompletion(double date, const std::string &hostname, const std::string &mount, sg_size_t bytes, int counter, SimulationTimestampDiskReadStart *start);
     };
 
     class SimulationTimestampDiskWriteStart;
@@ -515,14 +444,14 @@ namespace wrench {
 
     protected:
         /**
-         * @brief hostname of disk being written to
+         * @brief hostname of disk being written to (interned)
          */
-        std::string hostname;
+        const std::string *hostname;
 
         /**
-         * @brief mount point of disk being written to
+         * @brief mount point of disk being written to (interned)
          */
-        std::string mount;
+        const std::string *mount;
 
         /**
          * @brief amount of bytes being written
@@ -534,12 +463,6 @@ namespace wrench {
          */
         int counter;
 
-        /**
-         * @brief the data structure that holds the ongoing disk writes.
-         */
-        static std::unordered_multimap<DiskAccess, SimulationTimestampDiskWrite *> pending_disk_writes;
-
-        void setEndpoints();
         friend class SimulationOutput;
         SimulationTimestampDiskWrite(double date, std::string hostname, std::string mount, sg_size_t bytes, int counter);
     };
@@ -565,7 +488,7 @@ namespace wrench {
     class SimulationTimestampDiskWriteFailure : public SimulationTimestampDiskWrite {
     private:
         friend class SimulationOutput;
-        SimulationTimestampDiskWriteFailure(double date, const std::string &hostname, const std::string &mount, sg_size_t bytes, int counter);
+        SimulationTimestampDiskWriteFailure(double date, const std::string &hostname, const std::string &mount, sg_size_t bytes, int counter, SimulationTimestampDiskWriteStart *start);
     };
 
     /**
@@ -574,7 +497,7 @@ namespace wrench {
     class SimulationTimestampDiskWriteCompletion : public SimulationTimestampDiskWrite {
     private:
         friend class SimulationOutput;
-        SimulationTimestampDiskWriteCompletion(double date, const std::string &hostname, const std::string &mount, sg_size_t bytes, int counter);
+        SimulationTimestampDiskWriteCompletion(double date, const std::string &hostname, const std::string &mount, sg_size_t bytes, int counter, SimulationTimestampDiskWriteStart *start);
     };
 
     /**
@@ -588,7 +511,7 @@ namespace wrench {
     private:
         friend class SimulationOutput;
         SimulationTimestampPstateSet(double date, const std::string &hostname, int pstate);
-        std::string hostname;
+        const std::string *hostname;// interned
         int pstate;
     };
 
@@ -603,7 +526,7 @@ namespace wrench {
     private:
         friend class SimulationOutput;
         SimulationTimestampEnergyConsumption(double date, const std::string &hostname, double joules);
-        std::string hostname;
+        const std::string *hostname;// interned
         double joules;
     };
 
@@ -618,7 +541,7 @@ namespace wrench {
     private:
         friend class SimulationOutput;
         SimulationTimestampLinkUsage(double date, const std::string &linkname, double bytes_per_second);
-        std::string linkname;
+        const std::string *linkname;// interned
         double bytes_per_second;
     };
 }// namespace wrench
@@ -12,11 +12,16 @@
 
 #include <vector>
 #include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
 #include <cmath>
 #include <cfloat>
 #include <algorithm>
+#include <type_traits>
 
 #include "wrench/simulation/SimulationTimestamp.h"
+#include "wrench/simulation/SimulationTraceView.h"
 
 namespace wrench {
 
@@ -41,7 +46,80 @@ namespace wrench {
     /***********************/
 
     /**
-     * @brief A template class to represent a trace of timestamps
+     * @brief An append-only arena of objects, allocated in fixed-size chunks so that objects are
+     *        stored densely, never move, and do not require one heap allocation each. Objects
+     *        are constructed in place by the caller (in the storage returned by getSlot()),
+     *        and are destroyed, in order, when the arena is destroyed.
+     *
+     * @tparam X: the object type
+     */
+    template<class X>
+    class SimulationTraceArena {
+
+    public:
+        /** @brief The number of objects per chunk */
+        static constexpr size_t CHUNK_SIZE = 1024;
+
+        SimulationTraceArena() = default;
+        SimulationTraceArena(const SimulationTraceArena &) = delete;
+        SimulationTraceArena &operator=(const SimulationTraceArena &) = delete;
+
+        /**
+         * @brief Get the storage for the next object (calling this method
+         *        again before commitSlot() returns the same storage)
+         * @return uninitialized storage for an object
+         */
+        void *getSlot() {
+            if (this->num_objects == this->chunks.size() * CHUNK_SIZE) {
+                this->chunks.emplace_back(new Slot[CHUNK_SIZE]);
+            }
+            return &this->chunks[this->num_objects / CHUNK_SIZE][this->num_objects % CHUNK_SIZE];
+        }
+
+        /**
+         * @brief Record that an object has been constructed in the storage returned by getSlot()
+         */
+        void commitSlot() {
+            this->num_objects++;
+        }
+
+        /**
+         * @brief Get the number of objects in the arena
+         * @return a number of objects
+         */
+        size_t size() const {
+            return this->num_objects;
+        }
+
+        /**
+         * @brief Get an object
+         * @param index: the object's index (in construction order)
+         * @return a pointer to the object
+         */
+        X *at(size_t index) const {
+            return reinterpret_cast<X *>(&this->chunks[index / CHUNK_SIZE][index % CHUNK_SIZE]);
+        }
+
+        /**
+         * @brief Destructor
+         */
+        ~SimulationTraceArena() {
+            for (size_t i = 0; i < this->num_objects; i++) {
+                this->at(i)->~X();
+            }
+        }
+
+    private:
+        typedef typename std::aligned_storage<sizeof(X), alignof(X)>::type Slot;
+
+        std::vector<std::unique_ptr<Slot[]>> chunks;
+        size_t num_objects = 0;
+    };
+
+    /**
+     * @brief A template class to represent a trace of timestamps. Timestamp contents (i.e., SimulationTimestampXXXX objects)
+     *        and the SimulationTimestamp<T> objects that wrap them are stored in arenas, and the vector of pointers
+     *        returned by getTrace() (or viewed by getTraceView()) is only materialized when requested.
      *
      * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
      */
@@ -49,17 +127,31 @@ namespace wrench {
     class SimulationTrace : public GenericSimulationTrace {
 
     public:
+        /**
+         * @brief Get the storage in which the content of the next timestamp should be
+         *        constructed, before being passed to addTimestamp()
+         *
+         * @return uninitialized storage for a SimulationTimestampXXXX object
+         */
+        void *getContentStorage() {
+            return this->contents.getSlot();
+        }
+
         /**
          * @brief Append a timestamp to the trace
          *
-         * @param timestamp: a pointer to a SimulationTimestamp<T> object
+         * @param content: a pointer to a SimulationTimestampXXXX object constructed in the storage returned by getContentStorage()
          * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
          */
-        void addTimestamp(SimulationTimestamp<T> *timestamp) {
-            this->trace.push_back(timestamp);
+        void addTimestamp(T *content) {
+            if (content != this->contents.getSlot()) {
+                throw std::runtime_error("SimulationTrace::addTimestamp(): Timestamp content was not constructed in the trace's storage");
+            }
+            this->contents.commitSlot();
+            new (this->timestamps.getSlot()) SimulationTimestamp<T>(content);
+            this->timestamps.commitSlot();
         }
 
-
         /**
          * @brief Retrieve the trace as a vector of timestamps
          *
@@ -67,21 +159,101 @@ namespace wrench {
          * @return a vector of pointers to SimulationTimestamp<T> objects
          */
         std::vector<SimulationTimestamp<T> *> getTrace() {
-            return this->trace;
+            this->materialize();
+            return this->materialized_trace;
         }
 
         /**
-         * @brief Destructor
+         * @brief Retrieve a view of the trace (which is invalidated when timestamps are added to the trace)
+         *
+         * @return a view of the timestamps, in the order in which they were added
          */
-        ~SimulationTrace<T>() {
-            for (auto &timestamp: this->trace) {
-                delete timestamp;
-            }
+        SimulationTraceView<T> getTraceView() {
+            this->materialize();
+            auto data = this->materialized_trace.data();
+            return SimulationTraceView<T>(data, data + this->materialized_trace.size());
         }
 
+        /**
+         * @brief Retrieve a view of the timestamps of the trace whose dates are in a time window
+         *        (which is invalidated when timestamps are added to the trace)
+         *
+         * @param start_date: the start of the time window
+         * @param end_date: the end of the time window (inclusive)
+         * @return a view of the timestamps, in date order
+         */
+        SimulationTraceView<T> getTraceView(double start_date, double end_date) {
+            this->materialize();
+            return this->date_index.getWindow(this->materialized_trace, start_date, end_date);
+        }
+
+        /**
+         * @brief Retrieve a view of the timestamps of the trace that pertain to a host
+         *        (which is invalidated when timestamps are added to the trace)
+         *
+         * @param hostname: the host's name
+         * @return a view of the timestamps, in the order in which they were added
+         */
+        SimulationTraceView<T> getTraceViewForHost(const std::string &hostname) {
+            this->materialize();
+            return this->host_index.getView(this->materialized_trace, hostname, [](SimulationTimestamp<T> *timestamp) {
+                return timestamp->getContent()->getHostname();
+            });
+        }
+
+        /**
+         * @brief Retrieve a view of the timestamps of the trace that pertain to a file
+         *        (which is invalidated when timestamps are added to the trace)
+         *
+         * @param file: the file
+         * @return a view of the timestamps, in the order in which they were added
+         */
+        SimulationTraceView<T> getTraceViewForFile(const std::shared_ptr<DataFile> &file) {
+            this->materialize();
+            return this->file_index.getView(this->materialized_trace, file, [](SimulationTimestamp<T> *timestamp) {
+                return timestamp->getContent()->getFile();
+            });
+        }
+
+        /**
+         * @brief Retrieve a view of the timestamps of the trace that pertain to a task
+         *        (which is invalidated when timestamps are added to the trace)
+         *
+         * @param task: the task
+         * @return a view of the timestamps, in the order in which they were added
+         */
+        SimulationTraceView<T> getTraceViewForTask(const std::shared_ptr<WorkflowTask> &task) {
+            this->materialize();
+            return this->task_index.getView(this->materialized_trace, task, [](SimulationTimestamp<T> *timestamp) {
+                return timestamp->getContent()->getTask();
+            });
+        }
+
+        /**
+         * @brief Change the date of a timestamp of the trace (e.g., when merging it with a new timestamp)
+         *
+         * @param content: a pointer to the timestamp's SimulationTimestampXXXX object
+         * @param date: the new date
+         */
+        void setTimestampDate(T *content, double date) {
+            content->setDate(date);
+            this->date_index.reset();
+        }
 
     private:
-        std::vector<SimulationTimestamp<T> *> trace;
+        void materialize() {
+            for (size_t i = this->materialized_trace.size(); i < this->timestamps.size(); i++) {
+                this->materialized_trace.push_back(this->timestamps.at(i));
+            }
+        }
+
+        SimulationTraceArena<T> contents;
+        SimulationTraceArena<SimulationTimestamp<T>> timestamps;
+        std::vector<SimulationTimestamp<T> *> materialized_trace;
+        SimulationTraceDateIndex<T> date_index;
+        SimulationTraceKeyIndex<T, std::string> host_index;
+        SimulationTraceKeyIndex<T, std::shared_ptr<DataFile>> file_index;
+        SimulationTraceKeyIndex<T, std::shared_ptr<WorkflowTask>> task_index;
     };
 
 
@@ -91,12 +263,29 @@ namespace wrench {
     template<>
     class SimulationTrace<SimulationTimestampPstateSet> : public GenericSimulationTrace {
     public:
+        /**
+         * @brief Get the storage in which the content of the next timestamp should be
+         *        constructed, before being passed to addTimestamp()
+         *
+         * @return uninitialized storage for a SimulationTimestampPstateSet object
+         */
+        void *getContentStorage() {
+            return this->contents.getSlot();
+        }
+
         /**
          * @brief Append a SimulationTimestampPstateSet timestamp to the trace
-         * @param new_timestamp: pointer to the timestamp
+         * @param content: pointer to the timestamp content, constructed in the storage returned by getContentStorage()
          */
-        void addTimestamp(SimulationTimestamp<SimulationTimestampPstateSet> *new_timestamp) {
-            auto hostname = new_timestamp->getContent()->getHostname();
+        void addTimestamp(SimulationTimestampPstateSet *content) {
+            if (content != this->contents.getSlot()) {
+                throw std::runtime_error("SimulationTrace::addTimestamp(): Timestamp content was not constructed in the trace's storage");
+            }
+            this->contents.commitSlot();
+            auto new_timestamp = new (this->timestamps.getSlot()) SimulationTimestamp<SimulationTimestampPstateSet>(content);
+            this->timestamps.commitSlot();
+
+            auto hostname = content->getHostname();
 
             auto hostname_search = latest_timestamps_by_host.find(hostname);
             if (hostname_search == latest_timestamps_by_host.end()) {
@@ -105,18 +294,16 @@ namespace wrench {
                 this->latest_timestamps_by_host[hostname] = this->trace.size() - 1;
             } else {
                 // a pstate timestamp associated to this host already exists
-                SimulationTimestamp<SimulationTimestampPstateSet> *&latest_timestamp = this->trace[this->latest_timestamps_by_host[hostname]];
+                SimulationTimestamp<SimulationTimestampPstateSet> *&latest_timestamp = this->trace[hostname_search->second];
 
                 // if the new_timestamp has the same date as the latest_timestamp, then the new_timestamp replaces
-                // the latest_timestamp in the trace, else the new time_stamp is added to the trace and the map of latest
+                // the latest_timestamp in the trace (the replaced timestamp stays in the arena until the trace is
+                // destroyed), else the new time_stamp is added to the trace and the map of latest
                 // timestamps is updated to reflect this change
                 if (std::fabs(new_timestamp->getDate() - latest_timestamp->getDate()) < DBL_EPSILON) {
-                    std::swap(new_timestamp, latest_timestamp);
-
-                    // now, latest_timestamp points to the contents of new_timestamp
-                    // and new_timestamp points to the contents of latest_timestamp so
-                    // we need to delete new_timestamp
-                    delete new_timestamp;
+                    latest_timestamp = new_timestamp;
+                    this->date_index.reset();
+                    this->host_index.reset();
                 } else {
                     if (new_timestamp->getDate() > latest_timestamp->getDate()) {
                         this->trace.push_back(new_timestamp);
@@ -138,17 +325,44 @@ namespace wrench {
         }
 
         /**
-         * @brief Destructor
+         * @brief Retrieve a view of the trace (which is invalidated when timestamps are added to the trace)
+         * @return a view of the timestamps
          */
-        ~SimulationTrace<SimulationTimestampPstateSet>() {
-            for (auto &timestamp: this->trace) {
-                delete timestamp;
-            }
+        SimulationTraceView<SimulationTimestampPstateSet> getTraceView() {
+            auto data = this->trace.data();
+            return SimulationTraceView<SimulationTimestampPstateSet>(data, data + this->trace.size());
+        }
+
+        /**
+         * @brief Retrieve a view of the timestamps of the trace whose dates are in a time window
+         *        (which is invalidated when timestamps are added to the trace)
+         * @param start_date: the start of the time window
+         * @param end_date: the end of the time window (inclusive)
+         * @return a view of the timestamps, in date order
+         */
+        SimulationTraceView<SimulationTimestampPstateSet> getTraceView(double start_date, double end_date) {
+            return this->date_index.getWindow(this->trace, start_date, end_date);
+        }
+
+        /**
+         * @brief Retrieve a view of the timestamps of the trace that pertain to a host
+         *        (which is invalidated when timestamps are added to the trace)
+         * @param hostname: the host's name
+         * @return a view of the timestamps, in trace order
+         */
+        SimulationTraceView<SimulationTimestampPstateSet> getTraceViewForHost(const std::string &hostname) {
+            return this->host_index.getView(this->trace, hostname, [](SimulationTimestamp<SimulationTimestampPstateSet> *timestamp) {
+                return timestamp->getContent()->getHostname();
+            });
         }
 
     private:
+        SimulationTraceArena<SimulationTimestampPstateSet> contents;
+        SimulationTraceArena<SimulationTimestamp<SimulationTimestampPstateSet>> timestamps;
         std::map<std::string, size_t> latest_timestamps_by_host;
         std::vector<SimulationTimestamp<SimulationTimestampPstateSet> *> trace;
+        SimulationTraceDateIndex<SimulationTimestampPstateSet> date_index;
+        SimulationTraceKeyIndex<SimulationTimestampPstateSet, std::string> host_index;
     };
 
     /***********************/
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SIMULATIONTRACEFILESINK_H
+#define WRENCH_SIMULATIONTRACEFILESINK_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+#include "wrench/simulation/SimulationTraceSink.h"
+
+namespace wrench {
+
+    /**
+     * @brief A simulation trace sink that streams records to a file, in a compact binary format
+     *        (in which hostnames, paths and link names are written only once), as newline-delimited JSON,
+     *        or as CSV. Records are accumulated in an in-memory buffer of bounded size, which is written
+     *        to the file whenever it is full. The file can be converted, after the simulation, to the
+     *        JSON outputs of SimulationOutput using reconstructJSON() (or the wrench-trace-to-json tool).
+     */
+    class SimulationTraceFileSink : public SimulationTraceSink {
+
+    public:
+        /** @brief Trace file formats */
+        enum Format {
+            /** @brief Compact binary records (native byte order) */
+            BINARY,
+            /** @brief One JSON object per line */
+            NDJSON,
+            /** @brief Comma-separated values, with a header line */
+            CSV
+        };
+
+        /** @brief The version of the binary format written by this class */
+        static constexpr uint32_t FORMAT_VERSION = 1;
+
+        /** @brief The default size of the in-memory buffer, in bytes */
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 1024 * 1024;
+
+        SimulationTraceFileSink(const std::string &file_path, Format format = BINARY, size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+        ~SimulationTraceFileSink() override;
+
+        void recordDiskRead(int sequence_number, const std::string &hostname, const std::string &mount,
+                            double start_date, double end_date, double bytes, bool failed) override;
+
+        void recordDiskWrite(int sequence_number, const std::string &hostname, const std::string &mount,
+                             double start_date, double end_date, double bytes, bool failed) override;
+
+        void recordPstateSet(double date, const std::string &hostname, int pstate) override;
+
+        void recordEnergyConsumption(double date, const std::string &hostname, double joules) override;
+
+        void recordLinkUsage(double date, const std::string &linkname, double bytes_per_second) override;
+
+        void flush() override;
+
+        static nlohmann::json reconstructJSON(const std::string &file_path);
+
+    private:
+        void recordDiskOperation(bool read, int sequence_number, const std::string &hostname, const std::string &mount,
+                                 double start_date, double end_date, double bytes, bool failed);
+        void recordSample(uint8_t record_type, double date, const std::string &name, double value);
+        void flushIfFull();
+
+        template<typename V>
+        void writeBinary(const V &value) {
+            this->buffer.append(reinterpret_cast<const char *>(&value), sizeof(V));
+        }
+        uint32_t getStringID(const std::string &string);
+        void writeCSVString(const std::string &string);
+
+        std::ofstream file;
+        Format format;
+        size_t buffer_size;
+        std::string buffer;
+        std::unordered_map<std::string, uint32_t> string_ids;// binary format only
+    };
+
+}// namespace wrench
+
+#endif//WRENCH_SIMULATIONTRACEFILESINK_H
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SIMULATIONTRACESINK_H
+#define WRENCH_SIMULATIONTRACESINK_H
+
+#include <string>
+
+namespace wrench {
+
+    /**
+     * @brief An abstract class that defines a sink to which the simulation output streams timestamps
+     *        as the simulation progresses, instead of keeping them in memory until the end of the simulation
+     *        (see SimulationOutput::setTraceSink()). Only timestamps whose number grows with the simulated
+     *        time (disk operations, pstate changes, energy consumption and link usage measurements) are
+     *        streamed, and disk operations are streamed once completed (or failed) as start/end pairs.
+     */
+    class SimulationTraceSink {
+
+    public:
+        /**
+         * @brief Record a completed (or failed) disk read
+         * @param sequence_number: the unique sequence number of the disk operation
+         * @param hostname: the name of the host of the disk
+         * @param mount: the path being read
+         * @param start_date: the date at which the operation started
+         * @param end_date: the date at which the operation completed (or failed)
+         * @param bytes: the number of bytes read
+         * @param failed: whether the operation failed
+         */
+        virtual void recordDiskRead(int sequence_number, const std::string &hostname, const std::string &mount,
+                                    double start_date, double end_date, double bytes, bool failed) = 0;
+
+        /**
+         * @brief Record a completed (or failed) disk write
+         * @param sequence_number: the unique sequence number of the disk operation
+         * @param hostname: the name of the host of the disk
+         * @param mount: the path being written
+         * @param start_date: the date at which the operation started
+         * @param end_date: the date at which the operation completed (or failed)
+         * @param bytes: the number of bytes written
+         * @param failed: whether the operation failed
+         */
+        virtual void recordDiskWrite(int sequence_number, const std::string &hostname, const std::string &mount,
+                                     double start_date, double end_date, double bytes, bool failed) = 0;
+
+        /**
+         * @brief Record a pstate change
+         * @param date: the date
+         * @param hostname: a hostname
+         * @param pstate: a pstate index
+         */
+        virtual void recordPstateSet(double date, const std::string &hostname, int pstate) = 0;
+
+        /**
+         * @brief Record an energy consumption measurement
+         * @param date: the date
+         * @param hostname: a hostname
+         * @param joules: the energy consumed so far, in joules
+         */
+        virtual void recordEnergyConsumption(double date, const std::string &hostname, double joules) = 0;
+
+        /**
+         * @brief Record a link usage measurement
+         * @param date: the date
+         * @param linkname: a link name
+         * @param bytes_per_second: the link usage in bytes per second
+         */
+        virtual void recordLinkUsage(double date, const std::string &linkname, double bytes_per_second) = 0;
+
+        /**
+         * @brief Write out all buffered records
+         */
+        virtual void flush() = 0;
+
+        /**
+         * @brief Destructor
+         */
+        virtual ~SimulationTraceSink() = default;
+    };
+
+}// namespace wrench
+
+#endif//WRENCH_SIMULATIONTRACESINK_H
@@ -0,0 +1,375 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SIMULATIONTRACEVIEW_H
+#define WRENCH_SIMULATIONTRACEVIEW_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "wrench/simulation/SimulationTimestamp.h"
+
+namespace wrench {
+
+    template<class T, class Predicate>
+    class SimulationTraceFilteredView;
+
+    /**
+     * @brief A read-only view of a sequence of timestamps of a simulation output trace, which
+     *        does not copy the trace. A view is invalidated when timestamps are added to the trace.
+     *
+     * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+     */
+    template<class T>
+    class SimulationTraceView {
+
+    public:
+        /** @brief A (random-access) iterator over the timestamps of the view */
+        typedef SimulationTimestamp<T> *const *iterator;
+
+        /**
+         * @brief Constructor (for an empty view)
+         */
+        SimulationTraceView() = default;
+
+        /**
+         * @brief Constructor
+         * @param begin: an iterator to the first timestamp of the view
+         * @param end: an iterator past the last timestamp of the view
+         */
+        SimulationTraceView(iterator begin, iterator end) : first(begin), last(end) {
+        }
+
+        /**
+         * @brief Get an iterator to the first timestamp of the view
+         * @return an iterator
+         */
+        iterator begin() const {
+            return this->first;
+        }
+
+        /**
+         * @brief Get an iterator past the last timestamp of the view
+         * @return an iterator
+         */
+        iterator end() const {
+            return this->last;
+        }
+
+        /**
+         * @brief Get the number of timestamps in the view
+         * @return a number of timestamps
+         */
+        size_t size() const {
+            return this->last - this->first;
+        }
+
+        /**
+         * @brief Determine whether the view is empty
+         * @return true or false
+         */
+        bool empty() const {
+            return this->first == this->last;
+        }
+
+        /**
+         * @brief Get a timestamp of the view
+         * @param index: the timestamp's index in the view
+         * @return a pointer to a SimulationTimestamp<T> object
+         */
+        SimulationTimestamp<T> *operator[](size_t index) const {
+            return this->first[index];
+        }
+
+        /**
+         * @brief Copy the view into a vector
+         * @return a vector of pointers to SimulationTimestamp<T> objects
+         */
+        std::vector<SimulationTimestamp<T> *> toVector() const {
+            return std::vector<SimulationTimestamp<T> *>(this->first, this->last);
+        }
+
+        /**
+         * @brief Get a view of the timestamps of this view that satisfy a predicate, which is
+         *        evaluated lazily as the view is iterated over
+         * @param predicate: a callable that takes a SimulationTimestamp<T>* and returns a bool
+         * @return a filtered view
+         */
+        template<class Predicate>
+        SimulationTraceFilteredView<T, Predicate> filter(Predicate predicate) const {
+            return SimulationTraceFilteredView<T, Predicate>(*this, std::move(predicate));
+        }
+
+    private:
+        iterator first = nullptr;
+        iterator last = nullptr;
+    };
+
+    /**
+     * @brief A read-only view of the timestamps of a SimulationTraceView that satisfy a predicate
+     *
+     * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+     * @tparam Predicate: a callable that takes a SimulationTimestamp<T>* and returns a bool
+     */
+    template<class T, class Predicate>
+    class SimulationTraceFilteredView {
+
+    public:
+        /**
+         * @brief A (forward) iterator over the timestamps of the view
+         */
+        class iterator {
+
+        public:
+            /** @brief Iterator category */
+            typedef std::forward_iterator_tag iterator_category;
+            /** @brief Value type */
+            typedef SimulationTimestamp<T> *value_type;
+            /** @brief Difference type */
+            typedef std::ptrdiff_t difference_type;
+            /** @brief Pointer type */
+            typedef SimulationTimestamp<T> *const *pointer;
+            /** @brief Reference type */
+            typedef SimulationTimestamp<T> *const &reference;
+
+            /**
+             * @brief Constructor
+             * @param view: the filtered view
+             * @param current: the position in the underlying view (advanced to the next timestamp that satisfies the predicate)
+             */
+            iterator(const SimulationTraceFilteredView *view, typename SimulationTraceView<T>::iterator current) : view(view), current(current) {
+                this->skip();
+            }
+
+            /**
+             * @brief Dereference operator
+             * @return a pointer to a SimulationTimestamp<T> object
+             */
+            reference operator*() const {
+                return *this->current;
+            }
+
+            /**
+             * @brief Pre-increment operator
+             * @return the iterator
+             */
+            iterator &operator++() {
+                ++this->current;
+                this->skip();
+                return *this;
+            }
+
+            /**
+             * @brief Post-increment operator
+             * @return a copy of the iterator before it was incremented
+             */
+            iterator operator++(int) {
+                auto previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            /**
+             * @brief Equality operator
+             * @param other: another iterator
+             * @return true or false
+             */
+            bool operator==(const iterator &other) const {
+                return this->current == other.current;
+            }
+
+            /**
+             * @brief Inequality operator
+             * @param other: another iterator
+             * @return true or false
+             */
+            bool operator!=(const iterator &other) const {
+                return this->current != other.current;
+            }
+
+        private:
+            void skip() {
+                while ((this->current != this->view->view.end()) and (not this->view->predicate(*this->current))) {
+                    ++this->current;
+                }
+            }
+
+            const SimulationTraceFilteredView *view;
+            typename SimulationTraceView<T>::iterator current;
+        };
+
+        /**
+         * @brief Constructor
+         * @param view: the view to filter
+         * @param predicate: a callable that takes a SimulationTimestamp<T>* and returns a bool
+         */
+        SimulationTraceFilteredView(SimulationTraceView<T> view, Predicate predicate) : view(view), predicate(std::move(predicate)) {
+        }
+
+        /**
+         * @brief Get an iterator to the first timestamp of the view
+         * @return an iterator
+         */
+        iterator begin() const {
+            return iterator(this, this->view.begin());
+        }
+
+        /**
+         * @brief Get an iterator past the last timestamp of the view
+         * @return an iterator
+         */
+        iterator end() const {
+            return iterator(this, this->view.end());
+        }
+
+        /**
+         * @brief Copy the view into a vector
+         * @return a vector of pointers to SimulationTimestamp<T> objects
+         */
+        std::vector<SimulationTimestamp<T> *> toVector() const {
+            return std::vector<SimulationTimestamp<T> *>(this->begin(), this->end());
+        }
+
+    private:
+        SimulationTraceView<T> view;
+        Predicate predicate;
+    };
+
+    /***********************/
+    /** \cond INTERNAL    */
+    /***********************/
+
+    /**
+     * @brief An index used to answer time-window queries on a trace by binary search. Most traces are
+     *        appended to in date order, in which case the trace itself is searched. Otherwise (e.g., task
+     *        and file timestamps, which are added when a job completes), a date-sorted copy of the trace
+     *        is kept, and is extended by merging in the timestamps added since the previous query.
+     *
+     * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+     */
+    template<class T>
+    class SimulationTraceDateIndex {
+
+    public:
+        /**
+         * @brief Get a view of the timestamps of a trace whose dates are in a time window
+         * @param trace: the trace (to which timestamps may only have been appended since the previous call)
+         * @param start_date: the start of the time window
+         * @param end_date: the end of the time window (inclusive)
+         * @return a view of the timestamps, in date order
+         */
+        SimulationTraceView<T> getWindow(const std::vector<SimulationTimestamp<T> *> &trace, double start_date, double end_date) {
+            if (start_date > end_date) {
+                throw std::invalid_argument("SimulationTraceDateIndex::getWindow(): start_date cannot be later than end_date");
+            }
+
+            for (; this->num_checked < trace.size(); this->num_checked++) {
+                if ((this->num_checked > 0) and (trace[this->num_checked]->getDate() < trace[this->num_checked - 1]->getDate())) {
+                    this->in_date_order = false;
+                }
+            }
+
+            const std::vector<SimulationTimestamp<T> *> *sorted_trace = &trace;
+            if (not this->in_date_order) {
+                auto num_sorted = this->trace_by_date.size();
+                if (num_sorted < trace.size()) {
+                    this->trace_by_date.insert(this->trace_by_date.end(), trace.begin() + num_sorted, trace.end());
+                    auto middle = this->trace_by_date.begin() + num_sorted;
+                    std::stable_sort(middle, this->trace_by_date.end(), isEarlier);
+                    std::inplace_merge(this->trace_by_date.begin(), middle, this->trace_by_date.end(), isEarlier);
+                }
+                sorted_trace = &this->trace_by_date;
+            }
+
+            auto begin = std::lower_bound(sorted_trace->begin(), sorted_trace->end(), start_date,
+                                          [](SimulationTimestamp<T> *timestamp, double date) { return timestamp->getDate() < date; });
+            auto end = std::upper_bound(begin, sorted_trace->end(), end_date,
+                                        [](double date, SimulationTimestamp<T> *timestamp) { return date < timestamp->getDate(); });
+            auto data = sorted_trace->data();
+            return SimulationTraceView<T>(data + (begin - sorted_trace->begin()), data + (end - sorted_trace->begin()));
+        }
+
+        /**
+         * @brief Reset the index (to be called when timestamps of the trace have been replaced)
+         */
+        void reset() {
+            this->num_checked = 0;
+            this->in_date_order = true;
+            this->trace_by_date.clear();
+        }
+
+    private:
+        static bool isEarlier(SimulationTimestamp<T> *lhs, SimulationTimestamp<T> *rhs) {
+            return lhs->getDate() < rhs->getDate();
+        }
+
+        size_t num_checked = 0;
+        bool in_date_order = true;
+        std::vector<SimulationTimestamp<T> *> trace_by_date;// only used if the trace is not in date order
+    };
+
+    /**
+     * @brief An index used to answer per-key (e.g., per-host) queries on a trace without scanning it. The
+     *        timestamps of each key are kept in a vector, which is extended with the timestamps
+     *        added to the trace since the previous query.
+     *
+     * @tparam T: a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+     * @tparam Key: the key type
+     */
+    template<class T, class Key>
+    class SimulationTraceKeyIndex {
+
+    public:
+        /**
+         * @brief Get a view of the timestamps of a trace that have a key
+         * @param trace: the trace (to which timestamps may only have been appended since the previous call)
+         * @param key: the key
+         * @param key_of: a callable that takes a SimulationTimestamp<T>* and returns its key
+         * @return a view of the timestamps, in trace order
+         */
+        template<class KeyOf>
+        SimulationTraceView<T> getView(const std::vector<SimulationTimestamp<T> *> &trace, const Key &key, KeyOf key_of) {
+            for (; this->num_indexed < trace.size(); this->num_indexed++) {
+                auto timestamp = trace[this->num_indexed];
+                this->trace_by_key[key_of(timestamp)].push_back(timestamp);
+            }
+
+            auto it = this->trace_by_key.find(key);
+            if (it == this->trace_by_key.end()) {
+                return {};
+            }
+            auto data = it->second.data();
+            return SimulationTraceView<T>(data, data + it->second.size());
+        }
+
+        /**
+         * @brief Reset the index (to be called when timestamps of the trace have been replaced)
+         */
+        void reset() {
+            this->num_indexed = 0;
+            this->trace_by_key.clear();
+        }
+
+    private:
+        size_t num_indexed = 0;
+        std::unordered_map<Key, std::vector<SimulationTimestamp<T> *>> trace_by_key;
+    };
+
+    /***********************/
+    /** \endcond INTERNAL  */
+    /***********************/
+
+}// namespace wrench
+
+#endif//WRENCH_SIMULATIONTRACEVIEW_H
@@ -27,7 +27,9 @@ namespace wrench {
         /**
          * @brief Create an abstract workflow based on a JSON file in the WfFormat (version 1.5) from WfCommons. This method
          *        makes executive decisions when information in the JSON file is incomplete and/or contradictory. Pass true
-         *        as the last argument to see all warnings on stderr.
+         *        as the show_warnings argument to see all warnings on stderr. The file is streamed through a SAX parser so that
+         *        the full JSON document is never held in memory: files and tasks are created as they are encountered,
+         *        and task dependencies are all added at once at the end.
          *
          *
          * @param filename: the path to the JSON file
@@ -62,6 +64,10 @@ namespace wrench {
          *                        to compute the task's work in flop. If set to true, then the task's execution time reported in the
          *                        JSON will be assumed to be 100% CPU work. (default is false)
          * @param show_warnings: Show all warnings. (default is false)
+         * @param num_parsing_threads: The number of threads used to parse and validate task specifications and task
+         *                             executions, which are then added to the workflow in document order so that
+         *                             the workflow (and the order of warnings) does not depend on the number of threads.
+         *                             Passing 0 uses as many threads as there are hardware threads. (default is 1)
          * @return a workflow
          */
 
@@ -74,13 +80,14 @@ namespace wrench {
                                                                 unsigned long max_cores_per_task = 1,
                                                                 bool enforce_num_cores = false,
                                                                 bool ignore_avg_cpu = false,
-                                                                bool show_warnings = false);
+                                                                bool show_warnings = false,
+                                                                unsigned long num_parsing_threads = 1);
 
 
         /**
          * @brief Create an abstract workflow based on a JSON file in the WfFormat (version 1.5) from WfCommons. This method
          *        makes executive decisions when information in the JSON file is incomplete and/or contradictory. Pass true
-         *        as the last argument to see all warnings on stderr.
+         *        as the show_warnings argument to see all warnings on stderr.
          *
          *
          * @param json_string: the JSON string
@@ -115,6 +122,10 @@ namespace wrench {
          *                        to compute the task's work in flop. If set to true, then the task's execution time reported in the
          *                        JSON will be assumed to be 100% CPU work. (default is false)
          * @param show_warnings: Show all warnings. (default is false)
+         * @param num_parsing_threads: The number of threads used to parse and validate task specifications and task
+         *                             executions, which are then added to the workflow in document order so that
+         *                             the workflow (and the order of warnings) does not depend on the number of threads.
+         *                             Passing 0 uses as many threads as there are hardware threads. (default is 1)
          * @return a workflow
          */
 
@@ -127,7 +138,8 @@ namespace wrench {
                                                                       unsigned long max_cores_per_task = 1,
                                                                       bool enforce_num_cores = false,
                                                                       bool ignore_avg_cpu = false,
-                                                                      bool show_warnings = false);
+                                                                      bool show_warnings = false,
+                                                                      unsigned long num_parsing_threads = 1);
 
         /**
          * @brief Method to create a JSON string in the WfFormat (version 1.5) from WfCommons, from a workflow object.
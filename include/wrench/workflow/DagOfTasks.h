@@ -10,9 +10,11 @@
 #ifndef WRENCH_DAGOFTASKS_H
 #define WRENCH_DAGOFTASKS_H
 
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/breadth_first_search.hpp>
+#include <climits>
 #include <iostream>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #include "wrench/workflow/WorkflowTask.h"
 
@@ -24,38 +26,32 @@ namespace wrench {
 
     class WorkflowTask;
 
-    /**
-     * @brief Data structure to store vertex properties
-     */
-    struct VertexProperties {
-        //    std::size_t index;
-        //    boost::default_color_type color;
-        /** @brief Task attached to the vertex */
-        const WorkflowTask *task;
-    };
-
-    /**
-     * @brief Convenient DAG typedef
-     */
-    typedef boost::adjacency_list<boost::listS, boost::vecS, boost::bidirectionalS, VertexProperties> DAG;
-
     /**
      * @brief Convenient vertext_t typedef
      */
     typedef unsigned long vertex_t;// To clean up some day...
 
     /**
-     * @brief An internal class that uses the Boost Graph Library to implement a DAG of WorkflowTask objects
+     * @brief An internal class that implements a DAG of WorkflowTask objects. Edges are stored
+     *        in a compressed-sparse-row (CSR) layout, i.e., contiguous arrays of children and parents
+     *        indexed by per-vertex offsets, plus small per-vertex lists of edges added since the CSR arrays were last rebuilt.
+     *        Removed vertices and edges are tombstoned, and the structure is periodically compacted.
      */
     class DagOfTasks {
 
     public:
-        void addVertex(const WorkflowTask *task);
+        /** @brief Index used to denote a non-existing (or removed) vertex */
+        static constexpr vertex_t NO_VERTEX = ULONG_MAX;
+
+        vertex_t addVertex(const WorkflowTask *task);
 
         void removeVertex(WorkflowTask *task);
 
         void addEdge(WorkflowTask *src, WorkflowTask *dst);
 
+        bool addEdges(const std::vector<std::tuple<WorkflowTask *, WorkflowTask *, bool>> &edges,
+                      std::vector<std::pair<WorkflowTask *, WorkflowTask *>> &added_edges);
+
         void removeEdge(WorkflowTask *src, WorkflowTask *dst);
 
         bool doesPathExist(const WorkflowTask *src, const WorkflowTask *dst);
@@ -69,30 +65,73 @@ namespace wrench {
 
         std::vector<WorkflowTask *> getParents(const WorkflowTask *task);
 
+        long getVertexNumberOfChildren(vertex_t vertex) const;
+
+        std::vector<WorkflowTask *> getVertexChildren(vertex_t vertex) const;
+
+        long getVertexNumberOfParents(vertex_t vertex) const;
+
+        std::vector<WorkflowTask *> getVertexParents(vertex_t vertex) const;
+
+        bool shouldBeCompacted() const;
+
+        std::vector<vertex_t> compact();
+
     private:
-        /**
-         * @brief Nested class that's used for the BFS algorithm in the BGL
-         */
-        class custom_bfs_visitor : public boost::default_bfs_visitor {
-        public:
-            const WorkflowTask *target_task;
+        vertex_t lookupVertex(const WorkflowTask *task, const std::string &error_message);
+        void checkVertex(vertex_t vertex, const std::string &error_message) const;
 
-            explicit custom_bfs_visitor(const WorkflowTask *target_task) : boost::default_bfs_visitor() {
-                this->target_task = target_task;
-            }
+        unsigned long removeFromAdjacency(vertex_t vertex, vertex_t neighbor, bool children);
+        void rebuildCSR(const std::vector<vertex_t> &new_indices, unsigned long new_num_vertices);
+        void rebuildCSRIfNeeded();
 
-            template<typename Vertex, typename Graph>
-            void discover_vertex(Vertex u, Graph &g) {
-                if (g[u].task == target_task) {
-                    throw std::runtime_error("path found");
+        /**
+         * @brief Apply a function to each child (or parent) of a vertex
+         * @param vertex: the vertex
+         * @param children: true to iterate over children, false to iterate over parents
+         * @param f: the function
+         */
+        template<typename F>
+        void forEachNeighbor(vertex_t vertex, bool children, F f) const {
+            auto const &offsets = children ? this->out_offsets : this->in_offsets;
+            auto const &neighbors = children ? this->out_neighbors : this->in_neighbors;
+            if (vertex + 1 < offsets.size()) {
+                for (auto i = offsets[vertex]; i < offsets[vertex + 1]; i++) {
+                    if (neighbors[i] != NO_VERTEX) {
+                        f(neighbors[i]);
+                    }
                 }
             }
-        };
+            for (auto const &neighbor: (children ? this->added_children : this->added_parents)[vertex]) {
+                f(neighbor);
+            }
+        }
 
+        // Vertex -> task (nullptr for a removed vertex)
         std::vector<const WorkflowTask *> task_list;
-        std::unordered_map<const WorkflowTask *, unsigned long> task_map;
+        std::unordered_map<const WorkflowTask *, vertex_t> task_map;
+
+        // CSR arrays (removed edges are set to NO_VERTEX)
+        std::vector<unsigned long> out_offsets;
+        std::vector<vertex_t> out_neighbors;
+        std::vector<unsigned long> in_offsets;
+        std::vector<vertex_t> in_neighbors;
+
+        // Edges added since the CSR arrays were last rebuilt
+        std::vector<std::vector<vertex_t>> added_children;
+        std::vector<std::vector<vertex_t>> added_parents;
+
+        // Per-vertex numbers of (live) children and parents
+        std::vector<unsigned long> num_children;
+        std::vector<unsigned long> num_parents;
+
+        unsigned long num_removed_vertices = 0;
+        unsigned long num_removed_csr_edges = 0;// removed edges still taking up room in the CSR arrays
+        unsigned long num_added_edges = 0;
 
-        DAG dag;
+        // Stamps used to mark visited vertices in graph traversals without clearing
+        std::vector<unsigned long> visit_stamps;
+        unsigned long current_visit_stamp = 0;
     };
 
     /***********************/
@@ -12,6 +12,7 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
 
 #include "wrench/execution_events/ExecutionEvent.h"
 #include "wrench/data_file/DataFile.h"
@@ -64,25 +65,37 @@ namespace wrench {
         void addControlDependency(const std::shared_ptr<WorkflowTask> &src, const std::shared_ptr<WorkflowTask> &dst, bool redundant_dependencies = false);
         void removeControlDependency(const std::shared_ptr<WorkflowTask> &src, const std::shared_ptr<WorkflowTask> &dst);
 
+        void beginBulkDependencyInsertion();
+        void commitBulkDependencyInsertion(bool ignore_cycle_creating_dependencies = false);
+        bool isBulkDependencyInsertionInProgress() const;
+
         static void updateReadiness(WorkflowTask *task);
 
         unsigned long getNumberOfTasks() const;
 
         unsigned long getNumLevels() const;
 
+        double getCriticalPathFlops() const;
+        double getCriticalPathBytes() const;
+
         double getStartDate() const;
         double getCompletionDate() const;
 
         std::vector<std::shared_ptr<DataFile>> getInputFiles() const;
         std::map<std::string, std::shared_ptr<DataFile>> getInputFileMap() const;
+        const std::map<std::string, std::shared_ptr<DataFile>> &getInputFileMapView() const;
         std::vector<std::shared_ptr<DataFile>> getOutputFiles() const;
         std::map<std::string, std::shared_ptr<DataFile>> getOutputFileMap() const;
+        const std::map<std::string, std::shared_ptr<DataFile>> &getOutputFileMapView() const;
 
         std::vector<std::shared_ptr<WorkflowTask>> getTasks() const;
         std::map<std::string, std::shared_ptr<WorkflowTask>> getTaskMap();
+        const std::map<std::string, std::shared_ptr<WorkflowTask>> &getTaskMapView() const;
         std::map<std::string, std::shared_ptr<WorkflowTask>> getEntryTaskMap() const;
+        const std::map<std::string, std::shared_ptr<WorkflowTask>> &getEntryTaskMapView() const;
         std::vector<std::shared_ptr<WorkflowTask>> getEntryTasks() const;
         std::map<std::string, std::shared_ptr<WorkflowTask>> getExitTaskMap() const;
+        const std::map<std::string, std::shared_ptr<WorkflowTask>> &getExitTaskMapView() const;
         std::vector<std::shared_ptr<WorkflowTask>> getExitTasks() const;
 
         std::vector<std::shared_ptr<WorkflowTask>> getTaskParents(const std::shared_ptr<WorkflowTask> &task);
@@ -109,8 +122,11 @@ namespace wrench {
         std::vector<std::shared_ptr<WorkflowTask>> getTasksInBottomLevelRange(int min, int max) const;
 
         std::vector<std::shared_ptr<WorkflowTask>> getReadyTasks();
+        const std::vector<std::shared_ptr<WorkflowTask>> &getReadyTasksView() const;
 
         std::map<std::string, std::vector<std::shared_ptr<WorkflowTask>>> getReadyClusters() const;
+        const std::vector<std::shared_ptr<WorkflowTask>> &getReadyClusterView(const std::string &cluster_id) const;
+        const std::unordered_map<std::string, std::vector<std::shared_ptr<WorkflowTask>>> &getReadyClustersView() const;
 
         /***********************/
         /** \endcond           */
@@ -123,6 +139,10 @@ namespace wrench {
 
         std::string name;
         bool update_top_bottom_levels_dynamically;
+        bool bulk_dependency_insertion_in_progress;
+
+        /* Control dependencies whose insertion is deferred until the bulk insertion is committed */
+        std::vector<std::tuple<WorkflowTask *, WorkflowTask *, bool>> pending_control_dependencies;
 
         Workflow();
 
@@ -137,8 +157,29 @@ namespace wrench {
         /* Map to find tasks by name */
         std::map<std::string, std::shared_ptr<WorkflowTask>> tasks;
 
-        /* Set of ready tasks */
-        std::set<std::shared_ptr<WorkflowTask>> ready_tasks;
+        /* Ready tasks (each ready task knows its position in this vector) */
+        std::vector<std::shared_ptr<WorkflowTask>> ready_tasks;
+
+        /* Ready tasks that have a cluster ID, indexed by cluster ID */
+        std::unordered_map<std::string, std::vector<std::shared_ptr<WorkflowTask>>> ready_task_clusters;
+
+        void addReadyTask(WorkflowTask *task);
+        void removeReadyTask(WorkflowTask *task);
+
+        /* Tasks indexed by top-level and by bottom-level (each task knows its position in its buckets) */
+        std::vector<std::vector<WorkflowTask *>> tasks_by_top_level;
+        std::vector<std::vector<WorkflowTask *>> tasks_by_bottom_level;
+
+        void propagateTopLevels(const std::vector<WorkflowTask *> &frontier);
+        void propagateBottomLevels(const std::vector<WorkflowTask *> &frontier);
+        void setTaskTopLevel(WorkflowTask *task, int level);
+        void setTaskBottomLevel(WorkflowTask *task, int level);
+        void rebuildLevelIndex();
+        std::vector<std::shared_ptr<WorkflowTask>> getTasksInLevelRange(const std::vector<std::vector<WorkflowTask *>> &buckets, int min, int max) const;
+        static void addToLevelBucket(std::vector<std::vector<WorkflowTask *>> &buckets, int level,
+                                     WorkflowTask *task, unsigned long WorkflowTask::*position);
+        static void removeFromLevelBucket(std::vector<std::vector<WorkflowTask *>> &buckets, int level,
+                                          WorkflowTask *task, unsigned long WorkflowTask::*position);
 
         /* Map of output files */
         std::map<std::shared_ptr<DataFile>, std::shared_ptr<WorkflowTask>> task_output_files;
@@ -146,6 +187,21 @@ namespace wrench {
 
         /* files used in this workflow */
         std::map<std::string, std::shared_ptr<DataFile>> data_files;
+
+        /* Cached entry/exit tasks (recomputed lazily after the DAG has been modified) */
+        mutable bool entry_exit_tasks_are_valid = false;
+        mutable std::map<std::string, std::shared_ptr<WorkflowTask>> entry_tasks;
+        mutable std::map<std::string, std::shared_ptr<WorkflowTask>> exit_tasks;
+
+        /* Cached input/output files (recomputed lazily after task files have been modified) */
+        mutable bool input_output_files_are_valid = false;
+        mutable std::map<std::string, std::shared_ptr<DataFile>> input_files;
+        mutable std::map<std::string, std::shared_ptr<DataFile>> output_files;
+
+        void invalidateEntryExitTasks();
+        void invalidateInputOutputFiles();
+        void computeEntryExitTasks() const;
+        void computeInputOutputFiles() const;
     };
 }// namespace wrench
 
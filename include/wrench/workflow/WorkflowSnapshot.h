@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_WORKFLOWSNAPSHOT_H
+#define WRENCH_WORKFLOWSNAPSHOT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace wrench {
+
+    class Workflow;
+
+    /**
+     * @brief A class that implements methods to save a workflow to, and load a workflow from, a compact
+     *        binary snapshot file. A snapshot holds an interned string table (task/file IDs, cluster IDs, colors),
+     *        a file table, a task table, and compressed-sparse-row (CSR) arrays for task input files, task output
+     *        files and task dependencies, all 8-byte aligned so that the file can be memory-mapped and read in
+     *        a single pass. Snapshots are meant to avoid re-parsing the same (e.g., WfCommons JSON) workflow
+     *        description over and over.
+     */
+    class WorkflowSnapshot {
+
+    public:
+        /** @brief The version of the snapshot format written by this class */
+        static constexpr uint32_t FORMAT_VERSION = 1;
+
+        /**
+         * @brief Save a workflow to a snapshot file. Task execution states are not saved.
+         *
+         * @param workflow: a workflow
+         * @param file_path: the path of the snapshot file
+         */
+        static void save(const std::shared_ptr<Workflow> &workflow, const std::string &file_path);
+
+        /**
+         * @brief Create a workflow from a snapshot file. Files that do not exist in the simulation
+         *        are created, and files that already exist are re-used.
+         *
+         * @param file_path: the path of the snapshot file
+         * @return a workflow
+         */
+        static std::shared_ptr<Workflow> load(const std::string &file_path);
+    };
+
+}// namespace wrench
+
+#endif//WRENCH_WORKFLOWSNAPSHOT_H
@@ -10,6 +10,7 @@
 #ifndef WRENCH_WORKFLOWTASK_H
 #define WRENCH_WORKFLOWTASK_H
 
+#include <climits>
 #include <map>
 #include <stack>
 #include <set>
@@ -123,6 +124,10 @@ namespace wrench {
 
         int getBottomLevel() const;
 
+        double getFlopWeightedBottomLevel() const;
+
+        double getByteWeightedBottomLevel() const;
+
         double getReadyDate() const;
 
         double getStartDate() const;
@@ -151,6 +156,8 @@ namespace wrench {
 
         std::stack<WorkflowTaskExecution> getExecutionHistory() const;
 
+        unsigned long getNumberOfExecutionAttempts() const;
+
         std::string getExecutionHost() const;
 
         std::string getPhysicalExecutionHost() const;
@@ -189,8 +196,7 @@ namespace wrench {
         unsigned long updateTopLevel();
         unsigned long updateBottomLevel();
 
-        void computeBottomLevel();
-        void computeTopLevel();
+        double getInputBytes() const;
 
     public:
         void setInternalState(WorkflowTask::InternalState);
@@ -289,6 +295,9 @@ namespace wrench {
         unsigned long priority = 0;    // Task priority
         int toplevel;                  // 0 if entry task
         int bottomlevel;               // 0 if exit task
+        double flop_weighted_bottomlevel;// Sum of flops on the heaviest path down to an exit task (this task included)
+        double byte_weighted_bottomlevel;// Sum of input bytes on the heaviest path down to an exit task (this task included)
+        bool in_level_worklist = false;  // Whether the task is in the workflow's level propagation worklist
         unsigned int failure_count = 0;// Number of times the tasks has failed
         std::string execution_host;    // Host on which the task executed ("" if not executed successfully - yet)
         State visible_state;           // To be exposed to developer level
@@ -298,6 +307,11 @@ namespace wrench {
         double ready_date; // The date at which the task's VISIBLE state became READY (-1 if not)
 
         Workflow *workflow;// Containing workflow
+        unsigned long dag_index = ULONG_MAX;// Index of the task's vertex in the containing workflow's DAG
+        unsigned long ready_index = ULONG_MAX;        // Position in the workflow's ready tasks (ULONG_MAX if not ready)
+        unsigned long ready_cluster_index = ULONG_MAX;// Position in the workflow's ready tasks for the task's cluster
+        unsigned long top_level_index = ULONG_MAX;    // Position in the workflow's bucket of tasks with the same top-level
+        unsigned long bottom_level_index = ULONG_MAX; // Position in the workflow's bucket of tasks with the same bottom-level
 
         std::map<std::string, std::shared_ptr<DataFile>> output_files;// List of output files
         std::map<std::string, std::shared_ptr<DataFile>> input_files; // List of input files
@@ -8,6 +8,7 @@
  */
 
 #include <set>
+#include <unordered_set>
 #include <utility>
 #include <wrench-dev.h>
 #include <wrench/workflow/Workflow.h>
@@ -430,6 +431,29 @@ namespace wrench {
         child->updateState();
     }
 
+    /**
+     * @brief Add a dependency between two actions without any checks and without updating
+     *        the child's state (for bulk construction of an action graph that is known to be
+     *        valid, after which updateActionStates() must be called)
+     * @param parent: the parent action
+     * @param child: the child action
+     */
+    void CompoundJob::addTrustedActionDependency(const std::shared_ptr<Action> &parent, const std::shared_ptr<Action> &child) {
+        child->parents.insert(parent.get());
+        parent->children.insert(child.get());
+    }
+
+    /**
+     * @brief Update the states of all actions based on their dependencies
+     */
+    void CompoundJob::updateActionStates() {
+        for (auto const &action: this->actions) {
+            if (not action->parents.empty()) {
+                action->updateState();
+            }
+        }
+    }
+
     /**
      * @brief Add a parent job to this job (be careful not to add circular dependencies, which may lead to deadlocks)
      * @param parent: the parent job
@@ -602,15 +626,22 @@ namespace wrench {
      * @return
      */
     bool CompoundJob::pathExists(const std::shared_ptr<Action> &a, const std::shared_ptr<Action> &b) {
-        auto current_children = a->children;
-        if (current_children.find(b.get()) != current_children.end()) {
-            return true;
-        }
-        bool path_exists = false;
-        for (auto const &c: current_children) {
-            path_exists = path_exists || this->pathExists(c->getSharedPtr(), b);
+        // Depth-first search, visiting each action at most once
+        std::unordered_set<Action *> visited;
+        std::vector<Action *> to_visit = {a.get()};
+        while (not to_visit.empty()) {
+            auto current = to_visit.back();
+            to_visit.pop_back();
+            for (auto const &c: current->children) {
+                if (c == b.get()) {
+                    return true;
+                }
+                if (visited.insert(c).second) {
+                    to_visit.push_back(c);
+                }
+            }
         }
-        return path_exists;
+        return false;
     }
 
     /**
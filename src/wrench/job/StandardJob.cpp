@@ -179,6 +179,25 @@ namespace wrench {
         this->post_overhead = overhead;
     }
 
+    /**
+    * @brief get whether the job's underlying compound job uses barrier actions
+    * @return true or false
+    */
+    bool StandardJob::getUseBarrierActions() const {
+        return this->use_barrier_actions;
+    }
+
+    /**
+    * @brief sets whether the job's underlying compound job should use (zero-duration) barrier actions
+    *        between large groups of dependent actions (e.g., all the file writes of some tasks and all the
+    *        file reads of their children), so that the number of action dependencies is linear rather
+    *        than quadratic in the number of actions
+    * @param use_barrier_actions: true or false
+    */
+    void StandardJob::setUseBarrierActions(bool use_barrier_actions) {
+        this->use_barrier_actions = use_barrier_actions;
+    }
+
     /**
      * @brief Instantiate a compound job
      */
@@ -260,7 +279,7 @@ namespace wrench {
                     fread_action = cjob->addFileReadAction("", FileLocation::SCRATCH(f));
                 }
                 task_file_read_actions[task].push_back(fread_action);
-                cjob->addActionDependency(fread_action, compute_action);
+                cjob->addTrustedActionDependency(fread_action, compute_action);
             }
             task_file_write_actions[task] = {};
             for (auto const &f: task->getOutputFiles()) {
@@ -279,7 +298,7 @@ namespace wrench {
                     fwrite_action = cjob->addFileWriteAction("", FileLocation::SCRATCH(f));
                 }
                 task_file_write_actions[task].push_back(fwrite_action);
-                cjob->addActionDependency(compute_action, fwrite_action);
+                cjob->addTrustedActionDependency(compute_action, fwrite_action);
             }
         }
 
@@ -330,108 +349,96 @@ namespace wrench {
         scratch_cleanup = cjob->addCustomAction("", 0, 0, lambda_execute, lambda_terminate);
 
 
-        // Add all inter-task dependencies
-        for (auto const &parent_task: this->tasks) {
-            for (auto const &child_task: parent_task->getChildren()) {
-                if (task_compute_actions.find(child_task) == task_compute_actions.end()) {
-                    continue;
-                }
-                std::vector<std::shared_ptr<Action>> parent_actions;
-                if (not task_file_write_actions[parent_task].empty()) {
-                    parent_actions = task_file_write_actions[parent_task];
-                } else {
-                    parent_actions = {task_compute_actions[parent_task]};
+        // The action graph is acyclic by construction, so all dependencies are added without checks.
+        // Helper to make each parent action a parent of each child action, going through a barrier action
+        // instead if requested and if that means fewer dependencies
+        auto add_dependencies = [this, &cjob](const std::vector<std::shared_ptr<Action>> &parent_actions,
+                                              const std::vector<std::shared_ptr<Action>> &child_actions) {
+            if (this->use_barrier_actions and
+                (parent_actions.size() * child_actions.size() > parent_actions.size() + child_actions.size())) {
+                auto barrier = cjob->addSleepAction("", 0);
+                for (auto const &parent_action: parent_actions) {
+                    cjob->addTrustedActionDependency(parent_action, barrier);
                 }
-                std::vector<std::shared_ptr<Action>> child_actions;
-                if (not task_file_read_actions[child_task].empty()) {
-                    child_actions = task_file_read_actions[child_task];
-                } else {
-                    child_actions = {task_compute_actions[child_task]};
+                for (auto const &child_action: child_actions) {
+                    cjob->addTrustedActionDependency(barrier, child_action);
                 }
+            } else {
                 for (auto const &parent_action: parent_actions) {
                     for (auto const &child_action: child_actions) {
-                        cjob->addActionDependency(parent_action, child_action);
+                        cjob->addTrustedActionDependency(parent_action, child_action);
                     }
                 }
             }
-        }
+        };
 
-        // Create dummy tasks
-        std::shared_ptr<Action> pre_overhead_to_pre_file_copies = cjob->addSleepAction("", 0);
-        std::shared_ptr<Action> pre_file_copies_to_tasks = cjob->addSleepAction("", 0);
-        std::shared_ptr<Action> tasks_to_post_file_copies = cjob->addSleepAction("", 0);
-        std::shared_ptr<Action> tasks_post_file_copies_to_cleanup = cjob->addSleepAction("", 0);
-        std::shared_ptr<Action> cleanup_to_post_overhead = cjob->addSleepAction("", 0);
-        cjob->addActionDependency(pre_overhead_to_pre_file_copies, pre_file_copies_to_tasks);
-        cjob->addActionDependency(pre_file_copies_to_tasks, tasks_to_post_file_copies);
-        cjob->addActionDependency(tasks_to_post_file_copies, tasks_post_file_copies_to_cleanup);
-        cjob->addActionDependency(tasks_post_file_copies_to_cleanup, cleanup_to_post_overhead);
-
-        // Add all dependencies, using the dummy tasks to help
-        if (pre_overhead_action != nullptr) {
-            cjob->addActionDependency(pre_overhead_action, pre_overhead_to_pre_file_copies);
-        }
-        if (not pre_file_copy_actions.empty()) {
-            for (auto const &pfca: pre_file_copy_actions) {
-                cjob->addActionDependency(pre_overhead_to_pre_file_copies, pfca);
-                cjob->addActionDependency(pfca, pre_file_copies_to_tasks);
+        // Determine the first (file reads, or compute) and last (file writes, or compute) actions of each task
+        std::map<std::shared_ptr<WorkflowTask>, std::vector<std::shared_ptr<Action>>> task_first_actions;
+        std::map<std::shared_ptr<WorkflowTask>, std::vector<std::shared_ptr<Action>>> task_last_actions;
+        std::vector<std::shared_ptr<Action>> all_task_first_actions;
+        std::vector<std::shared_ptr<Action>> all_task_last_actions;
+        for (auto const &tca: task_compute_actions) {
+            auto task = tca.first;
+            auto &first_actions = task_first_actions[task];
+            first_actions = task_file_read_actions[task];
+            if (first_actions.empty()) {
+                first_actions = {tca.second};
             }
+            auto &last_actions = task_last_actions[task];
+            last_actions = task_file_write_actions[task];
+            if (last_actions.empty()) {
+                last_actions = {tca.second};
+            }
+            all_task_first_actions.insert(all_task_first_actions.end(), first_actions.begin(), first_actions.end());
+            all_task_last_actions.insert(all_task_last_actions.end(), last_actions.begin(), last_actions.end());
         }
 
-        if (not task_compute_actions.empty()) {
-            for (auto const &tca: task_compute_actions) {
-                auto task = tca.first;
-                if (not task_file_read_actions[task].empty()) {
-                    for (auto const &tfra: task_file_read_actions[task]) {
-                        cjob->addActionDependency(pre_file_copies_to_tasks, tfra);
-                    }
-                } else {
-                    cjob->addActionDependency(pre_file_copies_to_tasks, tca.second);
-                }
-                if (not task_file_write_actions[task].empty()) {
-                    for (auto const &tfwa: task_file_write_actions[task]) {
-                        cjob->addActionDependency(tfwa, tasks_to_post_file_copies);
-                    }
-                } else {
-                    cjob->addActionDependency(tca.second, tasks_to_post_file_copies);
+        // Add all inter-task dependencies (the last actions of a task are parents of the first actions of all its children)
+        for (auto const &parent_task: this->tasks) {
+            std::vector<std::shared_ptr<Action>> child_actions;
+            for (auto const &child_task: parent_task->getChildren()) {
+                auto it = task_first_actions.find(child_task);
+                if (it == task_first_actions.end()) {
+                    continue;
                 }
+                child_actions.insert(child_actions.end(), it->second.begin(), it->second.end());
             }
-        }
-
-        if (not post_file_copy_actions.empty()) {
-            for (auto const &pfca: post_file_copy_actions) {
-                cjob->addActionDependency(tasks_to_post_file_copies, pfca);
-                cjob->addActionDependency(pfca, tasks_post_file_copies_to_cleanup);
+            if (not child_actions.empty()) {
+                add_dependencies(task_last_actions[parent_task], child_actions);
             }
         }
 
-        if (not cleanup_actions.empty()) {
-            for (auto const &ca: cleanup_actions) {
-                cjob->addActionDependency(tasks_post_file_copies_to_cleanup, ca);
-                cjob->addActionDependency(ca, cleanup_to_post_overhead);
-            }
+        // Add all dependencies between the job's successive phases (pre-overhead, pre file copies, tasks,
+        // post file copies, cleanup, post-overhead, scratch cleanup), skipping empty phases: the last
+        // actions of a phase are parents of the first actions of the next phase. (This is equivalent
+        // to making all actions of a phase parents of all actions of all subsequent phases, but
+        // with fewer dependencies.)
+        std::vector<std::pair<std::vector<std::shared_ptr<Action>>, std::vector<std::shared_ptr<Action>>>> phases;
+        if (pre_overhead_action != nullptr) {
+            phases.emplace_back(std::vector<std::shared_ptr<Action>>{pre_overhead_action}, std::vector<std::shared_ptr<Action>>{pre_overhead_action});
         }
-
+        phases.emplace_back(pre_file_copy_actions, pre_file_copy_actions);
+        phases.emplace_back(std::move(all_task_first_actions), std::move(all_task_last_actions));
+        phases.emplace_back(post_file_copy_actions, post_file_copy_actions);
+        phases.emplace_back(cleanup_actions, cleanup_actions);
         if (post_overhead_action != nullptr) {
-            cjob->addActionDependency(cleanup_to_post_overhead, post_overhead_action);
-            cjob->addActionDependency(post_overhead_action, scratch_cleanup);
-        } else {
-            cjob->addActionDependency(cleanup_to_post_overhead, scratch_cleanup);
+            phases.emplace_back(std::vector<std::shared_ptr<Action>>{post_overhead_action}, std::vector<std::shared_ptr<Action>>{post_overhead_action});
         }
+        phases.emplace_back(std::vector<std::shared_ptr<Action>>{scratch_cleanup}, std::vector<std::shared_ptr<Action>>{scratch_cleanup});
 
-        // Use the dummy tasks for "easy" dependencies and remove the dummies
-        std::vector<std::shared_ptr<Action>> dummies = {pre_overhead_to_pre_file_copies, pre_file_copies_to_tasks, tasks_to_post_file_copies, tasks_post_file_copies_to_cleanup, cleanup_to_post_overhead};
-        for (auto &dummy: dummies) {
-            // propagate dependencies
-            for (auto const &parent_action: dummy->getParents()) {
-                for (auto const &child_action: dummy->getChildren()) {
-                    cjob->addActionDependency(parent_action, child_action);
-                }
+        const std::vector<std::shared_ptr<Action>> *previous_phase_last_actions = nullptr;
+        for (auto const &phase: phases) {
+            if (phase.first.empty()) {
+                continue;
+            }
+            if (previous_phase_last_actions) {
+                add_dependencies(*previous_phase_last_actions, phase.first);
             }
-            // remove the dummy
-            cjob->removeAction(dummy);
+            previous_phase_last_actions = &phase.second;
         }
 
+        cjob->updateActionStates();
+
         //            cjob->printActionDependencies();
         this->compound_job = std::move(cjob);
     }
@@ -595,15 +602,17 @@ namespace wrench {
                     case Action::STARTED:
                         simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
                         break;
-                    case Action::COMPLETED:
-                        simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
-                        simulation->getOutput().addTimestampFileReadCompletion(fra->getEndDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
+                    case Action::COMPLETED: {
+                        auto read_start = simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
+                        simulation->getOutput().addTimestampFileReadCompletion(fra->getEndDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t, read_start);
                         break;
+                    }
                     case Action::KILLED:
-                    case Action::FAILED:
-                        simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
-                        simulation->getOutput().addTimestampFileReadFailure(fra->getEndDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
+                    case Action::FAILED: {
+                        auto read_start = simulation->getOutput().addTimestampFileReadStart(fra->getStartDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t);
+                        simulation->getOutput().addTimestampFileReadFailure(fra->getEndDate(), fra_file, fra->getUsedFileLocation(), fra->getUsedFileLocation()->getStorageService(), t, read_start);
                         break;
+                    }
                 }
             }
 
@@ -625,15 +634,15 @@ namespace wrench {
                 t->setReadInputStartDate(earliest_start_date);
                 failure_count_increments.insert(t);
                 state_changes[t] = WorkflowTask::State::READY;// This may be changed to NOT_READY later based on other tasks
-                simulation->getOutput().addTimestampTaskStart(earliest_start_date, t);
+                auto task_start = simulation->getOutput().addTimestampTaskStart(earliest_start_date, t);
                 if (at_least_one_killed) {
                     job_failure_cause = std::make_shared<JobKilled>();
                     t->setTerminationDate(earliest_failure_date);
-                    simulation->getOutput().addTimestampTaskTermination(earliest_failure_date, t);
+                    simulation->getOutput().addTimestampTaskTermination(earliest_failure_date, t, task_start);
                 } else if (at_least_one_failed) {
                     if (job_failure_cause == nullptr) job_failure_cause = failure_cause;
 
-                    simulation->getOutput().addTimestampTaskFailure(earliest_failure_date, t);
+                    simulation->getOutput().addTimestampTaskFailure(earliest_failure_date, t, task_start);
                 }
                 continue;
             }
@@ -649,7 +658,7 @@ namespace wrench {
             auto compute_action = this->task_compute_actions[t];
             t->setComputationStartDate(compute_action->getStartDate());
 
-            simulation->getOutput().addTimestampTaskStart(compute_action->getStartDate(), t);
+            auto task_start = simulation->getOutput().addTimestampTaskStart(compute_action->getStartDate(), t);
 
             t->setNumCoresAllocated(compute_action->getExecutionHistory().top().num_cores_allocated);
             if (t->getStartDate() == -1.0) {
@@ -660,9 +669,9 @@ namespace wrench {
                 if (not job_failure_cause) job_failure_cause = compute_action->getFailureCause();
                 if (compute_action->getState() == Action::State::KILLED) {
                     t->setTerminationDate(compute_action->getEndDate());
-                    simulation->getOutput().addTimestampTaskTermination(compute_action->getEndDate(), t);
+                    simulation->getOutput().addTimestampTaskTermination(compute_action->getEndDate(), t, task_start);
                 } else {
-                    simulation->getOutput().addTimestampTaskFailure(compute_action->getEndDate(), t);
+                    simulation->getOutput().addTimestampTaskFailure(compute_action->getEndDate(), t, task_start);
                     t->setFailureDate(compute_action->getEndDate());
                 }
                 failure_count_increments.insert(t);
@@ -687,15 +696,17 @@ namespace wrench {
                     case Action::STARTED:
                         simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
                         break;
-                    case Action::COMPLETED:
-                        simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
-                        simulation->getOutput().addTimestampFileWriteCompletion(fwa->getEndDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
+                    case Action::COMPLETED: {
+                        auto write_start = simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
+                        simulation->getOutput().addTimestampFileWriteCompletion(fwa->getEndDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t, write_start);
                         break;
+                    }
                     case Action::KILLED:
-                    case Action::FAILED:
-                        simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
-                        simulation->getOutput().addTimestampFileWriteFailure(fwa->getEndDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
+                    case Action::FAILED: {
+                        auto write_start = simulation->getOutput().addTimestampFileWriteStart(fwa->getStartDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t);
+                        simulation->getOutput().addTimestampFileWriteFailure(fwa->getEndDate(), fwa_file, fwa->getFileLocation(), fwa->getFileLocation()->getStorageService(), t, write_start);
                         break;
+                    }
                 }
             }
 
@@ -715,10 +726,10 @@ namespace wrench {
                     job_failure_cause = std::make_shared<JobKilled>();
                     failure_count_increments.insert(t);
                     t->setFailureDate(earliest_failure_date);
-                    simulation->getOutput().addTimestampTaskTermination(earliest_failure_date, t);
+                    simulation->getOutput().addTimestampTaskTermination(earliest_failure_date, t, task_start);
                 } else if (at_least_one_failed) {
                     t->setFailureDate(earliest_failure_date);
-                    simulation->getOutput().addTimestampTaskFailure(earliest_failure_date, t);
+                    simulation->getOutput().addTimestampTaskFailure(earliest_failure_date, t, task_start);
                     failure_count_increments.insert(t);
                     if (job_failure_cause == nullptr) job_failure_cause = failure_cause;
                 }
@@ -732,7 +743,7 @@ namespace wrench {
             t->setWriteOutputEndDate(latest_end_date);
             state_changes[t] = WorkflowTask::State::COMPLETED;
             t->setEndDate(latest_end_date);
-            simulation->getOutput().addTimestampTaskCompletion(latest_end_date, t);
+            simulation->getOutput().addTimestampTaskCompletion(latest_end_date, t, task_start);
         }
 
         /*
@@ -813,6 +824,14 @@ namespace wrench {
         }
     }
 
+    /**
+     * @brief Get the compound job that implements this job (nullptr if the job has not been submitted)
+     * @return a compound job
+     */
+    std::shared_ptr<CompoundJob> StandardJob::getCompoundJob() {
+        return this->compound_job;
+    }
+
     /**
  * @brief Determines whether the job's spec uses scratch space
  * @return
@@ -60,6 +60,25 @@ namespace wrench {
         } else {
             this->property_list.insert(std::make_pair(property, value));
         }
+        if ((property > 0) and ((size_t) property < this->property_cache.size())) {
+            this->property_cache[property].valid = 0;
+        }
+    }
+
+    /**
+     * @brief Get the cache entry for a property, so that property values are converted
+     *        from strings only once per type (rather than at each lookup)
+     * @param property: the property
+     * @return a cache entry, or nullptr if the property is invalid
+     */
+    Service::PropertyCacheEntry *Service::getPropertyCacheEntry(WRENCH_PROPERTY_TYPE property) const {
+        if ((property <= 0) or (property > WRENCH_PROPERTY_COUNT)) {
+            return nullptr;
+        }
+        if ((size_t) property >= this->property_cache.size()) {
+            this->property_cache.resize(WRENCH_PROPERTY_COUNT + 1);
+        }
+        return &this->property_cache[property];
     }
 
 
@@ -94,21 +113,29 @@ namespace wrench {
      *
      */
     double Service::getPropertyValueAsDouble(WRENCH_PROPERTY_TYPE property) const {
+        auto cache_entry = this->getPropertyCacheEntry(property);
+        if (cache_entry and (cache_entry->valid & PROPERTY_CACHE_DOUBLE)) {
+            return cache_entry->as_double;
+        }
+
         double value;
         std::string string_value;
         string_value = this->getPropertyValueAsString(property);
 
         if (string_value == "infinity") {
-            return DBL_MAX;
-        }
-        if (string_value == "zero") {
-            return 0;
-        }
-        if (sscanf(string_value.c_str(), "%lf", &value) != 1) {
+            value = DBL_MAX;
+        } else if (string_value == "zero") {
+            value = 0;
+        } else if (sscanf(string_value.c_str(), "%lf", &value) != 1) {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsDouble(): Invalid double property value " + ServiceProperty::translatePropertyType(property) + " " +
                     this->getPropertyValueAsString(property));
         }
+
+        if (cache_entry) {
+            cache_entry->as_double = value;
+            cache_entry->valid |= PROPERTY_CACHE_DOUBLE;
+        }
         return value;
     }
 
@@ -138,7 +165,18 @@ namespace wrench {
      * @return the time in second
      */
     double Service::getPropertyValueAsTimeInSecond(WRENCH_PROPERTY_TYPE property) const {
-        return this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_time);
+        auto cache_entry = this->getPropertyCacheEntry(property);
+        if (cache_entry and (cache_entry->valid & PROPERTY_CACHE_TIME)) {
+            return cache_entry->as_time;
+        }
+
+        double value = this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_time);
+
+        if (cache_entry) {
+            cache_entry->as_time = value;
+            cache_entry->valid |= PROPERTY_CACHE_TIME;
+        }
+        return value;
     }
 
     /**
@@ -147,17 +185,26 @@ namespace wrench {
      * @return the size in byte
      */
     sg_size_t Service::getPropertyValueAsSizeInByte(WRENCH_PROPERTY_TYPE property) const {
+        auto cache_entry = this->getPropertyCacheEntry(property);
+        if (cache_entry and (cache_entry->valid & PROPERTY_CACHE_SIZE)) {
+            return cache_entry->as_size;
+        }
+
         sg_size_t value;
         std::string string_value;
         string_value = this->getPropertyValueAsString(property);
         if (string_value == "infinity") {
-            return LLONG_MAX;
-        }
-        if (string_value == "zero") {
-            return 0;
+            value = LLONG_MAX;
+        } else if (string_value == "zero") {
+            value = 0;
+        } else {
+            value = static_cast<sg_size_t>(this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_size));
         }
-        value = static_cast<sg_size_t>(this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_size));
 
+        if (cache_entry) {
+            cache_entry->as_size = value;
+            cache_entry->valid |= PROPERTY_CACHE_SIZE;
+        }
         return value;
     }
 
@@ -167,7 +214,18 @@ namespace wrench {
      * @return the bandwidth in byte/sec
      */
     double Service::getPropertyValueAsBandwidthInBytePerSecond(WRENCH_PROPERTY_TYPE property) const {
-        return this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_bandwidth);
+        auto cache_entry = this->getPropertyCacheEntry(property);
+        if (cache_entry and (cache_entry->valid & PROPERTY_CACHE_BANDWIDTH)) {
+            return cache_entry->as_bandwidth;
+        }
+
+        double value = this->getPropertyValueWithUnitsAsValue(property, UnitParser::parse_bandwidth);
+
+        if (cache_entry) {
+            cache_entry->as_bandwidth = value;
+            cache_entry->valid |= PROPERTY_CACHE_BANDWIDTH;
+        }
+        return value;
     }
 
     /**
@@ -177,21 +235,29 @@ namespace wrench {
     *
     */
     unsigned long Service::getPropertyValueAsUnsignedLong(WRENCH_PROPERTY_TYPE property) const {
+        auto cache_entry = this->getPropertyCacheEntry(property);
+        if (cache_entry and (cache_entry->valid & PROPERTY_CACHE_UNSIGNED_LONG)) {
+            return cache_entry->as_unsigned_long;
+        }
+
         unsigned long value;
         std::string string_value;
         string_value = this->getPropertyValueAsString(property);
         if (string_value == "infinity") {
-            return ULONG_MAX;
-        }
-        if (string_value == "zero") {
-            return 0;
-        }
-        if (sscanf(string_value.c_str(), "%lu", &value) != 1) {
+            value = ULONG_MAX;
+        } else if (string_value == "zero") {
+            value = 0;
+        } else if (sscanf(string_value.c_str(), "%lu", &value) != 1) {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsUnsignedLong(): Invalid unsigned long property value " + ServiceProperty::translatePropertyType(property) +
                     " " +
                     this->getPropertyValueAsString(property));
         }
+
+        if (cache_entry) {
+            cache_entry->as_unsigned_long = value;
+            cache_entry->valid |= PROPERTY_CACHE_UNSIGNED_LONG;
+        }
         return value;
     }
 
@@ -239,17 +305,29 @@ namespace wrench {
      *
      */
     bool Service::getPropertyValueAsBoolean(WRENCH_PROPERTY_TYPE property) const {
+        auto cache_entry = this->getPropertyCacheEntry(property);
+        if (cache_entry and (cache_entry->valid & PROPERTY_CACHE_BOOLEAN)) {
+            return cache_entry->as_boolean;
+        }
+
+        bool value;
         std::string string_value;
         string_value = this->getPropertyValueAsString(property);
         if (string_value == "true" or string_value == "True") {
-            return true;
+            value = true;
         } else if (string_value == "false" or string_value == "False") {
-            return false;
+            value = false;
         } else {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsBoolean(): Invalid boolean property value " + ServiceProperty::translatePropertyType(property) + " " +
                     this->getPropertyValueAsString(property));
         }
+
+        if (cache_entry) {
+            cache_entry->as_boolean = value;
+            cache_entry->valid |= PROPERTY_CACHE_BOOLEAN;
+        }
+        return value;
     }
 
     /**
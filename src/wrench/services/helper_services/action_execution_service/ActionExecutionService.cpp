@@ -9,6 +9,8 @@
 
 #include <typeinfo>
 #include <map>
+#include <algorithm>
+#include <unordered_set>
 #include <wrench/util/PointerUtil.h>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
@@ -49,6 +51,13 @@ namespace wrench {
 
         //        this->release_held_mutexes();
 
+        // Unregister the host state callbacks
+        if (this->host_state_call_backs_connected) {
+            simgrid::s4u::Host::on_onoff.disconnect(this->on_state_change_call_back_id);
+            simgrid::s4u::Host::on_speed_change.disconnect(this->on_speed_change_call_back_id);
+            this->host_state_call_backs_connected = false;
+        }
+
         // Clean up state in case of a restart
         if (this->isSetToAutoRestart()) {
             for (const auto &host: this->compute_resources) {
@@ -60,7 +69,12 @@ namespace wrench {
 
         this->all_actions.clear();
         this->ready_actions.clear();
+        this->ready_action_requirements.clear();
         this->action_executors.clear();
+        this->killIdleActionExecutors();
+        this->host_availability_index.clear();
+        this->host_availability_index_entries.clear();
+        this->hosts_with_changed_state.clear();
     }
 
     /**
@@ -280,6 +294,26 @@ namespace wrench {
                    " GB of RAM\n";
         }
 
+        // Index the hosts, and keep track of hosts that turn on/off or change speed so that they can be re-indexed
+        this->on_state_change_call_back_id = simgrid::s4u::Host::on_onoff.connect(
+                [this](simgrid::s4u::Host const &h) {
+                    auto host = const_cast<simgrid::s4u::Host *>(&h);
+                    if (this->compute_resources.find(host) != this->compute_resources.end()) {
+                        this->hosts_with_changed_state.insert(host);
+                    }
+                });
+        this->on_speed_change_call_back_id = simgrid::s4u::Host::on_speed_change.connect(
+                [this](simgrid::s4u::Host const &h) {
+                    auto host = const_cast<simgrid::s4u::Host *>(&h);
+                    if (this->compute_resources.find(host) != this->compute_resources.end()) {
+                        this->hosts_with_changed_state.insert(host);
+                    }
+                });
+        this->host_state_call_backs_connected = true;
+        for (auto const &h: this->compute_resources) {
+            this->indexHost(h.first);
+        }
+
         // Create and start the host state monitor if necessary
         if (Simulation::isEnergySimulationEnabled() or Simulation::isHostShutdownSimulationEnabled()) {
             // Create the host state monitor
@@ -311,6 +345,44 @@ namespace wrench {
         return this->exit_code;
     }
 
+    /**
+     * @brief Add/update/remove a host in the host availability index based on its current state
+     *        and running thread count
+     *
+     * @param host: the host
+     */
+    void ActionExecutionService::indexHost(simgrid::s4u::Host *host) {
+        auto entry = this->host_availability_index_entries.find(host);
+        if (entry != this->host_availability_index_entries.end()) {
+            auto group = this->host_availability_index.find(entry->second.first);
+            group->second.erase(std::make_pair(entry->second.second, host));
+            if (group->second.empty()) {
+                this->host_availability_index.erase(group);
+            }
+            this->host_availability_index_entries.erase(entry);
+        }
+
+        // Hosts that are down or have compute speed zero are not indexed
+        if ((not host->is_on()) or (host->get_speed() <= 0.0)) {
+            return;
+        }
+
+        HostGroup group = std::make_pair(std::get<0>(this->compute_resources[host]), host->get_speed());
+        unsigned long num_running_threads = this->running_thread_counts[host];
+        this->host_availability_index[group].insert(std::make_pair(num_running_threads, host));
+        this->host_availability_index_entries[host] = std::make_pair(group, num_running_threads);
+    }
+
+    /**
+     * @brief Re-index the hosts that have turned on/off or changed speed
+     */
+    void ActionExecutionService::updateHostAvailabilityIndex() {
+        for (auto const &host: this->hosts_with_changed_state) {
+            this->indexHost(host);
+        }
+        this->hosts_with_changed_state.clear();
+    }
+
     /**
      * @brief helper function to figure out where/how an action should run
      *
@@ -326,75 +398,45 @@ namespace wrench {
             const unsigned long required_num_cores,
             std::set<simgrid::s4u::Host *> &hosts_to_avoid) {
 
-        // Compute possible hosts
-        std::set<simgrid::s4u::Host *> possible_hosts;
-        simgrid::s4u::Host *new_host_to_avoid = nullptr;
-        sg_size_t new_host_to_avoid_ram_capacity = 0;
-        for (auto const &r: this->compute_resources) {
+        this->updateHostAvailabilityIndex();
 
-            // If there is a required host, then don't even look at others
-            if (required_host != nullptr and (r.first != required_host)) {
-                continue;
-            }
+        unsigned long min_num_cores = (required_num_cores == 0) ? action->getMinNumCores() : required_num_cores;
+        sg_size_t min_ram = action->getMinRAMFootprint();
 
-            // If the host is down, then don't look at it
-            if (not r.first->is_on()) {
-                continue;
-            }
+        simgrid::s4u::Host *new_host_to_avoid = nullptr;
+        sg_size_t new_host_to_avoid_ram_capacity = 0;
 
-            // If the host has compute speed zero, then don't look at it
-            if (r.first->get_speed() <= 0.0) {
-                continue;
-            }
+        // Determine whether a host has enough available cores (as running thread counts can exceed core
+        // counts, available core counts can wrap around, in which case the host is considered available)
+        auto has_enough_cores = [this, min_num_cores](simgrid::s4u::Host *h, unsigned long num_cores) {
+            unsigned long available_cores = num_cores - this->running_thread_counts[h];
+            return available_cores >= min_num_cores;
+        };
 
-            unsigned long available_cores = std::get<0>(r.second) - this->running_thread_counts[r.first];
-            if (required_num_cores == 0) {
-                if (available_cores < action->getMinNumCores()) {
-                    continue;
-                }
-            }
-            if (required_num_cores != 0) {
-                if (available_cores < required_num_cores) {
-                    continue;
-                }
-            }
-            if ((action->getMinRAMFootprint() > 0) and (hosts_to_avoid.find(r.first) != hosts_to_avoid.end())) {
-                continue;
+        // Determine whether a host with enough available cores is a possible host
+        auto is_possible = [&](simgrid::s4u::Host *h) {
+            if ((min_ram > 0) and (hosts_to_avoid.find(h) != hosts_to_avoid.end())) {
+                return false;
             }
-            if (this->ram_availabilities[r.first] < action->getMinRAMFootprint()) {
-                if (new_host_to_avoid == nullptr) {
-                    new_host_to_avoid = r.first;
-                    new_host_to_avoid_ram_capacity = this->ram_availabilities[r.first];
-                } else {
-                    if (this->ram_availabilities[r.first] > new_host_to_avoid_ram_capacity) {
-                        // Make sure we "Avoid" the host with the most RAM (as it might become usable sooner)
-                        new_host_to_avoid = r.first;
-                        new_host_to_avoid_ram_capacity = this->ram_availabilities[r.first];
-                    }
+            sg_size_t available_ram = this->ram_availabilities[h];
+            if (available_ram < min_ram) {
+                // Make sure we "Avoid" the host with the most RAM (as it might become usable sooner)
+                if ((new_host_to_avoid == nullptr) or (available_ram > new_host_to_avoid_ram_capacity) or
+                    ((available_ram == new_host_to_avoid_ram_capacity) and std::less<simgrid::s4u::Host *>()(h, new_host_to_avoid))) {
+                    new_host_to_avoid = h;
+                    new_host_to_avoid_ram_capacity = available_ram;
                 }
-                continue;
-            }
-
-            possible_hosts.insert(r.first);
-        }
-
-        // If none, then reply with an empty tuple
-        if (possible_hosts.empty()) {
-            // Host to avoid is the one with the lowest ram availability
-            if (new_host_to_avoid != nullptr) {
-                hosts_to_avoid.insert(new_host_to_avoid);
+                return false;
             }
-            return std::make_tuple(nullptr, 0);
-        }
+            return true;
+        };
 
-        // Select the "best" host
+        // Select the "best" possible host (the first one in host order in case of a tie)
         double lowest_load = DBL_MAX;
         simgrid::s4u::Host *picked_host = nullptr;
         unsigned long picked_num_cores = 0;
-        for (auto const &h: possible_hosts) {
+        auto consider = [&](simgrid::s4u::Host *h, unsigned long num_cores, double flop_rate) {
             unsigned long num_running_threads = this->running_thread_counts[h];
-            unsigned long num_cores = std::get<0>(this->compute_resources[h]);
-            double flop_rate = h->get_speed();
             unsigned long used_num_cores;
             if (required_num_cores == 0) {
                 used_num_cores = std::min(num_cores, action->getMaxNumCores());// as many cores as possible
@@ -403,17 +445,97 @@ namespace wrench {
             }
             // A totally heuristic load estimate
             const double load = ((static_cast<double>(num_running_threads + used_num_cores) / static_cast<double>(num_cores))) /
-                          (flop_rate / (1000.0 * 1000.0 * 1000.0));
-            if (load < lowest_load) {
+                                (flop_rate / (1000.0 * 1000.0 * 1000.0));
+            if ((load < lowest_load) or
+                ((load == lowest_load) and std::less<simgrid::s4u::Host *>()(h, picked_host))) {
                 lowest_load = load;
                 picked_host = h;
                 picked_num_cores = used_num_cores;
             }
+        };
+
+        if (required_host != nullptr) {
+            // If there is a required host, then don't even look at others
+            auto entry = this->host_availability_index_entries.find(const_cast<simgrid::s4u::Host *>(required_host));
+            if (entry != this->host_availability_index_entries.end()) {
+                auto h = entry->first;
+                auto num_cores = entry->second.first.first;
+                if (has_enough_cores(h, num_cores) and is_possible(h)) {
+                    consider(h, num_cores, entry->second.first.second);
+                }
+            }
+        } else {
+            // Within a group, the first possible host has the lowest load
+            for (auto const &group: this->host_availability_index) {
+                auto num_cores = group.first.first;
+                auto const &hosts = group.second;
+                auto it = hosts.begin();
+                while (it != hosts.end()) {
+                    auto h = it->second;
+                    if (not has_enough_cores(h, num_cores)) {
+                        if (it->first <= num_cores) {
+                            // Hosts with more running threads (but no more than the number of cores) won't have enough cores either
+                            it = hosts.lower_bound(std::make_pair(num_cores + 1, static_cast<simgrid::s4u::Host *>(nullptr)));
+                        } else {
+                            ++it;
+                        }
+                        continue;
+                    }
+                    if (is_possible(h)) {
+                        consider(h, num_cores, group.first.second);
+                        break;
+                    }
+                    ++it;
+                }
+            }
+        }
+
+        // If none, then reply with an empty tuple
+        if (picked_host == nullptr) {
+            // Host to avoid is the one with the lowest ram availability
+            if (new_host_to_avoid != nullptr) {
+                hosts_to_avoid.insert(new_host_to_avoid);
+            }
+            return std::make_tuple(nullptr, 0);
         }
 
         return std::make_tuple(picked_host, picked_num_cores);
     }
 
+    /**
+     * @brief Get the requirements of an action, i.e., everything that pickAllocation() looks at
+     *        to determine whether/where the action can run
+     * @param action: the action
+     * @return the action's requirements
+     */
+    ActionExecutionService::ActionRequirements ActionExecutionService::getActionRequirements(const std::shared_ptr<Action> &action) {
+        auto const &run_spec = this->action_run_specs[action];
+        return std::make_tuple(action->getMinNumCores(), action->getMaxNumCores(), action->getMinRAMFootprint(),
+                               std::get<0>(run_spec), std::get<1>(run_spec));
+    }
+
+    /**
+     * @brief Add an action at the end of the ready queue
+     * @param action: the action
+     */
+    void ActionExecutionService::addReadyAction(const std::shared_ptr<Action> &action) {
+        this->ready_actions.push_back(action);
+        this->ready_action_requirements[this->getActionRequirements(action)]++;
+    }
+
+    /**
+     * @brief Account for the removal of an action from the ready queue
+     * @param action: the action
+     */
+    void ActionExecutionService::forgetReadyActionRequirements(const std::shared_ptr<Action> &action) {
+        auto it = this->ready_action_requirements.find(this->getActionRequirements(action));
+        if (it != this->ready_action_requirements.end()) {
+            if (--(it->second) == 0) {
+                this->ready_action_requirements.erase(it);
+            }
+        }
+    }
+
     /**
      * @brief: Dispatch ready work units
      */
@@ -423,26 +545,53 @@ namespace wrench {
             return;
         }
 
+        // If no host can run anything, then don't even look at the actions
+        this->updateHostAvailabilityIndex();
+        if (this->host_availability_index.empty()) {
+            this->num_actions_skipped_for_dispatch += this->ready_actions.size();
+            return;
+        }
+
         // Don't kill me while I am doing this
         this->acquireDaemonLock();
 
-        std::set<std::shared_ptr<Action>> dispatched_actions;
+        std::unordered_set<std::shared_ptr<Action>> dispatched_actions;
 
         // Due to a previously considered actions not being
         // able to run on that host due to RAM, and because we don't
         // allow non-zero-ram tasks to jump ahead of other tasks
         std::set<simgrid::s4u::Host *> no_longer_considered_hosts;
 
-        for (auto const &action: this->ready_actions) {
+        // Requirements for which no allocation was found since the last dispatch, which
+        // are thus shared by all actions with the same requirements
+        std::set<ActionRequirements> unsatisfiable_requirements;
+
+        for (auto it = this->ready_actions.begin(); it != this->ready_actions.end(); ++it) {
+            auto const &action = *it;
+
+            // If no ready action can run, then we're done
+            if (unsatisfiable_requirements.size() == this->ready_action_requirements.size()) {
+                this->num_actions_skipped_for_dispatch += std::distance(it, this->ready_actions.end());
+                break;
+            }
+
+            auto requirements = this->getActionRequirements(action);
+            if (unsatisfiable_requirements.find(requirements) != unsatisfiable_requirements.end()) {
+                this->num_actions_skipped_for_dispatch++;
+                continue;
+            }
+
             std::string picked_host;
             simgrid::s4u::Host *target_host = nullptr;
             unsigned long target_num_cores;
             sg_size_t required_ram;
 
+            auto num_no_longer_considered_hosts = no_longer_considered_hosts.size();
+            this->num_actions_considered_for_dispatch++;
             std::tuple<simgrid::s4u::Host *, unsigned long> allocation =
                     pickAllocation(action,
-                                   std::get<0>(this->action_run_specs[action]),
-                                   std::get<1>(this->action_run_specs[action]),
+                                   std::get<3>(requirements),
+                                   std::get<4>(requirements),
                                    no_longer_considered_hosts);
             required_ram = action->getMinRAMFootprint();
             target_host = std::get<0>(allocation);
@@ -451,38 +600,20 @@ namespace wrench {
 
             // If we didn't find a host, forget it
             if (target_host == nullptr) {
+                // Unless a host was just added to the hosts no longer considered (which another action with the same
+                // requirements could do as well), the same will happen for all actions with the same requirements
+                if (no_longer_considered_hosts.size() == num_no_longer_considered_hosts) {
+                    unsatisfiable_requirements.insert(requirements);
+                }
                 continue;
             }
             //            WRENCH_INFO("ALLOC %s: %s %ld %lf", action->getName().c_str(), target_host.c_str(), target_num_cores, required_ram);
 
             /** Dispatch it **/
-            // Create an action executor on the target host
-            auto action_executor = std::shared_ptr<ActionExecutor>(
-                    new ActionExecutor(target_host->get_name(),
-                                       target_num_cores,
-                                       required_ram,
-                                       this->getPropertyValueAsTimeInSecond(ActionExecutionServiceProperty::THREAD_CREATION_OVERHEAD),
-                                       this->getPropertyValueAsBoolean(ActionExecutionServiceProperty::SIMULATE_COMPUTATION_AS_SLEEP),
-                                       this->_commport,
-                                       nullptr,
-                                       action,
-                                       this->getSharedPtr<ActionExecutionService>()));
-
-            action_executor->setSimulation(this->simulation_);
-            try {
-                action_executor->start(action_executor, true, false);// Daemonized, no auto-restart
-            } catch (ExecutionException &) {
-                // This is an error on the target host!!
-                throw std::runtime_error(
-                        "ActionSchedule::dispatchReadyActions(): got a host error on the target host - this shouldn't happen");
-            }
-
-            // Start a failure detector for this action executor (which will send me a message in case the
-            // action executor has died)
-            auto failure_detector = std::make_shared<ServiceTerminationDetector>(
-                this->_hostname, action_executor, this->_commport, true, false);
-            failure_detector->setSimulation(this->simulation_);
-            failure_detector->start(failure_detector, true, false);// Daemonized, no auto-restart
+            // Assign the action to an idle action executor on the target host, and wake it up
+            auto action_executor = this->getIdleActionExecutor(target_host);
+            action_executor->assignAction(action, target_num_cores, required_ram);
+            action_executor->_commport->dputMessage(new ActionExecutorRunActionMessage(action));
 
             // Keep track of this action executor
             this->action_executors[action] = action_executor;
@@ -490,28 +621,92 @@ namespace wrench {
             // Update core and RAM availability
             this->ram_availabilities[target_host] -= required_ram;
             this->running_thread_counts[target_host] += target_num_cores;
+            this->indexHost(target_host);
 
             dispatched_actions.insert(action);
+            this->num_actions_dispatched++;
 
+            // Running thread counts can exceed core counts, in which case hosts are considered available
+            // again, so previously unsatisfiable requirements may now be satisfiable
+            unsatisfiable_requirements.clear();
         }
 
-        // Remove the Actions from the ready queue (this is inefficient, better data structs would help)
-        while (not dispatched_actions.empty()) {
-            std::shared_ptr<Action> dispatched_action = *(dispatched_actions.begin());
-            for (auto const &ready_action: this->ready_actions) {
-                for (auto it = this->ready_actions.begin(); it != this->ready_actions.end(); it++) {
-                    if ((*it) == dispatched_action) {
-                        this->ready_actions.erase(it);
-                        dispatched_actions.erase(dispatched_action);
-                        break;
-                    }
-                }
-            }
+        // Remove the Actions from the ready queue
+        if (not dispatched_actions.empty()) {
+            this->ready_actions.erase(
+                    std::remove_if(this->ready_actions.begin(), this->ready_actions.end(),
+                                   [this, &dispatched_actions](const std::shared_ptr<Action> &a) {
+                                       if (dispatched_actions.find(a) == dispatched_actions.end()) {
+                                           return false;
+                                       }
+                                       this->forgetReadyActionRequirements(a);
+                                       return true;
+                                   }),
+                    this->ready_actions.end());
         }
 
         this->releaseDaemonLock();
     }
 
+    /**
+     * @brief Get an idle action executor on a host, starting a new one if the host's pool is empty. Pooled
+     *        action executors are long-lived, and each comes with a single failure detector (as opposed
+     *        to one per action), so that running many short actions doesn't require creating/destroying actors.
+     *
+     * @param host: the host
+     * @return an action executor
+     */
+    std::shared_ptr<ActionExecutor> ActionExecutionService::getIdleActionExecutor(simgrid::s4u::Host *host) {
+        auto &idle_executors = this->idle_action_executors[host];
+        while (not idle_executors.empty()) {
+            auto action_executor = idle_executors.back();
+            idle_executors.pop_back();
+            // Skip action executors that have died (e.g., due to a host failure) but whose crash
+            // hasn't been processed yet
+            if (action_executor->getState() != S4U_Daemon::State::DOWN) {
+                return action_executor;
+            }
+        }
+
+        // Create an action executor on the host
+        auto action_executor = std::shared_ptr<ActionExecutor>(
+                new ActionExecutor(host->get_name(),
+                                   this->getPropertyValueAsTimeInSecond(ActionExecutionServiceProperty::THREAD_CREATION_OVERHEAD),
+                                   this->getPropertyValueAsBoolean(ActionExecutionServiceProperty::SIMULATE_COMPUTATION_AS_SLEEP),
+                                   this->_commport,
+                                   this->getSharedPtr<ActionExecutionService>()));
+
+        action_executor->setSimulation(this->simulation_);
+        try {
+            action_executor->start(action_executor, true, false);// Daemonized, no auto-restart
+        } catch (ExecutionException &) {
+            // This is an error on the target host!!
+            throw std::runtime_error(
+                    "ActionExecutionService::getIdleActionExecutor(): got a host error on the target host - this shouldn't happen");
+        }
+
+        // Start a failure detector for this action executor (which will send me a message in case the
+        // action executor has died)
+        auto failure_detector = std::make_shared<ServiceTerminationDetector>(
+                this->_hostname, action_executor, this->_commport, true, false);
+        failure_detector->setSimulation(this->simulation_);
+        failure_detector->start(failure_detector, true, false);// Daemonized, no auto-restart
+
+        return action_executor;
+    }
+
+    /**
+     * @brief Kill all idle action executors
+     */
+    void ActionExecutionService::killIdleActionExecutors() {
+        for (auto const &h: this->idle_action_executors) {
+            for (auto const &action_executor: h.second) {
+                action_executor->killActor();
+            }
+        }
+        this->idle_action_executors.clear();
+    }
+
     /**
      * @brief Wait for and react to any incoming message
      *
@@ -638,8 +833,10 @@ namespace wrench {
         bool killed_due_to_job_cancellation = (std::dynamic_pointer_cast<JobKilled>(cause) != nullptr);
 
         // If action is ready, remove it from ready list
-        if (std::find(this->ready_actions.begin(), this->ready_actions.end(), action) != this->ready_actions.end()) {
-            this->ready_actions.erase(std::find(this->ready_actions.begin(), this->ready_actions.end(), action));
+        auto ready_action = std::find(this->ready_actions.begin(), this->ready_actions.end(), action);
+        if (ready_action != this->ready_actions.end()) {
+            this->forgetReadyActionRequirements(action);
+            this->ready_actions.erase(ready_action);
         }
 
         // If action is running kill the executor
@@ -647,6 +844,7 @@ namespace wrench {
             auto executor = this->action_executors[action];
             this->ram_availabilities[executor->getHost()] += executor->getMemoryAllocated();
             this->running_thread_counts[executor->getHost()] -= executor->getNumCoresAllocated();
+            this->indexHost(executor->getHost());
 
             executor->kill(killed_due_to_job_cancellation);
             executor->getAction()->setFailureCause(cause);
@@ -705,6 +903,8 @@ namespace wrench {
             this->killAction(action, failure_cause);
         }
 
+        this->killIdleActionExecutors();
+
         if (send_failure_notifications) {
             throw std::runtime_error("ActionExecutionService::terminate(): NEED TO IMPLEMENT FAILURE NOTIFICATIONS???");
         }
@@ -751,11 +951,14 @@ namespace wrench {
         // Update RAM availabilities and running thread counts
         this->ram_availabilities[executor_host] += executor->getMemoryAllocated();
         this->running_thread_counts[executor_host] -= executor->getNumCoresAllocated();
+        this->indexHost(executor_host);
 
-        // Forget the action executor
+        // Forget the action, and put the action executor back in the pool
         this->action_executors.erase(action);
         this->all_actions.erase(action);
         this->action_run_specs.erase(action);
+        executor->releaseAction();
+        this->idle_action_executors[executor_host].push_back(executor);
 
         // Send the notification to the originator
         this->parent_service->_commport->dputMessage(
@@ -774,9 +977,12 @@ namespace wrench {
         // Update RAM availabilities and running thread counts
         this->ram_availabilities[executor->getHost()] += executor->getMemoryAllocated();
         this->running_thread_counts[executor->getHost()] -= executor->getNumCoresAllocated();
+        this->indexHost(executor->getHost());
 
-        // Forget the action executor
+        // Forget the action, and put the action executor back in the pool
         this->action_executors.erase(action);
+        executor->releaseAction();
+        this->idle_action_executors[executor->getHost()].push_back(executor);
 
         // Send the notification
         WRENCH_INFO("Sending action failure notification to '%s'", parent_service->_commport->get_cname());
@@ -941,7 +1147,7 @@ namespace wrench {
         this->action_run_specs[action] = action_run_spec;
 
         if (action->getState() == Action::State::READY)
-            this->ready_actions.push_back(action);
+            this->addReadyAction(action);
 
         // And send a reply!
         answer_commport->dputMessage(
@@ -1075,9 +1281,18 @@ namespace wrench {
 
         WRENCH_INFO("Handling an ActionExecutor crash!");
 
+        // If the executor wasn't running an action (i.e., it was idle in the pool), just forget it
+        auto running_executor = this->action_executors.find(action);
+        if ((running_executor == this->action_executors.end()) or (running_executor->second != executor)) {
+            auto &idle_executors = this->idle_action_executors[executor->getHost()];
+            idle_executors.erase(std::remove(idle_executors.begin(), idle_executors.end(), executor), idle_executors.end());
+            return;
+        }
+
         // Update RAM availabilities and running thread counts
         this->ram_availabilities[executor->getHost()] += executor->getMemoryAllocated();
         this->running_thread_counts[executor->getHost()] -= executor->getNumCoresAllocated();
+        this->indexHost(executor->getHost());
 
         // Forget the executor
         this->action_executors.erase(action);
@@ -1088,7 +1303,7 @@ namespace wrench {
             //            action->setState(Action::State::READY);
             // Put the action back in the ready list (at the end)
             WRENCH_INFO("Putting action %s back in the ready queue", action->getName().c_str());
-            this->ready_actions.push_back(action);
+            this->addReadyAction(action);
         } else {
             // Send the notification
             WRENCH_INFO("Sending action failure notification to '%s'", parent_service->_commport->get_cname());
@@ -1119,6 +1334,31 @@ namespace wrench {
         return all_resources_down and (this->action_executors.empty());
     }
 
+    /**
+     * @brief Get the number of ready actions for which an allocation was computed when dispatching actions
+     * @return a number of actions
+     */
+    unsigned long ActionExecutionService::getNumActionsConsideredForDispatch() const {
+        return this->num_actions_considered_for_dispatch;
+    }
+
+    /**
+     * @brief Get the number of actions that have been dispatched to action executors
+     * @return a number of actions
+     */
+    unsigned long ActionExecutionService::getNumActionsDispatched() const {
+        return this->num_actions_dispatched;
+    }
+
+    /**
+     * @brief Get the number of ready actions that were skipped when dispatching actions, without
+     *        computing an allocation, because they were known not to be able to run
+     * @return a number of actions
+     */
+    unsigned long ActionExecutionService::getNumActionsSkippedForDispatch() const {
+        return this->num_actions_skipped_for_dispatch;
+    }
+
     /**
      * @brief Set parent service
      * @param parent: the parent service
@@ -68,6 +68,95 @@ namespace wrench {
         this->action->setExecutionHost(this->_hostname);
     }
 
+    /**
+     * @brief Constructor for a pooled action executor, i.e., a long-lived action executor that runs,
+     *        one after the other, the actions that are assigned to it (see assignAction())
+     *
+     * @param hostname: the name of the host on which the action executor will run
+     * @param thread_creation_overhead: the thread creation overhead in seconds (incurred for each action)
+     * @param simulate_computation_as_sleep: whether to simulate computation as sleep
+     * @param callback_commport: the callback commport to which an "action done" message will be sent after each action
+     * @param action_execution_service: the parent action execution service
+     */
+    ActionExecutor::ActionExecutor(
+        const std::string& hostname,
+        double thread_creation_overhead,
+        bool simulate_computation_as_sleep,
+        S4U_CommPort* callback_commport,
+        const std::shared_ptr<ActionExecutionService>& action_execution_service) : ExecutionController(
+        hostname, "action_executor") {
+        this->callback_commport = callback_commport;
+        this->custom_callback_message = nullptr;
+        this->action = nullptr;
+        this->action_execution_service = action_execution_service;
+        this->num_cores = 0;
+        this->ram_footprint = 0;
+        this->action_startup_overhead = thread_creation_overhead;
+        this->simulation_compute_as_sleep = simulate_computation_as_sleep;
+
+        this->killed_on_purpose = false;
+        this->pooled = true;
+    }
+
+    /**
+     * @brief Assign an action to a pooled action executor, which should then be sent an
+     *        ActionExecutorRunActionMessage to run it
+     *
+     * @param action: the action to perform
+     * @param num_cores: the number of cores
+     * @param ram_footprint: the RAM footprint
+     */
+    void ActionExecutor::assignAction(const std::shared_ptr<Action>& action, unsigned long num_cores, sg_size_t ram_footprint) {
+#ifdef WRENCH_INTERNAL_EXCEPTIONS
+        if (not this->pooled) {
+            throw std::runtime_error("ActionExecutor::assignAction(): action executor is not pooled");
+        }
+        if (action == nullptr) {
+            throw std::invalid_argument("ActionExecutor::assignAction(): action cannot be nullptr");
+        }
+#endif
+        this->action = action;
+        this->num_cores = num_cores;
+        this->ram_footprint = ram_footprint;
+        this->killed_on_purpose = false;
+
+        this->action->setNumCoresAllocated(this->num_cores);
+        this->action->setRAMAllocated(this->ram_footprint);
+        this->action->setExecutionHost(this->_hostname);
+    }
+
+    /**
+     * @brief Release the action of a pooled action executor, which is then idle until
+     *        it is assigned a new action (so that the action, and everything it references,
+     *        isn't kept alive by an idle action executor)
+     */
+    void ActionExecutor::releaseAction() {
+        this->action = nullptr;
+        this->num_cores = 0;
+        this->ram_footprint = 0;
+        this->killed_on_purpose = false;
+    }
+
+    /**
+     * @brief Replace the commports of a pooled action executor with fresh ones, so that messages
+     *        meant for the action that was just executed (e.g., late replies, or notifications from
+     *        managers created by a custom action) are never delivered to the next action
+     */
+    void ActionExecutor::renewCommPorts() {
+        auto old_commport = this->_commport;
+        auto old_recv_commport = this->recv_commport;
+
+        this->_commport = S4U_CommPort::getTemporaryCommPort();
+        this->_commport->s4u_mb->set_receiver(this->s4u_actor);
+        this->recv_commport = S4U_CommPort::getTemporaryCommPort();
+        S4U_Daemon::map_actor_to_recv_commport[simgrid::s4u::this_actor::get_pid()] = this->recv_commport;
+
+        // The old commports are retired, and won't be reused by anyone as long as they hold stale messages
+        old_commport->s4u_mb->set_receiver(nullptr);
+        S4U_CommPort::retireTemporaryCommPort(old_commport);
+        S4U_CommPort::retireTemporaryCommPort(old_recv_commport);
+    }
+
     /**
      * @brief Return the executor's thread creation overhead
      * @return an overhead (in seconds)
@@ -113,8 +202,8 @@ namespace wrench {
             this->killed_on_purpose);
 
 
-        // Handle brutal failure or termination
-        if (not has_returned_from_main and this->action->getState() == Action::State::STARTED) {
+        // Handle brutal failure or termination (a pooled action executor may have no action, or an already-done action)
+        if (not has_returned_from_main and this->action and this->action->getState() == Action::State::STARTED) {
             this->action->setEndDate(Simulation::getCurrentSimulatedDate());
             if (this->killed_on_purpose) {
                 this->action->setState(Action::State::KILLED);
@@ -190,6 +279,27 @@ namespace wrench {
      *
      */
     int ActionExecutor::main() {
+        if (not this->pooled) {
+            this->run_action();
+            return 0;
+        }
+
+        // Run assigned actions until killed
+        while (true) {
+            auto message = this->_commport->getMessage();
+            if (not dynamic_cast<ActionExecutorRunActionMessage *>(message.get())) {
+                // A stray message (e.g., a late reply meant for a previous action): ignore it
+                WRENCH_DEBUG("Pooled action executor ignoring an unexpected [%s] message", message->getName().c_str());
+                continue;
+            }
+            this->run_action();
+        }
+    }
+
+    /**
+     * @brief Helper method to run the executor's action and report back
+     */
+    void ActionExecutor::run_action() {
         S4U_Simulation::computeZeroFlop(); // to block in case pstate speed is 0
 
         this->action->setStartDate(S4U_Simulation::getClock());
@@ -216,6 +326,11 @@ namespace wrench {
         }
         this->action->setEndDate(S4U_Simulation::getClock());
 
+        // A pooled action executor starts its next action with fresh commports
+        if (this->pooled) {
+            this->renewCommPorts();
+        }
+
         // WRENCH_INFO("Action executor for action %s terminating and action has %s",
         //             this->action->getName().c_str(),
         //             (this->action->getState() == Action::State::COMPLETED ? "succeeded" : ("failed (" + this->action->
@@ -231,7 +346,6 @@ namespace wrench {
                 WRENCH_INFO("Action executor can't report back due to network error.. oh well!");
             }
         }
-        return 0;
     }
 
     /**
@@ -245,7 +359,7 @@ namespace wrench {
         this->acquireDaemonLock();
         bool i_killed_it = this->killActor();
         this->releaseDaemonLock();
-        if (i_killed_it) {
+        if (i_killed_it and this->action) {
             this->action->terminate(this->getSharedPtr<ActionExecutor>());
         }
     }
@@ -34,5 +34,19 @@ namespace wrench {
         this->action_executor = std::move(action_executor);
     }
 
+    /**
+     * @brief Constructor
+     *
+     * @param action: the action to run
+     */
+    ActionExecutorRunActionMessage::ActionExecutorRunActionMessage(std::shared_ptr<Action> action) : ActionExecutorMessage() {
+#ifdef WRENCH_INTERNAL_EXCEPTIONS
+        if (action == nullptr) {
+            throw std::invalid_argument("ActionExecutorRunActionMessage::ActionExecutorRunActionMessage(): invalid argument");
+        }
+#endif
+        this->action = std::move(action);
+    }
+
 
 }// namespace wrench
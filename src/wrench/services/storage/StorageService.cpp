@@ -488,7 +488,7 @@ namespace wrench {
 
         // Send a message to the daemon of the dst service
         auto answer_commport = S4U_Daemon::getRunningActorRecvCommPort();
-        src_location->getStorageService()->getSimulation()->getOutput().addTimestampFileCopyStart(
+        auto start_timestamp = src_location->getStorageService()->getSimulation()->getOutput().addTimestampFileCopyStart(
             Simulation::getCurrentSimulatedDate(), file,
             src_location,
             dst_location);
@@ -497,6 +497,7 @@ namespace wrench {
                 answer_commport,
                 src_location,
                 dst_location,
+                start_timestamp,
                 dst_location->getStorageService()->getMessagePayloadValue(
                     StorageServiceMessagePayload::FILE_COPY_REQUEST_MESSAGE_PAYLOAD)));
 
@@ -555,7 +556,7 @@ namespace wrench {
             commport_to_contact = dst_location->getStorageService()->_commport;
         }
 
-        src_location->getStorageService()->getSimulation()->getOutput().addTimestampFileCopyStart(
+        auto start_timestamp = src_location->getStorageService()->getSimulation()->getOutput().addTimestampFileCopyStart(
             Simulation::getCurrentSimulatedDate(), file,
             src_location,
             dst_location);
@@ -566,6 +567,7 @@ namespace wrench {
                 answer_commport,
                 src_location,
                 dst_location,
+                start_timestamp,
                 dst_location->getStorageService()->getMessagePayloadValue(
                     StorageServiceMessagePayload::FILE_COPY_REQUEST_MESSAGE_PAYLOAD)));
     }
@@ -157,12 +157,14 @@ namespace wrench {
     * @param answer_commport: the commport to which to send the answer (if nullptr, no answer will be sent)
     * @param src: the source location
     * @param dst: the destination location
+    * @param start_timestamp: the file copy start timestamp (nullptr if file copy timestamps are disabled)
     * @param payload: the message size in bytes
     *
     */
     StorageServiceFileCopyRequestMessage::StorageServiceFileCopyRequestMessage(S4U_CommPort *answer_commport,
                                                                                std::shared_ptr<FileLocation> src,
                                                                                std::shared_ptr<FileLocation> dst,
+                                                                               SimulationTimestampFileCopyStart *start_timestamp,
                                                                                sg_size_t payload) : StorageServiceMessage(payload) {
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if ((answer_commport == nullpr) || (src == nullptr) || (dst == nullptr)) {
@@ -173,6 +175,7 @@ namespace wrench {
         this->answer_commport = answer_commport;
         this->src = std::move(src);
         this->dst = std::move(dst);
+        this->start_timestamp = start_timestamp;
     }
 
     /**
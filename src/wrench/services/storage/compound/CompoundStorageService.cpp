@@ -596,14 +596,15 @@ namespace wrench {
                 commport_to_contact = dst_parts[copy_idx]->getStorageService()->_commport;
             }
 
-            this->simulation_->getOutput().addTimestampFileCopyStart(Simulation::getCurrentSimulatedDate(), file,
-                                                                    src_parts[copy_idx],
-                                                                    dst_parts[copy_idx]);
+            auto start_timestamp = this->simulation_->getOutput().addTimestampFileCopyStart(Simulation::getCurrentSimulatedDate(), file,
+                                                                                            src_parts[copy_idx],
+                                                                                            dst_parts[copy_idx]);
             commport_to_contact->dputMessage(
                     new StorageServiceFileCopyRequestMessage(
                             tmp_commport,
                             src_parts[copy_idx],
                             dst_parts[copy_idx],
+                            start_timestamp,
                             dst_parts[copy_idx]->getStorageService()->getMessagePayloadValue(
                                     StorageServiceMessagePayload::FILE_COPY_REQUEST_MESSAGE_PAYLOAD)));
 
@@ -733,9 +734,9 @@ namespace wrench {
                 commport_to_contact = dst_parts[copy_idx]->getStorageService()->_commport;
             }
 
-            this->simulation_->getOutput().addTimestampFileCopyStart(Simulation::getCurrentSimulatedDate(), file,
-                                                                    src_parts[copy_idx],
-                                                                    dst_parts[copy_idx]);
+            auto start_timestamp = this->simulation_->getOutput().addTimestampFileCopyStart(Simulation::getCurrentSimulatedDate(), file,
+                                                                                            src_parts[copy_idx],
+                                                                                            dst_parts[copy_idx]);
 
             // That's quite dirty, but : space is reserved during the call to lookupOrDesignateFileLocation, so that
             // we keep track of future space usage on various storage nodes while allocating multiple chunks of a given
@@ -746,6 +747,7 @@ namespace wrench {
                             tmp_commport,
                             src_parts[copy_idx],
                             dst_parts[copy_idx],
+                            start_timestamp,
                             dst_parts[copy_idx]->getStorageService()->getMessagePayloadValue(
                                     StorageServiceMessagePayload::FILE_COPY_REQUEST_MESSAGE_PAYLOAD)));
 
@@ -408,6 +408,7 @@ namespace wrench {
     void SimpleStorageService::validateProperties() {
         this->getPropertyValueAsUnsignedLong(SimpleStorageServiceProperty::MAX_NUM_CONCURRENT_DATA_CONNECTIONS);
         this->getPropertyValueAsSizeInByte(SimpleStorageServiceProperty::BUFFER_SIZE);
+        this->getPropertyValueAsBoolean(SimpleStorageServiceProperty::COALESCE_DATA_CHUNKS);
     }
 
 
@@ -464,7 +465,7 @@ namespace wrench {
      * @param location: a location
      */
     void SimpleStorageService::removeFile(const std::shared_ptr<FileLocation>& location) {
-        std::string full_path = location->getFilePath();
+        auto const &full_path = location->getFilePath();
         if (not this->file_system->file_exists(full_path)) {
             return;
         }
@@ -478,7 +479,7 @@ namespace wrench {
      * @param location: a location
      */
     void SimpleStorageService::createFile(const std::shared_ptr<FileLocation>& location) {
-        std::string full_path = location->getFilePath();
+        auto const &full_path = location->getFilePath();
 
         try {
             this->file_system->create_file(full_path, location->getFile()->getSize());
@@ -503,7 +504,7 @@ namespace wrench {
         }
 
         try {
-            std::string full_path = location->getFilePath();
+            auto const &full_path = location->getFilePath();
             auto fd = this->file_system->open(full_path, "r");
             double date = fd->stat()->last_modification_date;
             fd->close();
@@ -569,6 +570,16 @@ namespace wrench {
         return this->file_system->open(location->getFilePath(), "r");
     }
 
+    /**
+     * @brief A method to open a file given an interned directory path (see openFile() above),
+     *        which does not re-sanitize the path
+     * @param path: the file's directory path (as returned by FileLocation::internPath())
+     * @param file: the file
+     */
+    std::shared_ptr<simgrid::fsmod::File> SimpleStorageService::openFile(const PathHandle &path, const std::shared_ptr<DataFile> &file) {
+        return this->openFile(FileLocation::LOCATION(this->getSharedPtr<StorageService>(), path, file));
+    }
+
     /**
      * @brief Gets the disk that stores a path
      * @param path: a path
@@ -61,6 +61,7 @@ namespace wrench {
                                                                    WRENCH_PROPERTY_COLLECTION_TYPE property_list,
                                                                    WRENCH_MESSAGE_PAYLOAD_COLLECTION_TYPE messagepayload_list) : SimpleStorageService(hostname, mount_points, file_system, std::move(property_list), std::move(messagepayload_list), "_" + std::to_string(getNewUniqueNumber())) {
         this->buffer_size = this->getPropertyValueAsSizeInByte(StorageServiceProperty::BUFFER_SIZE);
+        this->coalesce_data_chunks = this->getPropertyValueAsBoolean(SimpleStorageServiceProperty::COALESCE_DATA_CHUNKS);
         this->is_bufferized = true;
     }
 
@@ -159,7 +160,7 @@ namespace wrench {
             return processFileReadRequest(ssfrr_msg->location, ssfrr_msg->num_bytes_to_read, ssfrr_msg->answer_commport);
 
         } else if (auto ssfcr_msg = std::dynamic_pointer_cast<StorageServiceFileCopyRequestMessage>(message)) {
-            return processFileCopyRequest(ssfcr_msg->src, ssfcr_msg->dst, ssfcr_msg->answer_commport);
+            return processFileCopyRequest(ssfcr_msg->src, ssfcr_msg->dst, ssfcr_msg->answer_commport, ssfcr_msg->start_timestamp);
 
         } else if (auto fttn_msg = std::dynamic_pointer_cast<FileTransferThreadNotificationMessage>(message)) {
             return processFileTransferThreadNotification(
@@ -240,6 +241,7 @@ namespace wrench {
                 nullptr,
                 this->buffer_size);
         ftt->setSimulation(this->simulation_);
+        ftt->coalesce_data_chunks = this->coalesce_data_chunks;
 
         // Add it to the Pool of pending data communications
         this->pending_file_transfer_threads.push_back(ftt);
@@ -301,6 +303,7 @@ namespace wrench {
                     nullptr,
                     buffer_size);
             ftt->setSimulation(this->simulation_);
+            ftt->coalesce_data_chunks = this->coalesce_data_chunks;
 
             // Add it to the Pool of pending data communications
             this->pending_file_transfer_threads.push_front(ftt);
@@ -316,19 +319,21 @@ namespace wrench {
      * @param src_location: the source location
      * @param dst_location: the destination location
      * @param answer_commport: the commport to which the answer should be sent
+     * @param start_timestamp: the file copy start timestamp
      * @return
      */
     bool SimpleStorageServiceBufferized::processFileCopyRequest(
             std::shared_ptr<FileLocation> &src_location,
             std::shared_ptr<FileLocation> &dst_location,
-            S4U_CommPort *answer_commport) {
+            S4U_CommPort *answer_commport,
+            SimulationTimestampFileCopyStart *start_timestamp) {
         std::shared_ptr<simgrid::fsmod::File> src_opened_file;
         std::shared_ptr<simgrid::fsmod::File> dst_opened_file;
 
         auto failure_cause = validateFileCopyRequest(src_location, dst_location, src_opened_file, dst_opened_file);
 
         if (failure_cause) {
-            this->simulation_->getOutput().addTimestampFileCopyFailure(Simulation::getCurrentSimulatedDate(), src_location->getFile(), src_location, dst_location);
+            this->simulation_->getOutput().addTimestampFileCopyFailure(Simulation::getCurrentSimulatedDate(), src_location->getFile(), src_location, dst_location, start_timestamp);
             try {
                 answer_commport->putMessage(
                         new StorageServiceFileCopyAnswerMessage(
@@ -368,6 +373,8 @@ namespace wrench {
                 answer_commport,
                 this->buffer_size);
         ftt->setSimulation(this->simulation_);
+        ftt->coalesce_data_chunks = this->coalesce_data_chunks;
+        ftt->copy_start_timestamp = start_timestamp;
         this->pending_file_transfer_threads.push_back(ftt);
 
         return true;
@@ -458,7 +465,7 @@ namespace wrench {
                 try {
                     this->simulation_->getOutput().addTimestampFileCopyCompletion(
                             Simulation::getCurrentSimulatedDate(), ftt->dst_location->getFile(), ftt->src_location,
-                            ftt->dst_location);
+                            ftt->dst_location, ftt->copy_start_timestamp);
                 } catch (invalid_argument &ignore) {
                 }
             }
@@ -36,6 +36,7 @@ namespace wrench {
      */
     void SimpleStorageServiceNonBufferized::cleanup(bool has_returned_from_main, int return_value) {
         //        this->release_held_mutexes();
+        this->pending_activities.clear();
     }
 
     /**
@@ -115,7 +116,8 @@ namespace wrench {
                 WRENCH_INFO("File %s stored", transaction->dst_location->getFile()->getID().c_str());
                 try {
                     this->simulation_->getOutput().addTimestampFileCopyCompletion(
-                            Simulation::getCurrentSimulatedDate(), transaction->dst_location->getFile(), transaction->src_location, transaction->dst_location);
+                            Simulation::getCurrentSimulatedDate(), transaction->dst_location->getFile(), transaction->src_location, transaction->dst_location,
+                            transaction->copy_start_timestamp);
                 } catch (invalid_argument &ignore) {
                 }
             }
@@ -152,9 +154,9 @@ namespace wrench {
         WRENCH_INFO("%s", message.c_str());
 
         // In case this was a restart!
-        this->stream_to_transactions.clear();
         this->pending_transactions.clear();
         this->running_transactions.clear();
+        this->pending_activities.clear();
         this->_commport->reset();
         this->recv_commport->reset();
 
@@ -213,51 +215,45 @@ namespace wrench {
                     // oh well
                     continue;
                 }
+                this->pending_activities.push(comm_ptr);
                 comm_has_been_posted = true;
             }
 
             // Create an async recv on the message queue if needed
             if (not mess_has_been_posted) {
                 mess_ptr = this->_commport->s4u_mq->get_async<void>(reinterpret_cast<void**>(&(simulation_message)));
+                this->pending_activities.push(mess_ptr);
                 mess_has_been_posted = true;
-            } else {
-
-            }
-
-            // Create all activities to wait on
-            simgrid::s4u::ActivitySet pending_activities;
-            pending_activities.push(comm_ptr);
-            pending_activities.push(mess_ptr);
-            for (auto const &transaction: this->running_transactions) {
-                pending_activities.push(transaction->stream);
             }
 
-            // Wait for one activity to complete
+            // Wait for one activity to complete (the activity set, which persists across iterations,
+            // no longer contains that activity afterwards)
             simgrid::s4u::ActivityPtr finished_activity;
             try {
-                finished_activity = pending_activities.wait_any();
+                finished_activity = this->pending_activities.wait_any();
             } catch (simgrid::Exception &e) {
-                auto failed_activity = pending_activities.get_failed_activity();
-                if (failed_activity == comm_ptr) {
-                    // the comm failed
-                    comm_has_been_posted = false;
-                    comm_ptr->cancel();
-                    comm_ptr = nullptr;
-                    continue;// oh well
+                // Failed activities are no longer in the activity set either
+                while (auto failed_activity = this->pending_activities.get_failed_activity()) {
+                    if (failed_activity == comm_ptr) {
+                        // the comm failed
+                        comm_has_been_posted = false;
+                        comm_ptr->cancel();
+                        comm_ptr = nullptr;
+                    } else if (failed_activity == mess_ptr) {
+                        // the mess failed
+                        mess_has_been_posted = false;
+                        mess_ptr->cancel();
+                        mess_ptr = nullptr;
+                    } else {
+                        auto it = this->running_transactions.find(failed_activity.get());
+                        if (it != this->running_transactions.end()) {
+                            auto transaction = it->second;
+                            this->running_transactions.erase(it);
+                            processTransactionFailure(transaction);
+                        }
+                    }
                 }
-                if (failed_activity == mess_ptr) {
-                    // the mess failed
-                    mess_has_been_posted = false;
-                    mess_ptr->cancel();
-                    mess_ptr = nullptr;
-                    continue;// oh well
-                }
-
-                auto stream = boost::dynamic_pointer_cast<simgrid::s4u::Io>(finished_activity);
-                auto transaction = this->stream_to_transactions[stream];
-                this->stream_to_transactions.erase(transaction->stream);
-                processTransactionFailure(transaction);
-                continue;
+                continue;// oh well
             }
 
             if (finished_activity == comm_ptr) {
@@ -269,10 +265,9 @@ namespace wrench {
                 mess_has_been_posted = false;
                 if (not processNextMessage(msg)) break;
             } else {
-                auto stream = boost::dynamic_pointer_cast<simgrid::s4u::Io>(finished_activity);
-                auto transaction = this->stream_to_transactions[stream];
-                this->running_transactions.erase(transaction);
-                this->stream_to_transactions.erase(transaction->stream);
+                auto it = this->running_transactions.find(finished_activity.get());
+                auto transaction = it->second;
+                this->running_transactions.erase(it);
                 processTransactionCompletion(transaction);
             }
         }
@@ -316,7 +311,7 @@ namespace wrench {
                                           msg->num_bytes_to_read, msg->answer_commport, msg->requesting_host);
 
         } else if (auto msg = dynamic_cast<StorageServiceFileCopyRequestMessage *>(message)) {
-            return processFileCopyRequest(msg->src, msg->dst, msg->answer_commport);
+            return processFileCopyRequest(msg->src, msg->dst, msg->answer_commport, msg->start_timestamp);
         } else {
             throw std::runtime_error(
                     "SimpleStorageServiceNonBufferized::processNextMessage(): Unexpected [" + message->getName() + "] message");
@@ -471,13 +466,15 @@ namespace wrench {
      * @param src_location: the source location
      * @param dst_location: the destination location
      * @param answer_commport: the commport to which the answer should be sent
+     * @param start_timestamp: the file copy start timestamp
      * @return
      */
 //    bool SimpleStorageServiceNonBufferized::processFileCopyRequestIAmNotTheSource(
     bool SimpleStorageServiceNonBufferized::processFileCopyRequest(
             std::shared_ptr<FileLocation> &src_location,
             std::shared_ptr<FileLocation> &dst_location,
-            S4U_CommPort *answer_commport) {
+            S4U_CommPort *answer_commport,
+            SimulationTimestampFileCopyStart *start_timestamp) {
 
         WRENCH_INFO("FileCopyRequest: %s -> %s",
                     src_location->toString().c_str(),
@@ -488,7 +485,7 @@ namespace wrench {
         auto failure_cause = validateFileCopyRequest(src_location, dst_location, src_opened_file, dst_opened_file);
 
         if (failure_cause) {
-            this->simulation_->getOutput().addTimestampFileCopyFailure(Simulation::getCurrentSimulatedDate(), src_location->getFile(), src_location, dst_location);
+            this->simulation_->getOutput().addTimestampFileCopyFailure(Simulation::getCurrentSimulatedDate(), src_location->getFile(), src_location, dst_location, start_timestamp);
             try {
                 answer_commport->dputMessage(
                         new StorageServiceFileCopyAnswerMessage(
@@ -528,6 +525,7 @@ namespace wrench {
                 dst_disk,
                 answer_commport,
                 transfer_size);
+        transaction->copy_start_timestamp = start_timestamp;
 
         this->pending_transactions.push_back(transaction);
 
@@ -555,9 +553,9 @@ namespace wrench {
 
             transaction->stream = sg_iostream;
 
-            this->stream_to_transactions[sg_iostream] = transaction;
-            this->running_transactions.insert(transaction);
+            this->running_transactions[sg_iostream.get()] = transaction;
             sg_iostream->start();
+            this->pending_activities.push(sg_iostream);
         }
     }
 
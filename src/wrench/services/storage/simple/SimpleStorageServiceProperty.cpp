@@ -12,5 +12,6 @@
 namespace wrench {
 
     SET_PROPERTY_NAME(SimpleStorageServiceProperty, MAX_NUM_CONCURRENT_DATA_CONNECTIONS);
+    SET_PROPERTY_NAME(SimpleStorageServiceProperty, COALESCE_DATA_CHUNKS);
 
 };
@@ -7,6 +7,7 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
 #include <memory>
 #include <wrench/logging/TerminalOutput.h>
 #include <wrench/services/storage/StorageService.h>
@@ -27,56 +28,114 @@ WRENCH_LOG_CATEGORY(wrench_core_file_location, "Log category for FileLocation");
 
 namespace wrench {
 
-    std::unordered_map<std::string, std::shared_ptr<FileLocation>> FileLocation::file_location_map;
-    size_t FileLocation::file_location_map_previous_size = 0;
+    std::unordered_map<FileLocation::FileLocationKey, std::shared_ptr<FileLocation>, FileLocation::FileLocationKeyHash> FileLocation::file_location_map;
+    std::unordered_map<std::string, unsigned long> FileLocation::path_ids;
+    std::unordered_map<std::string, PathHandle> FileLocation::path_handles;
+    const std::pair<const std::string, unsigned long> PathHandle::empty_path_entry = {"", ~0UL};
+    std::vector<FileLocation::FileLocationKey> FileLocation::young_file_locations;
+    size_t FileLocation::num_old_file_locations = 0;
+    size_t FileLocation::num_old_file_locations_after_last_full_reclaim = 0;
     long FileLocation::dot_file_sequence_number = 0;
 
 
     FileLocation::~FileLocation() = default;
 
     /**
-     * @brief Factory to create a new file location
+     * @brief Factory to create a new file location, or to retrieve an equivalent, already interned, one
      * @param ss: a storage service
      * @param file: a file
-     * @param path: a path
+     * @param path: an interned path
      * @param is_scratch: whether scratch or not
      * @return a shared pointer to a file location
      */
     std::shared_ptr<FileLocation> FileLocation::createFileLocation(const std::shared_ptr<StorageService> &ss,
                                                                    const std::shared_ptr<DataFile> &file,
-                                                                   const std::string &path,
+                                                                   const PathHandle &path,
                                                                    bool is_scratch) {
-        // This looks inefficient (compare to using std::hash<void*> for instance), but it has
-        // no collisions and benchmarking showed that (with compiler optimizations), it makes
-        // very little difference
-        std::string key = (ss ? ss->getName() : "") + "|" + path + "|" + file->getID() + "|" + (is_scratch ? "1" : "0");
-        if (FileLocation::file_location_map.find(key) != FileLocation::file_location_map.end()) {
-            return FileLocation::file_location_map[key];
+        FileLocationKey key = {ss.get(), path.getID(), file.get(), is_scratch};
+        auto it = FileLocation::file_location_map.find(key);
+        if (it != FileLocation::file_location_map.end()) {
+            // The location's storage service may have been changed via setStorageService()
+            if (it->second->storage_service == ss) {
+                return it->second;
+            }
+            it->second = std::shared_ptr<FileLocation>(new FileLocation(ss, file, path, is_scratch));
+            return it->second;
         }
-        auto new_location = std::shared_ptr<FileLocation>(new FileLocation(ss, file, path, is_scratch));
 
-        if (FileLocation::file_location_map.size() - FileLocation::file_location_map_previous_size > RECLAIM_TRIGGER) {
+        if (FileLocation::young_file_locations.size() >= RECLAIM_TRIGGER) {
             FileLocation::reclaimFileLocations();
-            FileLocation::file_location_map_previous_size = FileLocation::file_location_map.size();
         }
-        FileLocation::file_location_map[key] = new_location;
+        auto new_location = std::shared_ptr<FileLocation>(new FileLocation(ss, file, path, is_scratch));
+        FileLocation::file_location_map.emplace(key, new_location);
+        FileLocation::young_file_locations.push_back(key);
         return new_location;
     }
 
+    /**
+     * @brief Intern a path, so that it is sanitized only once, however many times it is used
+     *        to create file locations. Interned paths are never forgotten, so the returned handle
+     *        remains valid for the lifetime of the program.
+     * @param path: an absolute path
+     * @return a handle to the interned sanitized path
+     */
+    PathHandle FileLocation::internPath(const std::string &path) {
+        auto it = FileLocation::path_handles.find(path);
+        if (it != FileLocation::path_handles.end()) {
+            return it->second;
+        }
+
+        auto sanitized_path = FileLocation::sanitizePath(path);
+        auto entry = FileLocation::path_ids.emplace(sanitized_path, FileLocation::path_ids.size()).first;
+        PathHandle handle(&(*entry));
+        FileLocation::path_handles.emplace(path, handle);
+        FileLocation::path_handles.emplace(sanitized_path, handle);
+        return handle;
+    }
 
     /**
-     * @brief Reclaim file locations that are no longer used
+     * @brief Reclaim file locations that are no longer used. Only the locations interned
+     *        since the previous reclaim are checked, unless the number of locations that
+     *        survived previous reclaims has doubled since they were last all checked.
      */
     void FileLocation::reclaimFileLocations() {
-        for (auto it = FileLocation::file_location_map.cbegin(); it != FileLocation::file_location_map.cend();) {
-            if ((*it).second.use_count() == 1) {
-                it = FileLocation::file_location_map.erase(it);
+        for (auto const &key: FileLocation::young_file_locations) {
+            auto it = FileLocation::file_location_map.find(key);
+            if (it == FileLocation::file_location_map.end()) {
+                continue;
+            }
+            if (it->second.use_count() == 1) {
+                FileLocation::file_location_map.erase(it);
             } else {
-                ++it;
+                FileLocation::num_old_file_locations++;
+            }
+        }
+        FileLocation::young_file_locations.clear();
+
+        if (FileLocation::num_old_file_locations >
+            2 * std::max<size_t>(RECLAIM_TRIGGER, FileLocation::num_old_file_locations_after_last_full_reclaim)) {
+            for (auto it = FileLocation::file_location_map.cbegin(); it != FileLocation::file_location_map.cend();) {
+                if ((*it).second.use_count() == 1) {
+                    it = FileLocation::file_location_map.erase(it);
+                } else {
+                    ++it;
+                }
             }
+            FileLocation::num_old_file_locations = FileLocation::file_location_map.size();
+            FileLocation::num_old_file_locations_after_last_full_reclaim = FileLocation::num_old_file_locations;
         }
     }
 
+    /**
+     * @brief Forget all interned file locations (but not interned paths, to which handles may still exist)
+     */
+    void FileLocation::clearFileLocations() {
+        FileLocation::file_location_map.clear();
+        FileLocation::young_file_locations.clear();
+        FileLocation::num_old_file_locations = 0;
+        FileLocation::num_old_file_locations_after_last_full_reclaim = 0;
+    }
+
     /**
      * @brief File location specifier for a scratch storage
      *
@@ -89,7 +148,7 @@ namespace wrench {
             throw std::invalid_argument("FileLocation::SCRATCH(): Cannot pass nullptr file");
         }
 
-        return FileLocation::createFileLocation(nullptr, file, "", true);
+        return FileLocation::createFileLocation(nullptr, file, PathHandle(), true);
     }
 
     /**
@@ -152,7 +211,103 @@ namespace wrench {
             throw std::invalid_argument("FileLocation::LOCATION(): must specify a non-empty path");
         }
 
-        return FileLocation::createFileLocation(ss, file, FileLocation::sanitizePath(path + "/"), false);
+        return FileLocation::createFileLocation(ss, file, FileLocation::internPath(path), false);
+    }
+
+    /**
+     * @brief File location specifier given an interned absolute path at a storage service
+     *
+     * @param ss: a storage service
+     * @param path: an interned path (as returned by FileLocation::internPath())
+     * @param file: a file
+     * @return a file location specification
+     *
+     */
+    std::shared_ptr<FileLocation> FileLocation::LOCATION(const std::shared_ptr<StorageService> &ss,
+                                                         const PathHandle &path,
+                                                         const std::shared_ptr<DataFile> &file) {
+        if (ss == nullptr) {
+            throw std::invalid_argument("FileLocation::LOCATION(): Cannot pass nullptr storage service");
+        }
+        if (file == nullptr) {
+            throw std::invalid_argument("FileLocation::LOCATION(): Cannot pass nullptr file");
+        }
+        if (path.getPath().empty()) {
+            throw std::invalid_argument("FileLocation::LOCATION(): must specify a non-empty path");
+        }
+
+        return FileLocation::createFileLocation(ss, file, path, false);
+    }
+
+    /**
+     * @brief File location specifiers for several files at a storage service's (single) mount point root
+     *
+     * @param ss: a storage service (that has a single mount point)
+     * @param files: a list of files
+     * @return a map of file location specifications, indexed by file
+     *
+     */
+    std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> FileLocation::LOCATIONS(const std::shared_ptr<StorageService> &ss,
+                                                                                               const std::vector<std::shared_ptr<DataFile>> &files) {
+        if (ss == nullptr) {
+            throw std::invalid_argument("FileLocation::LOCATIONS(): Cannot pass nullptr storage service");
+        }
+        return LOCATIONS(ss, ss->getMountPoint(), files);
+    }
+
+    /**
+     * @brief File location specifiers for several files given an absolute path at a storage service
+     *        (which is more efficient than creating each location individually, e.g., when building the
+     *        file locations of a StandardJob)
+     *
+     * @param ss: a storage service
+     * @param path: a path
+     * @param files: a list of files
+     * @return a map of file location specifications, indexed by file
+     *
+     */
+    std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> FileLocation::LOCATIONS(const std::shared_ptr<StorageService> &ss,
+                                                                                               const std::string &path,
+                                                                                               const std::vector<std::shared_ptr<DataFile>> &files) {
+        if (ss == nullptr) {
+            throw std::invalid_argument("FileLocation::LOCATIONS(): Cannot pass nullptr storage service");
+        }
+        if (path.empty()) {
+            throw std::invalid_argument("FileLocation::LOCATIONS(): must specify a non-empty path");
+        }
+        return LOCATIONS(ss, FileLocation::internPath(path), files);
+    }
+
+    /**
+     * @brief File location specifiers for several files given an interned absolute path at a storage service
+     *
+     * @param ss: a storage service
+     * @param path: an interned path (as returned by FileLocation::internPath())
+     * @param files: a list of files
+     * @return a map of file location specifications, indexed by file
+     *
+     */
+    std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> FileLocation::LOCATIONS(const std::shared_ptr<StorageService> &ss,
+                                                                                               const PathHandle &path,
+                                                                                               const std::vector<std::shared_ptr<DataFile>> &files) {
+        if (ss == nullptr) {
+            throw std::invalid_argument("FileLocation::LOCATIONS(): Cannot pass nullptr storage service");
+        }
+        if (path.getPath().empty()) {
+            throw std::invalid_argument("FileLocation::LOCATIONS(): must specify a non-empty path");
+        }
+        for (auto const &file: files) {
+            if (file == nullptr) {
+                throw std::invalid_argument("FileLocation::LOCATIONS(): Cannot pass nullptr file");
+            }
+        }
+
+        FileLocation::file_location_map.reserve(FileLocation::file_location_map.size() + files.size());
+        std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> locations;
+        for (auto const &file: files) {
+            locations[file] = FileLocation::createFileLocation(ss, file, path, false);
+        }
+        return locations;
     }
 
     /**
@@ -165,7 +320,7 @@ namespace wrench {
             return "SCRATCH:" + this->file->getID();
         } else {
             return this->storage_service->getName() + ":" +
-                   sanitizePath(this->directory_path) + ":" + this->file->getID();
+                   this->directory_path.getPath() + ":" + this->file->getID();
         }
     }
 
@@ -217,10 +372,21 @@ namespace wrench {
      * @brief Get the location's directory path
      * @return a path
      */
-    std::string FileLocation::getDirectoryPath() {
+    const std::string &FileLocation::getDirectoryPath() const {
         if (this->is_scratch) {
             throw std::invalid_argument("FileLocation::getDirectoryPath(): No path for a SCRATCH location");
         }
+        return this->directory_path.getPath();
+    }
+
+    /**
+     * @brief Get the location's directory path as an interned path handle
+     * @return a path handle
+     */
+    PathHandle FileLocation::getDirectoryPathHandle() const {
+        if (this->is_scratch) {
+            throw std::invalid_argument("FileLocation::getDirectoryPathHandle(): No path for a SCRATCH location");
+        }
         return this->directory_path;
     }
 
@@ -228,11 +394,11 @@ namespace wrench {
      * @brief Get the location's file path
      * @return a path
      */
-    std::string FileLocation::getFilePath() const {
+    const std::string &FileLocation::getFilePath() const {
         if (this->is_scratch) {
             throw std::invalid_argument("FileLocation::getFilePath(): No path for a SCRATCH location");
         }
-        return this->directory_path + "/" + this->file->getID();
+        return this->file_path;
     }
 
     /**
@@ -243,7 +409,7 @@ namespace wrench {
         if (this->is_scratch) {
             throw std::invalid_argument("FileLocation::getDotFilePath(): No path for a SCRATCH location");
         }
-        return this->directory_path + "/" + this->file->getID() + ".wrench_tmp." + std::to_string(FileLocation::dot_file_sequence_number++);
+        return this->file_path + ".wrench_tmp." + std::to_string(FileLocation::dot_file_sequence_number++);
     }
 
 
@@ -354,7 +520,7 @@ namespace wrench {
         if (not sss) {
             return nullptr;
         }
-        return sss->getDiskForPathOrNull(this->directory_path);
+        return sss->getDiskForPathOrNull(this->directory_path.getPath());
     }
 
 
@@ -161,6 +161,57 @@ namespace wrench {
         //        Service::cleanup(has_returned_from_main, return_value);
     }
 
+    /**
+     * @brief Determine the largest data chunk size to use for a transfer. Without coalescing, this is the
+     *        buffer size. With coalescing, this is the largest buffer size times a power of two that still
+     *        leaves at least MIN_NUM_COALESCED_CHUNKS chunks in the transfer, which bounds the pipeline fill/drain
+     *        error (with respect to buffer-size chunks) to about 1/MIN_NUM_COALESCED_CHUNKS of the transfer time.
+     *
+     * @param num_bytes: the number of bytes to transfer
+     * @param buffer_size: the buffer size
+     * @param coalesce_data_chunks: whether data chunks should be coalesced
+     * @return a chunk size in bytes
+     */
+    sg_size_t FileTransferThread::getMaxChunkSize(sg_size_t num_bytes, sg_size_t buffer_size, bool coalesce_data_chunks) {
+        static constexpr sg_size_t MIN_NUM_COALESCED_CHUNKS = 128;
+
+        if ((not coalesce_data_chunks) or (buffer_size == 0)) {
+            return buffer_size;
+        }
+        sg_size_t max_chunk_size = buffer_size;
+        while (max_chunk_size <= num_bytes / (2 * MIN_NUM_COALESCED_CHUNKS)) {
+            max_chunk_size *= 2;
+        }
+        return max_chunk_size;
+    }
+
+    /**
+     * @brief Determine the size of the next data chunk of a transfer. The first and last chunks are
+     *        buffer-size chunks, and chunk sizes double (resp. halve) between them up to the maximum
+     *        chunk size, so that the disk/network pipeline fills and drains as it would with
+     *        buffer-size chunks. With a maximum chunk size equal to the buffer size, all chunks (but
+     *        the last one) are buffer-size chunks.
+     *
+     * @param previous_chunk_size: the size of the previous chunk (0 if none)
+     * @param remaining: the number of bytes that remain to be transferred
+     * @param buffer_size: the buffer size
+     * @param max_chunk_size: the maximum chunk size (as returned by getMaxChunkSize())
+     * @return a chunk size in bytes
+     */
+    sg_size_t FileTransferThread::getNextChunkSize(sg_size_t previous_chunk_size, sg_size_t remaining, sg_size_t buffer_size, sg_size_t max_chunk_size) {
+        if (buffer_size == 0) {
+            return remaining;
+        }
+        // Ramp up: at most twice the previous chunk size
+        sg_size_t chunk_size = std::max<sg_size_t>(buffer_size, std::min<sg_size_t>(max_chunk_size, 2 * previous_chunk_size));
+        // Ramp down: at most half the remaining bytes
+        sg_size_t ramp_down_chunk_size = buffer_size;
+        while ((ramp_down_chunk_size <= remaining / 4) and (ramp_down_chunk_size <= max_chunk_size / 2)) {
+            ramp_down_chunk_size *= 2;
+        }
+        return std::min<sg_size_t>({chunk_size, ramp_down_chunk_size, remaining});
+    }
+
     /**
      * @brief Main method
      * @return 0 on success, non-zero otherwise
@@ -325,9 +376,9 @@ namespace wrench {
                     if (!dst_ss) {
                         throw std::runtime_error("FileTransferThread::receiveFileFromNetwork(): Storage Service should be a SimpleStorageService for disk write");
                     }
-                    int unique_disk_sequence_number_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload);
+                    auto disk_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload);
                     this->dst_opened_file->write(msg->payload);
-                    this->simulation_->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload, unique_disk_sequence_number_write);
+                    this->simulation_->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload, disk_write);
 //                        simulation->writeToDisk(msg->payload, location->getStorageService()->hostname,
 //                                                dst_location->getDiskOrNull());
 #ifdef PAGE_CACHE_SIMULATION
@@ -364,9 +415,9 @@ namespace wrench {
                     throw std::runtime_error("FileTransferThread::receiveFileFromNetwork(): Writing to disk can only be to a SimpleStorageService");
                 }
 //                    simulation->writeToDisk(msg->payload, ss->hostname, location->getDiskOrNull());
-                int unique_disk_sequence_number_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, this->dst_opened_file->get_path(), msg->payload);
+                auto disk_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, this->dst_opened_file->get_path(), msg->payload);
                 this->dst_opened_file->write(msg->payload);
-                this->simulation_->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), _hostname, this->dst_opened_file->get_path(), msg->payload, unique_disk_sequence_number_write);
+                this->simulation_->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), _hostname, this->dst_opened_file->get_path(), msg->payload, disk_write);
 
 
 #ifdef PAGE_CACHE_SIMULATION
@@ -407,6 +458,8 @@ namespace wrench {
                 std::shared_ptr<S4U_PendingCommunication> req = nullptr;
                 // Sending a zero-byte f is really sending a 1-byte f
                 sg_size_t remaining = std::max<sg_size_t>(1, num_bytes);
+                sg_size_t max_chunk_size = getMaxChunkSize(remaining, this->buffer_size, this->coalesce_data_chunks);
+                sg_size_t chunk_size = 0;
 
 
 #ifdef PAGE_CACHE_SIMULATION
@@ -416,7 +469,7 @@ namespace wrench {
 #endif
 
                 while (remaining > 0) {
-                    sg_size_t chunk_size = std::min<sg_size_t>(this->buffer_size, remaining);
+                    chunk_size = getNextChunkSize(chunk_size, remaining, this->buffer_size, max_chunk_size);
 
 #ifdef PAGE_CACHE_SIMULATION
                     if (Simulation::isPageCachingEnabled()) {
@@ -429,9 +482,9 @@ namespace wrench {
                         throw std::runtime_error("FileTransferThread::receiveFileFromNetwork(): Writing to disk can only be to a SimpleStorageService");
                     }
 //                        simulation->readFromDisk(chunk_size, ss->hostname, location->getDiskOrNull());
-                    int unique_disk_sequence_number_read = this->simulation_->getOutput().addTimestampDiskReadStart(Simulation::getCurrentSimulatedDate(), _hostname, src_opened_file->get_path(), chunk_size);
+                    auto disk_read = this->simulation_->getOutput().addTimestampDiskReadStart(Simulation::getCurrentSimulatedDate(), _hostname, src_opened_file->get_path(), chunk_size);
                     this->src_opened_file->read(chunk_size);
-                    this->simulation_->getOutput().addTimestampDiskReadCompletion(Simulation::getCurrentSimulatedDate(), _hostname, src_opened_file->get_path(), chunk_size, unique_disk_sequence_number_read);
+                    this->simulation_->getOutput().addTimestampDiskReadCompletion(Simulation::getCurrentSimulatedDate(), _hostname, src_opened_file->get_path(), chunk_size, disk_read);
 #ifdef PAGE_CACHE_SIMULATION
                     }
 #endif
@@ -487,14 +540,16 @@ namespace wrench {
 
         // Read the first chunk
         sg_size_t remaining = f->getSize();
+        sg_size_t max_chunk_size = getMaxChunkSize(remaining, this->buffer_size, this->coalesce_data_chunks);
+        sg_size_t to_read = 0;
         while (remaining > 0) {
-            sg_size_t to_read = std::min<sg_size_t>(remaining, this->buffer_size);
-            int unique_disk_sequence_number_read = this->simulation_->getOutput().addTimestampDiskReadStart(Simulation::getCurrentSimulatedDate(), _hostname, src_opened_file->get_path(), to_read);
+            to_read = getNextChunkSize(to_read, remaining, this->buffer_size, max_chunk_size);
+            auto disk_read = this->simulation_->getOutput().addTimestampDiskReadStart(Simulation::getCurrentSimulatedDate(), _hostname, src_opened_file->get_path(), to_read);
             src_opened_file->read(to_read);
-            this->simulation_->getOutput().addTimestampDiskReadCompletion(Simulation::getCurrentSimulatedDate(), _hostname, src_opened_file->get_path(), to_read, unique_disk_sequence_number_read);
-            int unique_disk_sequence_number_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), to_read);
+            this->simulation_->getOutput().addTimestampDiskReadCompletion(Simulation::getCurrentSimulatedDate(), _hostname, src_opened_file->get_path(), to_read, disk_read);
+            auto disk_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), to_read);
             dst_opened_file->write(to_read);
-            this->simulation_->getOutput().addTimestampDiskReadCompletion(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), to_read, unique_disk_sequence_number_write);
+            this->simulation_->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), to_read, disk_write);
             remaining -= to_read;
         }
     }
@@ -588,9 +643,9 @@ namespace wrench {
 //                    simulation->writeToDisk(msg->payload,
 //                                            dst_ss->getHostname(),
 //                                            dst_loc->getDiskOrNull());
-                int unique_disk_sequence_number_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload);
+                auto disk_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload);
                 dst_opened_file->write(msg->payload);
-                this->simulation_->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload, unique_disk_sequence_number_write);
+                this->simulation_->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload, disk_write);
 
 #ifdef PAGE_CACHE_SIMULATION
                 }
@@ -618,9 +673,9 @@ namespace wrench {
 //                simulation->writeToDisk(msg->payload,
 //                                        dst_ss->getHostname(),
 //                                        dst_loc->getDiskOrNull());
-            int unique_disk_sequence_number_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload);
+            auto disk_write = this->simulation_->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload);
             dst_opened_file->write(msg->payload);
-            this->simulation_->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload, unique_disk_sequence_number_write);
+            this->simulation_->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), _hostname, dst_opened_file->get_path(), msg->payload, disk_write);
 
 #ifdef PAGE_CACHE_SIMULATION
             }
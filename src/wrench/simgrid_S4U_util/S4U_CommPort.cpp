@@ -85,28 +85,28 @@ namespace wrench {
 
     /**
      * @brief Helper method that avoids calling WRENCH_DEBUG from a .h file and do the logging for the templated getMessage() method.
-     * It also has the added bonus of checking for inheritance
+     * The type name is only demangled if debug logging is enabled.
      *
-     * @param type: a pointer to the message so we have its type
+     * @param type: the message type
      * @param id: an integer id
      *
      */
-    void S4U_CommPort::templateWaitingLog(const std::string &type, unsigned long long id) {
+    void S4U_CommPort::templateWaitingLog(const std::type_info &type, unsigned long long id) {
 
-        WRENCH_DEBUG("Waiting for message of type <%s> from commport '%s'.  Request ID: %llu", type.c_str(), this->get_cname(), id);
+        WRENCH_DEBUG("Waiting for message of type <%s> from commport '%s'.  Request ID: %llu", boost::core::demangle(type.name()).c_str(), this->get_cname(), id);
     }
 
     /**
      * @brief Helper method that avoids calling WRENCH_DEBUG from a .h file and do the logging for the templated getMessage() method.
-     * It also has the added bonus of checking for inheritance.
+     * The type name is only demangled if debug logging is enabled.
      *
-     * @param type: a pointer to the message so we have its type
+     * @param type: the message type
      * @param id: an integer id
      *
      */
-    void S4U_CommPort::templateWaitingLogUpdate(const std::string &type, unsigned long long id) {
+    void S4U_CommPort::templateWaitingLogUpdate(const std::type_info &type, unsigned long long id) {
 
-        WRENCH_DEBUG("Received a message of type <%s> from commport '%s'.  Request ID: %llu", type.c_str(), this->get_cname(), id);
+        WRENCH_DEBUG("Received a message of type <%s> from commport '%s'.  Request ID: %llu", boost::core::demangle(type.name()).c_str(), this->get_cname(), id);
     }
 
     /**
@@ -555,11 +555,14 @@ namespace wrench {
         try {
             this->is_running = true;
             this->s4u_simulation->runSimulation();
-            wrench::FileLocation::file_location_map.clear();
+            if (this->getOutput().getTraceSink()) {
+                this->getOutput().getTraceSink()->flush();
+            }
+            wrench::FileLocation::clearFileLocations();
             //            Service::deleteLifeSaversOfAutorestartServices();
             this->is_running = false;
         } catch (std::runtime_error &) {
-            wrench::FileLocation::file_location_map.clear();
+            wrench::FileLocation::clearFileLocations();
             //            Service::deleteLifeSaversOfAutorestartServices();
             this->is_running = false;
             throw;
@@ -819,15 +822,15 @@ namespace wrench {
      */
     void Simulation::readFromDisk(sg_size_t num_bytes, const std::string &hostname, simgrid::s4u::Disk *disk) {
         std::string mount_point = disk->get_property("mount");
-        int unique_disk_sequence_number_read = this->getOutput().addTimestampDiskReadStart(Simulation::getCurrentSimulatedDate(), hostname, mount_point, num_bytes);
+        auto disk_read = this->getOutput().addTimestampDiskReadStart(Simulation::getCurrentSimulatedDate(), hostname, mount_point, num_bytes);
         try {
             S4U_Simulation::readFromDisk(num_bytes, hostname, mount_point, disk);
         } catch (const std::invalid_argument &) {
             this->getOutput().addTimestampDiskReadFailure(Simulation::getCurrentSimulatedDate(), hostname, mount_point, num_bytes,
-                                                          unique_disk_sequence_number_read);
+                                                          disk_read);
             throw;
         }
-        this->getOutput().addTimestampDiskReadCompletion(Simulation::getCurrentSimulatedDate(), hostname, mount_point, num_bytes, unique_disk_sequence_number_read);
+        this->getOutput().addTimestampDiskReadCompletion(Simulation::getCurrentSimulatedDate(), hostname, mount_point, num_bytes, disk_read);
     }
 
     /**
@@ -847,22 +850,22 @@ namespace wrench {
         std::string read_mount_point = src_disk->get_property("mount");
         std::string write_mount_point = dst_disk->get_property("mount");
 
-        int unique_disk_sequence_number_read = this->getOutput().addTimestampDiskReadStart(Simulation::getCurrentSimulatedDate(), hostname, read_mount_point, num_bytes_to_read);
-        int unique_disk_sequence_number_write = this->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), hostname, write_mount_point, num_bytes_to_write);
+        auto disk_read = this->getOutput().addTimestampDiskReadStart(Simulation::getCurrentSimulatedDate(), hostname, read_mount_point, num_bytes_to_read);
+        auto disk_write = this->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), hostname, write_mount_point, num_bytes_to_write);
         try {
             S4U_Simulation::readFromDiskAndWriteToDiskConcurrently(num_bytes_to_read, num_bytes_to_write, hostname,
                                                                    read_mount_point, write_mount_point, src_disk, dst_disk);
         } catch (const std::invalid_argument &) {
             this->getOutput().addTimestampDiskWriteFailure(Simulation::getCurrentSimulatedDate(), hostname, write_mount_point, num_bytes_to_write,
-                                                           unique_disk_sequence_number_write);
+                                                           disk_write);
             this->getOutput().addTimestampDiskReadFailure(Simulation::getCurrentSimulatedDate(), hostname, read_mount_point, num_bytes_to_read,
-                                                          unique_disk_sequence_number_read);
+                                                          disk_read);
             throw;
         }
         this->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), hostname, write_mount_point, num_bytes_to_write,
-                                                          unique_disk_sequence_number_write);
+                                                          disk_write);
         this->getOutput().addTimestampDiskReadCompletion(Simulation::getCurrentSimulatedDate(), hostname, read_mount_point, num_bytes_to_read,
-                                                         unique_disk_sequence_number_read);
+                                                         disk_read);
     }
 
     /**
@@ -875,16 +878,16 @@ namespace wrench {
      */
     void Simulation::writeToDisk(sg_size_t num_bytes, const std::string &hostname, simgrid::s4u::Disk *disk) {
         std::string mount_point = disk->get_property("mount");
-        int unique_disk_sequence_number_write = this->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), hostname, mount_point, num_bytes);
+        auto disk_write = this->getOutput().addTimestampDiskWriteStart(Simulation::getCurrentSimulatedDate(), hostname, mount_point, num_bytes);
         try {
             S4U_Simulation::writeToDisk(num_bytes, hostname, mount_point, disk);
         } catch (const std::invalid_argument &) {
             this->getOutput().addTimestampDiskWriteFailure(Simulation::getCurrentSimulatedDate(), hostname, mount_point, num_bytes,
-                                                           unique_disk_sequence_number_write);
+                                                           disk_write);
             throw;
         }
         this->getOutput().addTimestampDiskWriteCompletion(Simulation::getCurrentSimulatedDate(), hostname, mount_point, num_bytes,
-                                                          unique_disk_sequence_number_write);
+                                                          disk_write);
     }
 
 #ifdef PAGE_CACHE_SIMULATION
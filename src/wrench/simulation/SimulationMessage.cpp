@@ -11,6 +11,7 @@
 #include <wrench/logging/TerminalOutput.h>
 #include <wrench/simulation/SimulationMessage.h>
 #include <typeinfo>
+#include <vector>
 #include <boost/core/demangle.hpp>
 
 WRENCH_LOG_CATEGORY(wrench_core_simulation_message, "Log category for SimulationMessage");
@@ -18,6 +19,91 @@ WRENCH_LOG_CATEGORY(wrench_core_simulation_message, "Log category for Simulation
 
 namespace wrench {
 
+    /**
+     * @brief A pool of memory blocks for messages, with one free list per (rounded-up) block size, so that
+     *        the many short-lived control messages exchanged between services don't go through the
+     *        general-purpose allocator
+     */
+    class SimulationMessagePool {
+    public:
+        /** @brief The block size granularity */
+        static constexpr std::size_t GRANULARITY = 16;
+        /** @brief The largest pooled block size (larger messages aren't pooled) */
+        static constexpr std::size_t MAX_POOLED_SIZE = 512;
+        /** @brief The maximum number of free blocks kept for each block size */
+        static constexpr std::size_t MAX_FREE_BLOCKS = 4096;
+
+        /**
+         * @brief Get the pool (which is never destroyed, as messages may be deleted during static destruction)
+         * @return the pool
+         */
+        static SimulationMessagePool &get() {
+            static auto pool = new SimulationMessagePool();
+            return *pool;
+        }
+
+        /**
+         * @brief Allocate a block
+         * @param size: the block size
+         * @return a pointer to the block
+         */
+        void *allocate(std::size_t size) {
+            if (size > MAX_POOLED_SIZE) {
+                return ::operator new(size);
+            }
+            auto &free_blocks = this->free_lists[bucket(size)];
+            if (free_blocks.empty()) {
+                return ::operator new(bucket(size) * GRANULARITY);
+            }
+            auto block = free_blocks.back();
+            free_blocks.pop_back();
+            return block;
+        }
+
+        /**
+         * @brief Release a block
+         * @param block: a pointer to the block
+         * @param size: the block size
+         */
+        void release(void *block, std::size_t size) {
+            if (size <= MAX_POOLED_SIZE) {
+                auto &free_blocks = this->free_lists[bucket(size)];
+                if (free_blocks.size() < MAX_FREE_BLOCKS) {
+                    free_blocks.push_back(block);
+                    return;
+                }
+            }
+            ::operator delete(block);
+        }
+
+    private:
+        static std::size_t bucket(std::size_t size) {
+            return (size + GRANULARITY - 1) / GRANULARITY;
+        }
+
+        std::vector<void *> free_lists[MAX_POOLED_SIZE / GRANULARITY + 1];
+    };
+
+    /**
+     * @brief Allocate memory for a message (from the message pool)
+     * @param size: the message size in memory
+     * @return a pointer to the allocated memory
+     */
+    void *SimulationMessage::operator new(std::size_t size) {
+        return SimulationMessagePool::get().allocate(size);
+    }
+
+    /**
+     * @brief Release the memory of a message (to the message pool)
+     * @param ptr: a pointer to the memory
+     * @param size: the message size in memory
+     */
+    void SimulationMessage::operator delete(void *ptr, std::size_t size) {
+        if (ptr) {
+            SimulationMessagePool::get().release(ptr, size);
+        }
+    }
+
 
     SimulationMessage::~SimulationMessage() {
         UNTRACK_OBJECT("message");
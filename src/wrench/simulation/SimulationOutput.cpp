@@ -25,6 +25,10 @@
 #include <vector>
 #include <cmath>
 #include <unordered_set>
+#include <map>
+#include <queue>
+#include <set>
+#include <limits>
 
 #define DBL_EQUAL(x, y) (std::abs((x) - (y)) < 0.1)
 
@@ -264,173 +268,191 @@ namespace wrench {
 #endif
 
     /**
-     * @brief Determines if a point lies on a line segment.
-     * @param segment: pair of start and end points that make up the line segment
-     * @param point: point on a 1D plane
-     * @return bool
-     */
-    bool isPointOnSegment(const std::pair<unsigned long long, unsigned long long>& segment, unsigned long long point) {
-        return (point <= std::max(segment.first, segment.second) and point >= std::min(segment.first, segment.second));
-    }
-
-    /**
-     * @brief Determines if two line segments overlap along the x-axis and allows for a slight overlap.
-     * @param segment1: first segment
-     * @param segment2: second segment
-     * @return bool
+     * @brief Places the task executions on a host with a sweep line, in order of start date: the core
+     *        slots of the executions that have ended are released (using a min-heap of end dates), and
+     *        the current execution is placed at the lowest position at which enough contiguous core slots
+     *        are free. When core slots are too fragmented for that, a bounded local repair is attempted:
+     *        the running executions that use the lowest possible block of core slots are moved to other
+     *        core slots, which must not be used by any other execution during their whole lifetime. This
+     *        takes O(n log n + n * c) time for n executions on a host with c cores, plus O(m * c^3) time
+     *        per repair, where m is the number of executions that overlap in time with a moved execution,
+     *        but may fail to find a layout when one exists.
+     *
+     * @param executions: the task executions on a host, sorted by start date
+     * @return true if a layout was found, false otherwise
      */
-    bool isSegmentOverlappingXAxis(const std::pair<unsigned long long, unsigned long long>& segment1,
-                                   const std::pair<unsigned long long, unsigned long long>& segment2) {
-        // Note: EPSILON looks big because we "blow up" the floats by 10^9 to do all computations
-        //       with unsigned long longs instead of doubles (thus avoiding float comparison weirdness)
-        //       And the goal of this EPSILON is to capture the fact that this is for a visual display
+    bool sweepForLayout(std::vector<WorkflowTaskExecutionInstance *> &executions) {
+        // Note: the goal of this EPSILON is to capture the fact that this is for a visual display
         //       made up of pixels, thus we don't want to be too stringent in terms of overlaps
-        constexpr unsigned long long EPSILON = 1000 * 1000 * 10;
-        if (std::fabs(segment1.second - segment2.first) <= EPSILON or
-            std::fabs(segment2.second - segment1.first) <= EPSILON) {
-            return false;
-
-            // if any point of either segment lies within the other, we have overlap
-        } else if (isPointOnSegment(segment1, segment2.first) or isPointOnSegment(segment1, segment2.second) or
-                   isPointOnSegment(segment2, segment1.first) or isPointOnSegment(segment2, segment1.second)) {
-            return true;
-
-            // the two segments do not overlap
-        } else {
+        constexpr double EPSILON = 0.01;
+        constexpr size_t NO_EXECUTION = std::numeric_limits<size_t>::max();
+
+        // Executions are referred to by their index in the executions vector
+        typedef std::pair<double, size_t> RunningExecution;
+
+        // The execution that uses each core slot (NO_EXECUTION if the slot is free)
+        std::vector<size_t> slot_owners(executions.front()->host_num_cores, NO_EXECUTION);
+        std::priority_queue<RunningExecution, std::vector<RunningExecution>, std::greater<RunningExecution>> running;
+        std::set<size_t> running_indices;
+        // For each placed execution, the lowest index of an execution that was running when it was placed
+        // (so that all executions that overlap in time with it have at least that index)
+        std::vector<size_t> first_overlapping_indices;
+        first_overlapping_indices.reserve(executions.size());
+
+        auto overlap_in_slots = [](unsigned long long position1, unsigned long long num_cores1,
+                                   unsigned long long position2, unsigned long long num_cores2) {
+            return (position1 < position2 + num_cores2) and (position2 < position1 + num_cores1);
+        };
+
+        // Find the lowest position, away from some core slots, to which a running execution can be moved
+        auto find_new_position = [&](size_t moved_index, size_t num_placed,
+                                     unsigned long long avoided_position, unsigned long long avoided_num_cores,
+                                     unsigned long long &new_position) {
+            auto moved = executions.at(moved_index);
+            unsigned long long num_cores = moved->num_cores_allocated;
+            for (unsigned long long candidate = 0; candidate + num_cores <= slot_owners.size(); candidate++) {
+                if (overlap_in_slots(candidate, num_cores, avoided_position, avoided_num_cores)) {
+                    continue;
+                }
+                bool conflict = false;
+                for (size_t i = first_overlapping_indices.at(moved_index); i < num_placed; i++) {
+                    auto other = executions.at(i);
+                    if ((i != moved_index) and
+                        (other->whole_task.first + EPSILON < moved->getTaskEndTime()) and
+                        (moved->whole_task.first + EPSILON < other->getTaskEndTime()) and
+                        overlap_in_slots(candidate, num_cores, other->vertical_position, other->num_cores_allocated)) {
+                        conflict = true;
+                        break;
+                    }
+                }
+                if (not conflict) {
+                    new_position = candidate;
+                    return true;
+                }
+            }
             return false;
-        }
-    }
+        };
+
+        for (size_t index = 0; index < executions.size(); index++) {
+            auto execution = executions.at(index);
+
+            // Release the core slots of the executions that have ended
+            while (not running.empty() and running.top().first <= execution->whole_task.first + EPSILON) {
+                auto ended = executions.at(running.top().second);
+                running_indices.erase(running.top().second);
+                running.pop();
+                std::fill(slot_owners.begin() + ended->vertical_position,
+                          slot_owners.begin() + ended->vertical_position + ended->num_cores_allocated, NO_EXECUTION);
+            }
 
-    /**
-     * @brief Determines if two line segments overlap along the y-axis using exact values.
-     * @param segment1: first segment
-     * @param segment2: second segment
-     * @return bool
-     */
-    bool isSegmentOverlappingYAxis(const std::pair<unsigned long long, unsigned long long>& segment1,
-                                   const std::pair<unsigned long long, unsigned long long>& segment2) {
-        if (segment1.second == segment2.first or segment2.second == segment1.first) {
-            return false;
-            // if any point of either segment lies within the other, we have overlap
-        } else if (isPointOnSegment(segment1, segment2.first) or isPointOnSegment(segment1, segment2.second) or
-                   isPointOnSegment(segment2, segment1.first) or isPointOnSegment(segment2, segment1.second)) {
-            return true;
+            unsigned long long num_slots = slot_owners.size();
+            unsigned long long num_cores = execution->num_cores_allocated;
+            if (num_cores > num_slots) {
+                return false;
+            }
 
-            // the two segments do not overlap
-        } else {
-            return false;
-        }
-    }
+            // Find the lowest block of contiguous free core slots
+            unsigned long long position = 0;
+            unsigned long long num_free = 0;
+            for (unsigned long long slot = 0; slot < num_slots and num_free < num_cores; slot++) {
+                if (slot_owners[slot] != NO_EXECUTION) {
+                    position = slot + 1;
+                    num_free = 0;
+                } else {
+                    num_free++;
+                }
+            }
 
-    /**
-     * @brief Searches for a possible host utilization gantt chart layout and updates the data to include what vertical
-     *        position to plot each rectangle.
-     * 
-     * Recursive backtracking search for a valid gantt chart layout. This algorithm looks for a
-     *              vertical position to place each task execution event such that it doesn't overlap with
-     *              any other task.
-     *
-     * @param data: JSON workflow execution data
-     * @param index: the index of the workflow execution data up to where we would like to check for a valid layout
-     * @return bool
-     */
-    bool searchForLayout(std::vector<WorkflowTaskExecutionInstance> &data, std::size_t index) {
-        constexpr unsigned long long PRECISION = 1000 * 1000 * 1000;
-
-        WorkflowTaskExecutionInstance &current_execution_instance = data.at(index);
-
-        auto current_rect_x_range = std::pair<unsigned long long, unsigned long long>(
-                current_execution_instance.whole_task.first * PRECISION,
-                current_execution_instance.getTaskEndTime() * PRECISION);
-
-        unsigned long long num_cores_allocated = current_execution_instance.num_cores_allocated;
-        unsigned long long execution_host_num_cores = current_execution_instance.host_num_cores;
-        auto num_vertical_positions = execution_host_num_cores - num_cores_allocated + 1;
-
-        //      std::string spaces = "";
-        //      for (int i=0; i < index; i++) {
-        //        spaces += "  ";
-        //      }
-        //      std::cout << spaces + "task = " << index <<"\n";
-
-        /*
-         * For each possible vertical position that an event can be in, we perform a check to see that its vertical
-         * position doesn't make the event (a rectangle on the graph) overlap with any of the other events. If it does not
-         * overlap, then we can evaluate all events up to this one with the next event in the list (recursive call). If
-         * it does overlap, then we try another vertical position. If it doesn't overlap and this is the last item in the list,
-         * we have found a valid layout.
-         */
-        for (std::size_t vertical_position = 0; vertical_position < num_vertical_positions; ++vertical_position) {
-            // Set the vertical positions as we go so the entire graph layout is set when the function returns
-            current_execution_instance.vertical_position = vertical_position;
-
-            auto current_rect_y_range = std::pair<unsigned long long, unsigned long long>(
-                    vertical_position,
-                    vertical_position + num_cores_allocated);
-
-            //              std::cout << spaces + "  pos = " <<  vertical_position << "\n";
-            /*
-             * We check this current event's position against all other events that were added
-             * before it to make sure it doesn't overlap with any of those events.
-             */
-            bool has_overlap = false;
-            for (std::size_t i = 0; i < index; ++i) {
-                WorkflowTaskExecutionInstance other_execution_instance = data.at(i);
-
-                // Evaluate the current event's position only against others that occurred on the same host.
-                if (current_execution_instance.hostname == other_execution_instance.hostname) {
-                    auto other_rect_x_range = std::pair<unsigned long long, unsigned long long>(
-                            other_execution_instance.whole_task.first * PRECISION,
-                            other_execution_instance.getTaskEndTime() * PRECISION);
-
-                    auto other_rect_y_range = std::pair<unsigned long long, unsigned long long>(
-                            other_execution_instance.vertical_position,
-                            other_execution_instance.vertical_position + other_execution_instance.num_cores_allocated);
-
-                    /*
-                     * Check overlap for the x_ranges first. If there is no overlap, we can guarantee that the rectangles
-                     * will not overlap. If the x_ranges do overlap, then we need to evaluate the y_ranges for overlap.
-                     */
-                    if (isSegmentOverlappingXAxis(current_rect_x_range, other_rect_x_range)) {
-                        if (isSegmentOverlappingYAxis(current_rect_y_range, other_rect_y_range)) {
-                            has_overlap = true;
+            // Otherwise, find the lowest block of core slots that can be freed up by moving the
+            // running executions that use some of them
+            if (num_free < num_cores) {
+                bool repaired = false;
+                for (position = 0; position + num_cores <= num_slots; position++) {
+                    // The executions to move, with their current positions
+                    std::vector<std::pair<size_t, unsigned long long>> moves;
+                    for (unsigned long long slot = position; slot < position + num_cores; slot++) {
+                        if ((slot_owners[slot] != NO_EXECUTION) and (moves.empty() or (moves.back().first != slot_owners[slot]))) {
+                            moves.emplace_back(slot_owners[slot], executions.at(slot_owners[slot])->vertical_position);
+                        }
+                    }
+                    repaired = true;
+                    for (auto const &move: moves) {
+                        unsigned long long new_position;
+                        if (not find_new_position(move.first, index, position, num_cores, new_position)) {
+                            repaired = false;
                             break;
                         }
+                        executions.at(move.first)->vertical_position = new_position;
+                    }
+                    if (repaired) {
+                        for (auto const &move: moves) {
+                            auto moved = executions.at(move.first);
+                            std::fill(slot_owners.begin() + move.second,
+                                      slot_owners.begin() + move.second + moved->num_cores_allocated, NO_EXECUTION);
+                        }
+                        for (auto const &move: moves) {
+                            auto moved = executions.at(move.first);
+                            std::fill(slot_owners.begin() + moved->vertical_position,
+                                      slot_owners.begin() + moved->vertical_position + moved->num_cores_allocated, move.first);
+                        }
+                        break;
+                    }
+                    // Roll back
+                    for (auto const &move: moves) {
+                        executions.at(move.first)->vertical_position = move.second;
                     }
                 }
-            }
-
-            if (not has_overlap and index >= data.size() - 1) {
-                host_utilization_layout[current_execution_instance.task_id] = vertical_position;
-                return true;
-
-            } else if (not has_overlap) {
-                bool found_layout = searchForLayout(data, index + 1);
-
-                if (found_layout) {
-                    host_utilization_layout[current_execution_instance.task_id] = vertical_position;
-                    return true;
+                if (not repaired) {
+                    return false;
                 }
             }
+
+            std::fill(slot_owners.begin() + position, slot_owners.begin() + position + num_cores, index);
+            execution->vertical_position = position;
+            first_overlapping_indices.push_back(running_indices.empty() ? index : *running_indices.begin());
+            running.push(RunningExecution(execution->getTaskEndTime(), index));
+            running_indices.insert(index);
         }
-        return false;
+        return true;
     }
 
     /**
      * @brief Generates graph layout for host utilization and adds that information to the JSON object.
      * 
-     * Searches for a possible gantt chart layout to represent host utilization. If a layout is found
-     *              (no tasks overlap), then information about where to plot what is added to the JSON object. Note
+     * Computes a possible gantt chart layout to represent host utilization, i.e., a vertical position for each
+     *              task execution event such that no two events (rectangles on the graph) on a host overlap. Note
      *              that this is a possible layout and does not reflect what task ran on what core specifically. For
      *              example, we may hav a task that was allocated 2-cores on a idle 4-core host. The task, when plotted
      *              on the gantt chart may end up in 1 of 3 positions (using cores 0 and 1, 1 and 2, or 2 and 3).
+     *
+     * The layout of each host is computed with a sweep line, which takes polynomial time, but may
+     *              fail to find a layout when one exists if core slots are very fragmented.
+     *
      * @param data: JSON workflow execution data
      *
+     * @throw std::runtime_error if no layout was found (e.g., the host was oversubscribed)
      */
     void generateHostUtilizationGraphLayout(std::vector<WorkflowTaskExecutionInstance> &data) {
-        if (not searchForLayout(data, 0)) {
-            throw std::runtime_error(
-                    "SimulationOutput::generateHostUtilizationGraphLayout() could not find a valid layout.");
+        std::map<std::string, std::vector<WorkflowTaskExecutionInstance *>> executions_by_host;
+        for (auto &execution: data) {
+            executions_by_host[execution.hostname].push_back(&execution);
+        }
+
+        for (auto &host_executions: executions_by_host) {
+            auto &executions = host_executions.second;
+            std::stable_sort(executions.begin(), executions.end(),
+                             [](const WorkflowTaskExecutionInstance *a, const WorkflowTaskExecutionInstance *b) {
+                                 return a->whole_task.first < b->whole_task.first;
+                             });
+
+            if (not sweepForLayout(executions)) {
+                throw std::runtime_error(
+                        "SimulationOutput::generateHostUtilizationGraphLayout() could not find a valid layout.");
+            }
+
+            for (auto execution: executions) {
+                host_utilization_layout[execution->task_id] = execution->vertical_position;
+            }
         }
     }
 
@@ -494,11 +516,12 @@ namespace wrench {
       *     }
       * </pre>
       *
-      *   If generate_host_utilization_layout is set to true, a recursive function searches for a possible host
+      *   If generate_host_utilization_layout is set to true, a sweep line computes a possible host
       *   utilization layout where tasks are assumed to use contiguous numbers of cores on their execution hosts.
-      *   Note that each ComputeService does not enforce this, and such a layout may not exist for some workflow executions.
-      *   In this situation, the function will go through the entire search space until all possible layouts are evaluated.
-      *   For a large Workflow, this may take a very long time.
+      *   Note that each ComputeService does not enforce this, and such a layout may not exist for some workflow executions
+      *   (or may not be found if core usage on a host is very fragmented), in which case an exception is thrown. The
+      *   layout is computed in O(n log n + n * c) time for n task executions on a host with c cores, plus a polynomial-time local repair
+      *   whenever core usage is too fragmented to place a task execution.
       *
       *   If a host utilization layout is able to be generated, the 'vertical_position' values will be set for each task run,
       *   and the task can be plotted as a rectangle on a graph where the y-axis denotes the number of cores - 1, and the x-axis denotes the
@@ -522,63 +545,50 @@ namespace wrench {
                     "SimulationOutput::dumpWorkflowExecutionJSON() requires a valid workflow and file_path");
         }
 
-        auto tasks = workflow->getTasks();
+        auto const &tasks = workflow->getTaskMapView();
+
+        // When writing the file, task executions are streamed out one at a time (indented as they would be
+        // if the whole JSON document were built first), rather than being accumulated in memory
+        std::ofstream output;
         nlohmann::json task_json;
+        bool first_task_execution = true;
+        if (writing_file) {
+            output.open(file_path);
+            output << "{\n    \"workflow_execution\": {\n        \"tasks\": ";
+        }
 
-        auto read_start_timestamps = this->getTrace<SimulationTimestampFileReadStart>();
-        auto read_completion_timestamps = this->getTrace<wrench::SimulationTimestampFileReadCompletion>();
-        auto read_failure_timestamps = this->getTrace<wrench::SimulationTimestampFileReadFailure>();
+        std::vector<WorkflowTaskExecutionInstance> data;
 
-        auto write_start_timestamps = this->getTrace<SimulationTimestampFileWriteStart>();
-        auto write_completion_timestamps = this->getTrace<wrench::SimulationTimestampFileWriteCompletion>();
-        auto write_failure_timestamps = this->getTrace<wrench::SimulationTimestampFileWriteFailure>();
+        static const std::vector<TaskExecutionIOTimestamps> no_io_timestamps;
 
-        std::vector<WorkflowTaskExecutionInstance> data;
+        for (auto const &t: tasks) {
+            auto const &task = t.second;
+
+            // The file read/write timestamps of all attempted executions of the task
+            auto io_timestamps_it = this->task_io_timestamps.find(task);
+            auto const &io_timestamps = (io_timestamps_it == this->task_io_timestamps.end()) ? no_io_timestamps : io_timestamps_it->second;
 
-        for (auto const &task: tasks) {
             auto execution_history = task->getExecutionHistory();
             while (not execution_history.empty()) {
                 auto current_task_execution = execution_history.top();
-                WorkflowTaskExecutionInstance current_execution_instance;
-
-                current_execution_instance.task_id = task->getID();
+                auto attempt = execution_history.size() - 1;
 
-                for (auto &read_start_timestamp: read_start_timestamps) {
-                    if (read_start_timestamp->getContent()->getTask()->getID() ==
-                        current_execution_instance.task_id) {
-                        current_execution_instance.reads.emplace_back(
-                                read_start_timestamp->getContent()->getDate(),
-                                read_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                read_start_timestamp->getContent()->getFile()->getID());
+                nlohmann::json file_reads;
+                nlohmann::json file_writes;
+                if (attempt < io_timestamps.size()) {
+                    for (auto const &read_start_timestamp: io_timestamps[attempt].reads) {
+                        file_reads.push_back(nlohmann::json::object({{"end", read_start_timestamp->getEndpoint()->getDate()},
+                                                                     {"start", read_start_timestamp->getDate()},
+                                                                     {"id", read_start_timestamp->getFile()->getID()}}));
                     }
-                }
-
-                for (auto &write_start_timestamp: write_start_timestamps) {
-                    if (write_start_timestamp->getContent()->getTask()->getID() ==
-                        current_execution_instance.task_id) {
-                        current_execution_instance.writes.emplace_back(
-                                write_start_timestamp->getContent()->getDate(),
-                                write_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                write_start_timestamp->getContent()->getFile()->getID());
+                    for (auto const &write_start_timestamp: io_timestamps[attempt].writes) {
+                        file_writes.push_back(nlohmann::json::object({{"end", write_start_timestamp->getEndpoint()->getDate()},
+                                                                      {"start", write_start_timestamp->getDate()},
+                                                                      {"id", write_start_timestamp->getFile()->getID()}}));
                     }
                 }
 
-                nlohmann::json file_reads;
-                for (auto const &r: current_execution_instance.reads) {
-                    nlohmann::json file_read = nlohmann::json::object({{"end", std::get<1>(r)},
-                                                                       {"start", std::get<0>(r)},
-                                                                       {"id", std::get<2>(r)}});
-                    file_reads.push_back(file_read);
-                }
-
-                nlohmann::json file_writes;
-                for (auto const &r: current_execution_instance.writes) {
-                    nlohmann::json file_write = nlohmann::json::object({{"end", std::get<1>(r)},
-                                                                        {"start", std::get<0>(r)},
-                                                                        {"id", std::get<2>(r)}});
-                    file_writes.push_back(file_write);
-                }
-                task_json.push_back(
+                nlohmann::json task_execution_json =
                         {{"task_id", task->getID()},
                          {"color", task->getColor()},
                          {"execution_host", {{"hostname", current_task_execution.physical_execution_host}, {"flop_rate", Simulation::getHostFlopRate(current_task_execution.physical_execution_host)}, {"memory_manager_service", Simulation::getHostMemoryCapacity(current_task_execution.physical_execution_host)}, {"cores", Simulation::getHostNumCores(current_task_execution.physical_execution_host)}}},
@@ -588,84 +598,63 @@ namespace wrench {
                          {"compute", {{"start", current_task_execution.computation_start}, {"end", current_task_execution.computation_end}}},
                          {"write", file_writes},
                          {"failed", current_task_execution.task_failed},
-                         {"terminated", current_task_execution.task_terminated}});
-                execution_history.pop();
-            }
-        }
-
-        // For each attempted execution of a task, add a WorkflowTaskExecutionInstance to the list.
-        for (auto const &task: tasks) {
-            auto execution_history = task->getExecutionHistory();
+                         {"terminated", current_task_execution.task_terminated}};
 
-            while (not execution_history.empty()) {
-                auto current_task_execution = execution_history.top();
-
-                WorkflowTaskExecutionInstance current_execution_instance;
-
-                current_execution_instance.task_id = task->getID();
-
-                for (auto &read_start_timestamp: read_start_timestamps) {
-                    if (read_start_timestamp->getContent()->getTask()->getID() ==
-                        current_execution_instance.task_id) {
-                        current_execution_instance.reads.emplace_back(
-                                read_start_timestamp->getContent()->getDate(),
-                                read_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                read_start_timestamp->getContent()->getFile()->getID());
-                    }
+                if (writing_file) {
+                    std::string task_execution_string = task_execution_json.dump(4);
+                    boost::replace_all(task_execution_string, "\n", "\n            ");
+                    output << (first_task_execution ? "[\n            " : ",\n            ") << task_execution_string;
+                } else {
+                    task_json.push_back(std::move(task_execution_json));
                 }
+                first_task_execution = false;
 
-                for (auto &write_start_timestamp: write_start_timestamps) {
-                    if (write_start_timestamp->getContent()->getTask()->getID() ==
-                        current_execution_instance.task_id) {
-                        current_execution_instance.writes.emplace_back(
-                                write_start_timestamp->getContent()->getDate(),
-                                write_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                write_start_timestamp->getContent()->getFile()->getID());
-                    }
-                }
+                // For each attempted execution of a task, add a WorkflowTaskExecutionInstance to the list
+                if (generate_host_utilization_layout) {
+                    WorkflowTaskExecutionInstance current_execution_instance;
+
+                    current_execution_instance.task_id = task->getID();
 
-                current_execution_instance.hostname = current_task_execution.physical_execution_host;
-                current_execution_instance.host_flop_rate = Simulation::getHostFlopRate(
-                        current_task_execution.physical_execution_host);
-                current_execution_instance.host_memory = Simulation::getHostMemoryCapacity(
-                        current_task_execution.physical_execution_host);
-                current_execution_instance.host_num_cores = Simulation::getHostNumCores(
-                        current_task_execution.physical_execution_host);
+                    current_execution_instance.hostname = current_task_execution.physical_execution_host;
+                    current_execution_instance.host_flop_rate = Simulation::getHostFlopRate(
+                            current_task_execution.physical_execution_host);
+                    current_execution_instance.host_memory = Simulation::getHostMemoryCapacity(
+                            current_task_execution.physical_execution_host);
+                    current_execution_instance.host_num_cores = Simulation::getHostNumCores(
+                            current_task_execution.physical_execution_host);
 
-                current_execution_instance.num_cores_allocated = current_task_execution.num_cores_allocated;
-                current_execution_instance.vertical_position = 0;
+                    current_execution_instance.num_cores_allocated = current_task_execution.num_cores_allocated;
+                    current_execution_instance.vertical_position = 0;
 
-                current_execution_instance.whole_task = std::make_pair(current_task_execution.task_start,
-                                                                       current_task_execution.task_end);
-                current_execution_instance.compute = std::make_pair(current_task_execution.computation_start,
-                                                                    current_task_execution.computation_end);
+                    current_execution_instance.whole_task = std::make_pair(current_task_execution.task_start,
+                                                                           current_task_execution.task_end);
+                    current_execution_instance.compute = std::make_pair(current_task_execution.computation_start,
+                                                                        current_task_execution.computation_end);
 
-                current_execution_instance.failed = current_task_execution.task_failed;
-                current_execution_instance.terminated = current_task_execution.task_terminated;
+                    current_execution_instance.failed = current_task_execution.task_failed;
+                    current_execution_instance.terminated = current_task_execution.task_terminated;
 
-                data.push_back(current_execution_instance);
+                    data.push_back(current_execution_instance);
+                }
                 execution_history.pop();
             }
         }
 
-        // Set the "vertical position" of each WorkflowExecutionInstance, so we know where to plot each rectangle
-        if (generate_host_utilization_layout) {
-            generateHostUtilizationGraphLayout(data);
-            std::ofstream output("host_utilization_layout.json");
-            output << std::setw(4) << host_utilization_layout << std::endl;
+        if (writing_file) {
+            output << (first_task_execution ? "null" : "\n        ]") << "\n    }\n}" << std::endl;
             output.close();
+        } else {
+            nlohmann::json workflow_execution_json;
+            workflow_execution_json["tasks"] = task_json;
+            workflow_exec_json_part = workflow_execution_json;
         }
 
-        nlohmann::json workflow_execution_json;
-        nlohmann::json workflow_execution_json_single;
-        workflow_execution_json["tasks"] = task_json;
-        workflow_execution_json_single["workflow_execution"] = workflow_execution_json;
-        workflow_exec_json_part = workflow_execution_json;
-
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << workflow_execution_json_single << std::endl;
-            output.close();
+        // Set the "vertical position" of each WorkflowExecutionInstance, so we know where to plot each rectangle
+        if (generate_host_utilization_layout) {
+            generateHostUtilizationGraphLayout(data);
+            std::ofstream layout_output("host_utilization_layout.json");
+            layout_output << std::setw(4) << host_utilization_layout << std::endl;
+            layout_output.close();
         }
     }
 
@@ -696,7 +685,8 @@ namespace wrench {
         nlohmann::json tasks = nlohmann::json::array();
 
         // add the task vertices
-        for (const auto &task: workflow->getTasks()) {
+        for (const auto &t: workflow->getTaskMapView()) {
+            const auto &task = t.second;
             nlohmann::json files = nlohmann::json::array();
             for (const auto &f: task->getInputFiles()) {
                 files.push_back({{"link", "input"},
@@ -878,20 +868,16 @@ namespace wrench {
                     datum["wattage_off"] = std::string(wattage_off_value);
                 }
 
-                for (const auto &pstate_timestamp: this->getTrace<SimulationTimestampPstateSet>()) {
-                    if (host->get_name() == pstate_timestamp->getContent()->getHostname()) {
-                        datum["pstate_trace"].push_back(
-                                {{"time", pstate_timestamp->getDate()},
-                                 {"pstate", pstate_timestamp->getContent()->getPstate()}});
-                    }
+                for (const auto &pstate_timestamp: this->getTraceForHost<SimulationTimestampPstateSet>(host->get_name())) {
+                    datum["pstate_trace"].push_back(
+                            {{"time", pstate_timestamp->getDate()},
+                             {"pstate", pstate_timestamp->getContent()->getPstate()}});
                 }
 
-                for (const auto &energy_consumption_timestamp: this->getTrace<SimulationTimestampEnergyConsumption>()) {
-                    if (host->get_name() == energy_consumption_timestamp->getContent()->getHostname()) {
-                        datum["consumed_energy_trace"].push_back(
-                                {{"time", energy_consumption_timestamp->getDate()},
-                                 {"joules", energy_consumption_timestamp->getContent()->getConsumption()}});
-                    }
+                for (const auto &energy_consumption_timestamp: this->getTraceForHost<SimulationTimestampEnergyConsumption>(host->get_name())) {
+                    datum["consumed_energy_trace"].push_back(
+                            {{"time", energy_consumption_timestamp->getDate()},
+                             {"joules", energy_consumption_timestamp->getContent()->getConsumption()}});
                 }
 
                 hosts_energy_consumption_information.push_back(datum);
@@ -1234,13 +1220,13 @@ namespace wrench {
         }
         nlohmann::json disk_operations_json;
 
-        auto read_start_timestamps = this->getTrace<SimulationTimestampDiskReadStart>();
-        auto read_completion_timestamps = this->getTrace<wrench::SimulationTimestampDiskReadCompletion>();
-        auto read_failure_timestamps = this->getTrace<wrench::SimulationTimestampDiskReadFailure>();
+        auto read_start_timestamps = this->getTraceView<SimulationTimestampDiskReadStart>();
+        auto read_completion_timestamps = this->getTraceView<wrench::SimulationTimestampDiskReadCompletion>();
+        auto read_failure_timestamps = this->getTraceView<wrench::SimulationTimestampDiskReadFailure>();
 
-        auto write_start_timestamps = this->getTrace<SimulationTimestampDiskWriteStart>();
-        auto write_completion_timestamps = this->getTrace<wrench::SimulationTimestampDiskWriteCompletion>();
-        auto write_failure_timestamps = this->getTrace<wrench::SimulationTimestampDiskWriteFailure>();
+        auto write_start_timestamps = this->getTraceView<SimulationTimestampDiskWriteStart>();
+        auto write_completion_timestamps = this->getTraceView<wrench::SimulationTimestampDiskWriteCompletion>();
+        auto write_failure_timestamps = this->getTraceView<wrench::SimulationTimestampDiskWriteFailure>();
 
         std::set<std::string> hostnames;
 
@@ -1401,7 +1387,7 @@ namespace wrench {
             nlohmann::json datum;
             datum["linkname"] = link->get_name();
 
-            for (const auto &link_usage_timestamp: this->getTrace<SimulationTimestampLinkUsage>()) {
+            for (const auto &link_usage_timestamp: this->getTraceView<SimulationTimestampLinkUsage>()) {
                 if (link->get_name() == link_usage_timestamp->getContent()->getLinkname()) {
                     datum["link_usage_trace"].push_back(
                             {{"time", link_usage_timestamp->getDate()},
@@ -1428,12 +1414,7 @@ namespace wrench {
     /**
      * @brief Destructor
      */
-    SimulationOutput::~SimulationOutput() {
-        for (auto t: this->traces) {
-            delete t.second;
-        }
-        this->traces.clear();
-    }
+    SimulationOutput::~SimulationOutput() = default;
 
     /**
      * @brief Constructor
@@ -1484,21 +1465,25 @@ namespace wrench {
      * @brief Add a task start timestamp
      * @param date: the date
      * @param task: a workflow task
+     * @return the start timestamp, to be passed when adding the matching end timestamp (nullptr if disabled)
      */
-    void SimulationOutput::addTimestampTaskStart(double date, const std::shared_ptr<WorkflowTask> &task) {
+    SimulationTimestampTaskStart *SimulationOutput::addTimestampTaskStart(double date, const std::shared_ptr<WorkflowTask> &task) {
         if (this->isEnabled<SimulationTimestampTaskStart>()) {
-            this->addTimestamp<SimulationTimestampTaskStart>(new SimulationTimestampTaskStart(date, task));
+            return this->addTimestamp<SimulationTimestampTaskStart>(date, task);
         }
+        return nullptr;
     }
 
     /**
      * @brief Add a task start failure
      * @param date: the date
      * @param task: a workflow task
+     * @param start: the task start timestamp
      */
-    void SimulationOutput::addTimestampTaskFailure(double date, const std::shared_ptr<WorkflowTask> &task) {
+    void SimulationOutput::addTimestampTaskFailure(double date, const std::shared_ptr<WorkflowTask> &task,
+                                                   SimulationTimestampTaskStart *start) {
         if (this->isEnabled<SimulationTimestampTaskFailure>()) {
-            this->addTimestamp<SimulationTimestampTaskFailure>(new SimulationTimestampTaskFailure(date, task));
+            this->addTimestamp<SimulationTimestampTaskFailure>(date, task, start);
         }
     }
 
@@ -1506,10 +1491,12 @@ namespace wrench {
      * @brief Add a task start completion
      * @param date: the date
      * @param task: a workflow task
+     * @param start: the task start timestamp
      */
-    void SimulationOutput::addTimestampTaskCompletion(double date, const std::shared_ptr<WorkflowTask> &task) {
+    void SimulationOutput::addTimestampTaskCompletion(double date, const std::shared_ptr<WorkflowTask> &task,
+                                                      SimulationTimestampTaskStart *start) {
         if (this->isEnabled<SimulationTimestampTaskCompletion>()) {
-            this->addTimestamp<SimulationTimestampTaskCompletion>(new SimulationTimestampTaskCompletion(date, task));
+            this->addTimestamp<SimulationTimestampTaskCompletion>(date, task, start);
         }
     }
 
@@ -1517,10 +1504,12 @@ namespace wrench {
     * @brief Add a task start termination
     * @param date: the date
     * @param task: a workflow task
+    * @param start: the task start timestamp
     */
-    void SimulationOutput::addTimestampTaskTermination(double date, const std::shared_ptr<WorkflowTask> &task) {
+    void SimulationOutput::addTimestampTaskTermination(double date, const std::shared_ptr<WorkflowTask> &task,
+                                                       SimulationTimestampTaskStart *start) {
         if (this->isEnabled<SimulationTimestampTaskTermination>()) {
-            this->addTimestamp<SimulationTimestampTaskTermination>(new SimulationTimestampTaskTermination(date, task));
+            this->addTimestamp<SimulationTimestampTaskTermination>(date, task, start);
         }
     }
 
@@ -1531,16 +1520,21 @@ namespace wrench {
      * @param src: the source location
      * @param service: the source storage service
      * @param task: the workflow task for which this read is done (or nullptr);
+     * @return the start timestamp, to be passed when adding the matching end timestamp (nullptr if disabled)
      */
-    void SimulationOutput::addTimestampFileReadStart(double date,
-                                                     const std::shared_ptr<DataFile> &file,
-                                                     const std::shared_ptr<FileLocation> &src,
-                                                     const std::shared_ptr<StorageService> &service,
-                                                     std::shared_ptr<WorkflowTask> task) {
+    SimulationTimestampFileReadStart *SimulationOutput::addTimestampFileReadStart(double date,
+                                                                                  const std::shared_ptr<DataFile> &file,
+                                                                                  const std::shared_ptr<FileLocation> &src,
+                                                                                  const std::shared_ptr<StorageService> &service,
+                                                                                  std::shared_ptr<WorkflowTask> task) {
         if (this->isEnabled<SimulationTimestampFileReadStart>()) {
-            this->addTimestamp<SimulationTimestampFileReadStart>(
-                    new SimulationTimestampFileReadStart(date, file, src, service, std::move(task)));
+            auto timestamp = this->addTimestamp<SimulationTimestampFileReadStart>(date, file, src, service, task);
+            if (task) {
+                this->getTaskExecutionIOTimestamps(task).reads.push_back(timestamp);
+            }
+            return timestamp;
         }
+        return nullptr;
     }
 
     /**
@@ -1550,15 +1544,16 @@ namespace wrench {
     * @param src: the source location
     * @param service: the source storage service
     * @param task: the workflow task for which this read is done (or nullptr);
+    * @param start: the file read start timestamp
     */
     void SimulationOutput::addTimestampFileReadFailure(double date,
                                                        const std::shared_ptr<DataFile> &file,
                                                        const std::shared_ptr<FileLocation> &src,
                                                        const std::shared_ptr<StorageService> &service,
-                                                       std::shared_ptr<WorkflowTask> task) {
+                                                       std::shared_ptr<WorkflowTask> task,
+                                                       SimulationTimestampFileReadStart *start) {
         if (this->isEnabled<SimulationTimestampFileReadFailure>()) {
-            this->addTimestamp<SimulationTimestampFileReadFailure>(
-                    new SimulationTimestampFileReadFailure(date, file, src, service, std::move(task)));
+            this->addTimestamp<SimulationTimestampFileReadFailure>(date, file, src, service, std::move(task), start);
         }
     }
 
@@ -1569,16 +1564,17 @@ namespace wrench {
     * @param src: the source location
     * @param service: the source storage service
     * @param task: the workflow task for which this read is done (or nullptr);
+    * @param start: the file read start timestamp
     */
     void
     SimulationOutput::addTimestampFileReadCompletion(double date,
                                                      const std::shared_ptr<DataFile> &file,
                                                      const std::shared_ptr<FileLocation> &src,
                                                      const std::shared_ptr<StorageService> &service,
-                                                     std::shared_ptr<WorkflowTask> task) {
+                                                     std::shared_ptr<WorkflowTask> task,
+                                                     SimulationTimestampFileReadStart *start) {
         if (this->isEnabled<SimulationTimestampFileReadCompletion>()) {
-            this->addTimestamp<SimulationTimestampFileReadCompletion>(
-                    new SimulationTimestampFileReadCompletion(date, file, src, service, std::move(task)));
+            this->addTimestamp<SimulationTimestampFileReadCompletion>(date, file, src, service, std::move(task), start);
         }
     }
 
@@ -1589,16 +1585,21 @@ namespace wrench {
      * @param src: the target location
      * @param service: the target storage service
      * @param task: the workflow task for which this write is done (or nullptr);
+     * @return the start timestamp, to be passed when adding the matching end timestamp (nullptr if disabled)
      */
-    void SimulationOutput::addTimestampFileWriteStart(double date,
-                                                      const std::shared_ptr<DataFile> &file,
-                                                      const std::shared_ptr<FileLocation> &src,
-                                                      const std::shared_ptr<StorageService> &service,
-                                                      std::shared_ptr<WorkflowTask> task) {
+    SimulationTimestampFileWriteStart *SimulationOutput::addTimestampFileWriteStart(double date,
+                                                                                    const std::shared_ptr<DataFile> &file,
+                                                                                    const std::shared_ptr<FileLocation> &src,
+                                                                                    const std::shared_ptr<StorageService> &service,
+                                                                                    std::shared_ptr<WorkflowTask> task) {
         if (this->isEnabled<SimulationTimestampFileWriteStart>()) {
-            this->addTimestamp<SimulationTimestampFileWriteStart>(
-                    new SimulationTimestampFileWriteStart(date, file, src, service, std::move(task)));
+            auto timestamp = this->addTimestamp<SimulationTimestampFileWriteStart>(date, file, src, service, task);
+            if (task) {
+                this->getTaskExecutionIOTimestamps(task).writes.push_back(timestamp);
+            }
+            return timestamp;
         }
+        return nullptr;
     }
 
     /**
@@ -1608,15 +1609,16 @@ namespace wrench {
     * @param src: the target location
     * @param service: the target storage service
     * @param task: the workflow task for which this write is done (or nullptr);
+    * @param start: the file write start timestamp
     */
     void SimulationOutput::addTimestampFileWriteFailure(double date,
                                                         const std::shared_ptr<DataFile> &file,
                                                         const std::shared_ptr<FileLocation> &src,
                                                         const std::shared_ptr<StorageService> &service,
-                                                        std::shared_ptr<WorkflowTask> task) {
+                                                        std::shared_ptr<WorkflowTask> task,
+                                                        SimulationTimestampFileWriteStart *start) {
         if (this->isEnabled<SimulationTimestampFileWriteFailure>()) {
-            this->addTimestamp<SimulationTimestampFileWriteFailure>(
-                    new SimulationTimestampFileWriteFailure(date, file, src, service, std::move(task)));
+            this->addTimestamp<SimulationTimestampFileWriteFailure>(date, file, src, service, std::move(task), start);
         }
     }
 
@@ -1627,16 +1629,17 @@ namespace wrench {
     * @param src: the target location
     * @param service: the target storage service
     * @param task: the workflow task for which this write is done (or nullptr);
+    * @param start: the file write start timestamp
     */
     void
     SimulationOutput::addTimestampFileWriteCompletion(double date,
                                                       const std::shared_ptr<DataFile> &file,
                                                       const std::shared_ptr<FileLocation> &src,
                                                       const std::shared_ptr<StorageService> &service,
-                                                      std::shared_ptr<WorkflowTask> task) {
+                                                      std::shared_ptr<WorkflowTask> task,
+                                                      SimulationTimestampFileWriteStart *start) {
         if (this->isEnabled<SimulationTimestampFileWriteCompletion>()) {
-            this->addTimestamp<SimulationTimestampFileWriteCompletion>(
-                    new SimulationTimestampFileWriteCompletion(date, file, src, service, std::move(task)));
+            this->addTimestamp<SimulationTimestampFileWriteCompletion>(date, file, src, service, std::move(task), start);
         }
     }
 
@@ -1646,14 +1649,16 @@ namespace wrench {
      * @param file: a workflow file
      * @param src: the source location
      * @param dst: the target location
+     * @return the start timestamp, to be passed when adding the matching end timestamp (nullptr if disabled)
      */
-    void SimulationOutput::addTimestampFileCopyStart(double date,
-                                                     const std::shared_ptr<DataFile> &file,
-                                                     const std::shared_ptr<FileLocation> &src,
-                                                     const std::shared_ptr<FileLocation> &dst) {
+    SimulationTimestampFileCopyStart *SimulationOutput::addTimestampFileCopyStart(double date,
+                                                                                  const std::shared_ptr<DataFile> &file,
+                                                                                  const std::shared_ptr<FileLocation> &src,
+                                                                                  const std::shared_ptr<FileLocation> &dst) {
         if (this->isEnabled<SimulationTimestampFileCopyStart>()) {
-            this->addTimestamp<SimulationTimestampFileCopyStart>(new SimulationTimestampFileCopyStart(date, file, src, dst));
+            return this->addTimestamp<SimulationTimestampFileCopyStart>(date, file, src, dst);
         }
+        return nullptr;
     }
 
     /**
@@ -1662,14 +1667,15 @@ namespace wrench {
      * @param file: a workflow file
      * @param src: the source location
      * @param dst: the target location
+     * @param start: the file copy start timestamp
      */
     void SimulationOutput::addTimestampFileCopyFailure(double date,
                                                        const std::shared_ptr<DataFile> &file,
                                                        const std::shared_ptr<FileLocation> &src,
-                                                       const std::shared_ptr<FileLocation> &dst) {
+                                                       const std::shared_ptr<FileLocation> &dst,
+                                                       SimulationTimestampFileCopyStart *start) {
         if (this->isEnabled<SimulationTimestampFileCopyFailure>()) {
-            this->addTimestamp<SimulationTimestampFileCopyFailure>(
-                    new SimulationTimestampFileCopyFailure(date, file, src, dst));
+            this->addTimestamp<SimulationTimestampFileCopyFailure>(date, file, src, dst, start);
         }
     }
 
@@ -1679,14 +1685,15 @@ namespace wrench {
      * @param file: a workflow file
      * @param src: the source location
      * @param dst: the target location
+     * @param start: the file copy start timestamp
      */
     void SimulationOutput::addTimestampFileCopyCompletion(double date,
                                                           std::shared_ptr<DataFile> file,
                                                           std::shared_ptr<FileLocation> src,
-                                                          std::shared_ptr<FileLocation> dst) {
+                                                          std::shared_ptr<FileLocation> dst,
+                                                          SimulationTimestampFileCopyStart *start) {
         if (this->isEnabled<SimulationTimestampFileCopyCompletion>()) {
-            this->addTimestamp<SimulationTimestampFileCopyCompletion>(
-                    new SimulationTimestampFileCopyCompletion(date, std::move(file), std::move(src), std::move(dst)));
+            this->addTimestamp<SimulationTimestampFileCopyCompletion>(date, std::move(file), std::move(src), std::move(dst), start);
         }
     }
 
@@ -1696,18 +1703,23 @@ namespace wrench {
      * @param hostname: hostname being read from
      * @param path: the path
      * @param bytes: number of bytes read
-     * @return a unique integer id
+     * @return a handle, to be passed when adding the matching end timestamp
      */
-    int SimulationOutput::addTimestampDiskReadStart(double date,
-                                                     std::string hostname,
-                                                     std::string path,
-                                                     sg_size_t bytes) {
+    SimulationOutput::DiskReadTimestampHandle SimulationOutput::addTimestampDiskReadStart(double date,
+                                                                                          std::string hostname,
+                                                                                          std::string path,
+                                                                                          sg_size_t bytes) {
+        DiskReadTimestampHandle handle;
         if (this->isEnabled<SimulationTimestampDiskReadStart>()) {
-            SimulationOutput::unique_disk_sequence_number++;
-            this->addTimestamp<SimulationTimestampDiskReadStart>(
-                    new SimulationTimestampDiskReadStart(date, std::move(hostname), std::move(path), bytes, SimulationOutput::unique_disk_sequence_number));
+            handle.unique_sequence_number = ++SimulationOutput::unique_disk_sequence_number;
+            if (this->trace_sink) {
+                handle.streamed = true;
+                handle.start_date = date;
+            } else {
+                handle.start = this->addTimestamp<SimulationTimestampDiskReadStart>(date, std::move(hostname), std::move(path), bytes, handle.unique_sequence_number);
+            }
         }
-        return SimulationOutput::unique_disk_sequence_number;
+        return handle;
     }
 
     /**
@@ -1716,15 +1728,20 @@ namespace wrench {
      * @param hostname: hostname being read from
      * @param path: the path
      * @param bytes: number of bytes read
-     * @param unique_sequence_number: an integer id
+     * @param handle: the handle returned when the start timestamp was added
      */
     void SimulationOutput::addTimestampDiskReadFailure(double date, const std::string &hostname,
                                                        const std::string &path,
                                                        sg_size_t bytes,
-                                                       int unique_sequence_number) {
+                                                       const DiskReadTimestampHandle &handle) {
         if (this->isEnabled<SimulationTimestampDiskReadFailure>()) {
-            this->addTimestamp<SimulationTimestampDiskReadFailure>(
-                    new SimulationTimestampDiskReadFailure(date, hostname, path, bytes, unique_sequence_number));
+            if (handle.streamed) {
+                if (this->trace_sink) {
+                    this->trace_sink->recordDiskRead(handle.unique_sequence_number, hostname, path, handle.start_date, date, (double) bytes, true);
+                }
+            } else {
+                this->addTimestamp<SimulationTimestampDiskReadFailure>(date, hostname, path, bytes, handle.unique_sequence_number, handle.start);
+            }
         }
     }
 
@@ -1734,15 +1751,20 @@ namespace wrench {
      * @param hostname: hostname being read from
      * @param path: the path
      * @param bytes: number of bytes read
-     * @param unique_sequence_number: an integer id
+     * @param handle: the handle returned when the start timestamp was added
      */
     void SimulationOutput::addTimestampDiskReadCompletion(double date, const std::string &hostname,
                                                           const std::string &path,
                                                           sg_size_t bytes,
-                                                          int unique_sequence_number) {
+                                                          const DiskReadTimestampHandle &handle) {
         if (this->isEnabled<SimulationTimestampDiskReadCompletion>()) {
-            this->addTimestamp<SimulationTimestampDiskReadCompletion>(
-                    new SimulationTimestampDiskReadCompletion(date, hostname, path, bytes, unique_sequence_number));
+            if (handle.streamed) {
+                if (this->trace_sink) {
+                    this->trace_sink->recordDiskRead(handle.unique_sequence_number, hostname, path, handle.start_date, date, (double) bytes, false);
+                }
+            } else {
+                this->addTimestamp<SimulationTimestampDiskReadCompletion>(date, hostname, path, bytes, handle.unique_sequence_number, handle.start);
+            }
         }
     }
 
@@ -1752,17 +1774,22 @@ namespace wrench {
      * @param hostname: hostname being read from
      * @param path: the path
      * @param bytes: number of bytes read
-     * @return a unique integer id
+     * @return a handle, to be passed when adding the matching end timestamp
      */
-    int SimulationOutput::addTimestampDiskWriteStart(double date, std::string hostname,
-                                                      const std::string& path,
-                                                      sg_size_t bytes) {
+    SimulationOutput::DiskWriteTimestampHandle SimulationOutput::addTimestampDiskWriteStart(double date, std::string hostname,
+                                                                                            const std::string &path,
+                                                                                            sg_size_t bytes) {
+        DiskWriteTimestampHandle handle;
         if (this->isEnabled<SimulationTimestampDiskWriteStart>()) {
-            SimulationOutput::unique_disk_sequence_number++;
-            this->addTimestamp<SimulationTimestampDiskWriteStart>(
-                    new SimulationTimestampDiskWriteStart(date, std::move(hostname), path, bytes, SimulationOutput::unique_disk_sequence_number));
+            handle.unique_sequence_number = ++SimulationOutput::unique_disk_sequence_number;
+            if (this->trace_sink) {
+                handle.streamed = true;
+                handle.start_date = date;
+            } else {
+                handle.start = this->addTimestamp<SimulationTimestampDiskWriteStart>(date, std::move(hostname), path, bytes, handle.unique_sequence_number);
+            }
         }
-        return SimulationOutput::unique_disk_sequence_number;
+        return handle;
     }
 
     /**
@@ -1771,15 +1798,20 @@ namespace wrench {
      * @param hostname: hostname being read from
      * @param path: the path
      * @param bytes: number of bytes read
-     * @param unique_sequence_number: an integer id
+     * @param handle: the handle returned when the start timestamp was added
      */
     void SimulationOutput::addTimestampDiskWriteFailure(double date, const std::string &hostname,
                                                         const std::string &path,
                                                         sg_size_t bytes,
-                                                        int unique_sequence_number) {
+                                                        const DiskWriteTimestampHandle &handle) {
         if (this->isEnabled<SimulationTimestampDiskWriteFailure>()) {
-            this->addTimestamp<SimulationTimestampDiskWriteFailure>(
-                    new SimulationTimestampDiskWriteFailure(date, hostname, path, bytes, unique_sequence_number));
+            if (handle.streamed) {
+                if (this->trace_sink) {
+                    this->trace_sink->recordDiskWrite(handle.unique_sequence_number, hostname, path, handle.start_date, date, (double) bytes, true);
+                }
+            } else {
+                this->addTimestamp<SimulationTimestampDiskWriteFailure>(date, hostname, path, bytes, handle.unique_sequence_number, handle.start);
+            }
         }
     }
 
@@ -1789,15 +1821,20 @@ namespace wrench {
     * @param hostname: hostname being read from
     * @param path: the path
     * @param bytes: number of bytes read
-    * @param unique_sequence_number: an integer id
+    * @param handle: the handle returned when the start timestamp was added
     */
     void SimulationOutput::addTimestampDiskWriteCompletion(double date, const std::string &hostname,
                                                            const std::string &path,
                                                            sg_size_t bytes,
-                                                           int unique_sequence_number) {
+                                                           const DiskWriteTimestampHandle &handle) {
         if (this->isEnabled<SimulationTimestampDiskWriteCompletion>()) {
-            this->addTimestamp<SimulationTimestampDiskWriteCompletion>(
-                    new SimulationTimestampDiskWriteCompletion(date, hostname, path, bytes, unique_sequence_number));
+            if (handle.streamed) {
+                if (this->trace_sink) {
+                    this->trace_sink->recordDiskWrite(handle.unique_sequence_number, hostname, path, handle.start_date, date, (double) bytes, false);
+                }
+            } else {
+                this->addTimestamp<SimulationTimestampDiskWriteCompletion>(date, hostname, path, bytes, handle.unique_sequence_number, handle.start);
+            }
         }
     }
 
@@ -1810,7 +1847,11 @@ namespace wrench {
     void SimulationOutput::addTimestampPstateSet(double date, const std::string &hostname,
                                                  int pstate) {
         if (this->isEnabled<SimulationTimestampPstateSet>()) {
-            this->addTimestamp<SimulationTimestampPstateSet>(new SimulationTimestampPstateSet(date, hostname, pstate));
+            if (this->trace_sink) {
+                this->trace_sink->recordPstateSet(date, hostname, pstate);
+            } else {
+                this->addTimestamp<SimulationTimestampPstateSet>(date, hostname, pstate);
+            }
         }
     }
 
@@ -1828,27 +1869,30 @@ namespace wrench {
             return;
         }
 
-        auto new_timestamp = new SimulationTimestampEnergyConsumption(date, hostname, joules);
+        // Measurements are streamed as is (merging is done when the JSON output is reconstructed)
+        if (this->trace_sink) {
+            this->trace_sink->recordEnergyConsumption(date, hostname, joules);
+            return;
+        }
+
+        auto &last_two = last_two_timestamps[hostname];
 
         // If less thant 2 time-stamp for that host, just record and add
-        if (last_two_timestamps[hostname].size() < 2) {
-            last_two_timestamps[hostname].push_back(new_timestamp);
-            this->addTimestamp<SimulationTimestampEnergyConsumption>(new_timestamp);
+        if (last_two.size() < 2) {
+            last_two.push_back(this->addTimestamp<SimulationTimestampEnergyConsumption>(date, hostname, joules));
             return;
         }
 
-        // Otherwise, check whether we can merge
-        bool can_merge = DBL_EQUAL(last_two_timestamps[hostname].at(0)->getConsumption(),
-                                   last_two_timestamps[hostname].at(1)->getConsumption()) and
-                         DBL_EQUAL(last_two_timestamps[hostname].at(1)->getConsumption(),
-                                   new_timestamp->getConsumption());
+        // Otherwise, check whether we can merge (before constructing anything)
+        bool can_merge = DBL_EQUAL(last_two.at(0)->getConsumption(), last_two.at(1)->getConsumption()) and
+                         DBL_EQUAL(last_two.at(1)->getConsumption(), joules);
 
         if (can_merge) {
-            last_two_timestamps[hostname].at(1)->setDate(new_timestamp->getDate());
+            // Through the trace, so that it knows that the timestamp's date has changed
+            std::get<SimulationTrace<SimulationTimestampEnergyConsumption>>(this->traces).setTimestampDate(last_two.at(1), date);
         } else {
-            last_two_timestamps[hostname][0] = last_two_timestamps[hostname][1];
-            last_two_timestamps[hostname][1] = new_timestamp;
-            this->addTimestamp<SimulationTimestampEnergyConsumption>(new_timestamp);
+            last_two[0] = last_two[1];
+            last_two[1] = this->addTimestamp<SimulationTimestampEnergyConsumption>(date, hostname, joules);
         }
     }
 
@@ -1866,26 +1910,30 @@ namespace wrench {
             return;
         }
 
-        auto new_timestamp = new SimulationTimestampLinkUsage(date, link_name, bytes_per_second);
+        // Measurements are streamed as is (merging is done when the JSON output is reconstructed)
+        if (this->trace_sink) {
+            this->trace_sink->recordLinkUsage(date, link_name, bytes_per_second);
+            return;
+        }
+
+        auto &last_two = last_two_timestamps[link_name];
 
         // If less thant 2 time-stamp for that link, just record and add
-        if (last_two_timestamps[link_name].size() < 2) {
-            last_two_timestamps[link_name].push_back(new_timestamp);
-            this->addTimestamp<SimulationTimestampLinkUsage>(new_timestamp);
+        if (last_two.size() < 2) {
+            last_two.push_back(this->addTimestamp<SimulationTimestampLinkUsage>(date, link_name, bytes_per_second));
             return;
         }
 
-        // Otherwise, check whether we can merge
-        bool can_merge = DBL_EQUAL(last_two_timestamps[link_name].at(0)->getUsage(),
-                                   last_two_timestamps[link_name].at(1)->getUsage()) and
-                         DBL_EQUAL(last_two_timestamps[link_name].at(1)->getUsage(), new_timestamp->getUsage());
+        // Otherwise, check whether we can merge (before constructing anything)
+        bool can_merge = DBL_EQUAL(last_two.at(0)->getUsage(), last_two.at(1)->getUsage()) and
+                         DBL_EQUAL(last_two.at(1)->getUsage(), bytes_per_second);
 
         if (can_merge) {
-            last_two_timestamps[link_name].at(1)->setDate(new_timestamp->getDate());
+            // Through the trace, so that it knows that the timestamp's date has changed
+            std::get<SimulationTrace<SimulationTimestampLinkUsage>>(this->traces).setTimestampDate(last_two.at(1), date);
         } else {
-            last_two_timestamps[link_name][0] = last_two_timestamps[link_name][1];
-            last_two_timestamps[link_name][1] = new_timestamp;
-            this->addTimestamp<SimulationTimestampLinkUsage>(new_timestamp);
+            last_two[0] = last_two[1];
+            last_two[1] = this->addTimestamp<SimulationTimestampLinkUsage>(date, link_name, bytes_per_second);
         }
     }
 
@@ -1951,4 +1999,38 @@ namespace wrench {
         this->setEnabled<SimulationTimestampLinkUsage>(true);
     }
 
+    /**
+     * @brief Set a sink to which disk, pstate, energy consumption and link usage timestamps
+     *        are streamed during the simulation, instead of being kept in memory. These timestamps are
+     *        then not included in the simulation output traces, nor in the JSON files written by the
+     *        dump methods. Disk operations are streamed once they have completed or failed. Timestamps
+     *        must still be enabled (e.g., see enableDiskTimestamps()) to be streamed.
+     * @param sink: a trace sink (or nullptr to keep all timestamps in memory)
+     */
+    void SimulationOutput::setTraceSink(std::shared_ptr<SimulationTraceSink> sink) {
+        this->trace_sink = std::move(sink);
+    }
+
+    /**
+     * @brief Get the trace sink to which timestamps are streamed
+     * @return a trace sink, or nullptr if none
+     */
+    std::shared_ptr<SimulationTraceSink> SimulationOutput::getTraceSink() const {
+        return this->trace_sink;
+    }
+
+    /**
+     * @brief Get the file read/write start timestamps of the current execution attempt of a task
+     * @param task: a workflow task
+     * @return the timestamps of the task's current execution attempt
+     */
+    SimulationOutput::TaskExecutionIOTimestamps &SimulationOutput::getTaskExecutionIOTimestamps(const std::shared_ptr<WorkflowTask> &task) {
+        auto &attempts = this->task_io_timestamps[task];
+        auto num_attempts = std::max<unsigned long>(task->getNumberOfExecutionAttempts(), 1);
+        if (attempts.size() < num_attempts) {
+            attempts.resize(num_attempts);
+        }
+        return attempts[num_attempts - 1];
+    }
+
 }// namespace wrench
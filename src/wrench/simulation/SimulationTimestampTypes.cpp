@@ -28,6 +28,17 @@ namespace wrench {
         this->date = d;
     }
 
+    /**
+     * @brief Intern a string (e.g., a hostname, a mount point, a link name), so that timestamps
+     *        store a pointer to a single shared copy of each distinct string
+     * @param string: a string
+     * @return a pointer to the interned string, which remains valid for the whole execution
+     */
+    const std::string *SimulationTimestampType::internString(const std::string &string) {
+        static std::unordered_set<std::string> interned_strings;
+        return &(*interned_strings.insert(string).first);
+    }
+
     /**
      * @brief Constructor
      */
@@ -52,6 +63,24 @@ namespace wrench {
         return this->endpoint;
     }
 
+    /**
+     * @brief Sets the endpoint of the calling object (a failure/completion/termination timestamp) to the
+     *        start timestamp it ends, and vice versa
+     * @param start: the start timestamp, as returned when it was added to the simulation output
+     */
+    void SimulationTimestampPair::setEndpoints(SimulationTimestampPair *start) {
+        if (start == nullptr) {
+            throw std::runtime_error(
+                    "SimulationTimestampPair::setEndpoints(): no start timestamp to match (were start timestamps disabled?)");
+        }
+        if (start->endpoint != nullptr) {
+            throw std::runtime_error(
+                    "SimulationTimestampPair::setEndpoints(): start timestamp has already been matched with an end timestamp");
+        }
+        this->endpoint = start;
+        start->endpoint = this;
+    }
+
     /**
      * @brief Constructor
      * @param date: the date
@@ -83,35 +112,6 @@ namespace wrench {
         return dynamic_cast<SimulationTimestampTask *>(this->endpoint);
     }
 
-    /**
-     * @brief A static map of SimulationTimestampTaskStart objects that have yet to matched with SimulationTimestampTaskFailure, SimulationTimestampTaskTerminated, SimulationTimestampTaskCompletion timestamps
-     */
-    std::map<std::string, SimulationTimestampTask *> SimulationTimestampTask::pending_task_timestamps;
-
-
-    /**
-     * @brief Sets the endpoint of the calling object (SimulationTimestampTaskFailure, SimulationTimestampTaskTerminated, SimulationTimestampTaskStart) with a SimulationTimestampTaskStart object
-     */
-    void SimulationTimestampTask::setEndpoints() {
-        // find the SimulationTimestampTaskStart object containing the same task
-        auto pending_tasks_itr = pending_task_timestamps.find(this->task->getID());
-
-        if (pending_tasks_itr != pending_task_timestamps.end()) {
-            // set my endpoint to the SimulationTimestampTaskStart
-            this->endpoint = (*pending_tasks_itr).second;
-
-            // set the SimulationTimestampTaskStart's endpoint to me
-            (*pending_tasks_itr).second->endpoint = this;
-
-            // the SimulationTimestampTaskStart is no longer waiting to be matched with an end timestamp, remove it from the map
-            pending_task_timestamps.erase(pending_tasks_itr);
-        } else {
-            throw std::runtime_error(
-                    "SimulationTimestampTask::setEndpoints() could not find a SimulationTimestampTaskStart object with taskID: " +
-                    this->task->getID());
-        }
-    }
-
     /**
      * @brief Constructor
      * @param date: the date
@@ -126,20 +126,15 @@ namespace wrench {
                     "SimulationTimestampTaskStart::SimulationTimestampTaskStart() requires a valid pointer to a WorkflowTask object");
         }
 #endif
-
-        /*
-         * Upon creation, this object adds a pointer of itself to the 'pending_task_timestamps' map so that it's endpoint can
-         * be set when a SimulationTimestampTaskFailure, SimulationTimestampTaskTerminated, or SimulationTimestampTaskCompletion is created
-         */
-        pending_task_timestamps.insert(std::make_pair(task->getID(), this));
     }
 
     /**
      * @brief Constructor
      * @param date: the date
      * @param task: the WorkflowTask associated with this timestamp
+     * @param start: the matching start timestamp
      */
-    SimulationTimestampTaskFailure::SimulationTimestampTaskFailure(double date, const std::shared_ptr<WorkflowTask> &task) : SimulationTimestampTask(date, task) {
+    SimulationTimestampTaskFailure::SimulationTimestampTaskFailure(double date, const std::shared_ptr<WorkflowTask> &task, SimulationTimestampTaskStart *start) : SimulationTimestampTask(date, task) {
         WRENCH_DEBUG("Inserting a TaskFailure timestamp for task '%s'", task->getID().c_str());
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -150,15 +145,16 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampTaskStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
      * @brief Constructor
      * @param date: the date
      * @param task: the WorkflowTask associated with this timestamp
+     * @param start: the matching start timestamp
      */
-    SimulationTimestampTaskCompletion::SimulationTimestampTaskCompletion(double date, const std::shared_ptr<WorkflowTask> &task) : SimulationTimestampTask(date, task) {
+    SimulationTimestampTaskCompletion::SimulationTimestampTaskCompletion(double date, const std::shared_ptr<WorkflowTask> &task, SimulationTimestampTaskStart *start) : SimulationTimestampTask(date, task) {
         WRENCH_DEBUG("Inserting a TaskCompletion timestamp for task '%s'", task->getID().c_str());
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -169,15 +165,16 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampTaskStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
      * @brief Constructor
      * @param date: the date
      * @param task: the WorkflowTask associated with this timestamp
+     * @param start: the matching start timestamp
      */
-    SimulationTimestampTaskTermination::SimulationTimestampTaskTermination(double date, const std::shared_ptr<WorkflowTask> &task)
+    SimulationTimestampTaskTermination::SimulationTimestampTaskTermination(double date, const std::shared_ptr<WorkflowTask> &task, SimulationTimestampTaskStart *start)
         : SimulationTimestampTask(date, task) {
         WRENCH_DEBUG("Inserting a TaskTerminated timestamp for task '%s'", task->getID().c_str());
 
@@ -189,7 +186,7 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampTaskStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -229,7 +226,6 @@ namespace wrench {
         return this->destination;
     }
 
-
     /**
      * @brief retrieves the corresponding SimulationTimestampFileCopy object
      * @return a pointer to the start or end SimulationTimestampFileCopy object
@@ -238,32 +234,6 @@ namespace wrench {
         return dynamic_cast<SimulationTimestampFileCopy *>(this->endpoint);
     }
 
-    /**
-    * @brief A static unordered multimap of SimulationTimestampFileCopyStart objects that have yet to be matched with Failure, Terminated or Completion timestamps
-    */
-    std::unordered_multimap<FileCopy, SimulationTimestampFileCopy *> SimulationTimestampFileCopy::pending_file_copies;
-
-
-    /**
-     * @brief Sets the endpoint of the calling object (SimulationTimestampFileCopyFailure, SimulationTimestampFileCopyCompletion, SimulationTimestampFileCopyStart) with a SimulationTimestampFileCopyStart object
-     */
-    void SimulationTimestampFileCopy::setEndpoints() {
-        auto pending_copies_itr = pending_file_copies.find(FileCopy(this->file, this->source, this->destination));
-        if (pending_copies_itr != pending_file_copies.end()) {
-            // set my endpoint to the SimulationTimestampFileCopyStart
-            this->endpoint = (*pending_copies_itr).second;
-
-            // set the SimulationTimestampFileCopyStart's endpoint to me
-            (*pending_copies_itr).second->endpoint = this;
-
-            // the SimulationTimestampFileCopyStart is no longer waiting to be matched with an end timestamp, remove it from the map
-            pending_file_copies.erase(pending_copies_itr);
-        } else {
-            throw std::runtime_error(
-                    "SimulationTimestampFileCopy::setEndpoints() could not find a SimulationTimestampFileCopyStart object.");
-        }
-    }
-
     /**
      * @brief Constructor
      * @param date: the date
@@ -283,8 +253,6 @@ namespace wrench {
                     "SimulationTimestampFileCopyStart::SimulationTimestampFileCopyStart() cannot take nullptr arguments");
         }
 #endif
-
-        pending_file_copies.insert(std::make_pair(FileCopy(this->file, this->source, this->destination), this));
     }
 
     /**
@@ -293,10 +261,12 @@ namespace wrench {
      * @param file: A workflow file
      * @param src: the source location
      * @param dst: the destination location
+     * @param start: the matching start timestamp
      */
     SimulationTimestampFileCopyFailure::SimulationTimestampFileCopyFailure(double date, std::shared_ptr<DataFile> file,
                                                                            std::shared_ptr<FileLocation> src,
-                                                                           std::shared_ptr<FileLocation> dst) : SimulationTimestampFileCopy(date, std::move(file), std::move(src), std::move(dst)) {
+                                                                           std::shared_ptr<FileLocation> dst,
+                                                                           SimulationTimestampFileCopyStart *start) : SimulationTimestampFileCopy(date, std::move(file), std::move(src), std::move(dst)) {
         WRENCH_DEBUG("Inserting a FileCopyFailure timestamp for file copy");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -307,7 +277,7 @@ namespace wrench {
         }
 #endif
 
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -316,10 +286,12 @@ namespace wrench {
      * @param file: a workflow file
      * @param src: the source location
      * @param dst: the destination location
+     * @param start: the matching start timestamp
      */
     SimulationTimestampFileCopyCompletion::SimulationTimestampFileCopyCompletion(double date, std::shared_ptr<DataFile> file,
                                                                                  std::shared_ptr<FileLocation> src,
-                                                                                 std::shared_ptr<FileLocation> dst) : SimulationTimestampFileCopy(date, std::move(file), std::move(src), std::move(dst)) {
+                                                                                 std::shared_ptr<FileLocation> dst,
+                                                                                 SimulationTimestampFileCopyStart *start) : SimulationTimestampFileCopy(date, std::move(file), std::move(src), std::move(dst)) {
         WRENCH_DEBUG("Inserting a FileCopyCompletion timestamp for file copy");
 
         // Making this an internal exception causes problems, because sometimes the exception
@@ -332,7 +304,7 @@ namespace wrench {
         }
         //#endif
 
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -390,32 +362,6 @@ namespace wrench {
         return dynamic_cast<SimulationTimestampFileRead *>(this->endpoint);
     }
 
-    /**
-     * @brief A static unordered multimap of SimulationTimestampFileReadStart objects that have yet to be matched with Failure, Terminated or Completion timestamps
-     */
-    std::unordered_multimap<FileReadWrite, std::pair<SimulationTimestampFileRead *, std::shared_ptr<WorkflowTask>>> SimulationTimestampFileRead::pending_file_reads;
-
-    /**
-     * @brief Sets the endpoint of the calling object (SimulationTimestampFileReadFailure, SimulationTimestampFileReadTerminated, SimulationTimestampFileReadStart) with a SimulationTimestampFileReadStart object
-     */
-    void SimulationTimestampFileRead::setEndpoints() {
-        // find the SimulationTimestampFileRead object containing the same task
-        auto pending_reads_itr = pending_file_reads.find(FileReadWrite(this->file, this->source, this->service));
-        if (pending_reads_itr != pending_file_reads.end()) {
-            // set my endpoint to the SimulationTimestampFileReadStart
-            this->endpoint = (*pending_reads_itr).second.first;
-
-            // set the SimulationTimestampFileReadStart's endpoint to me
-            (*pending_reads_itr).second.first->endpoint = this;
-
-            // the SimulationTimestampFileReadStart is no longer waiting to be matched with an end timestamp, remove it from the map
-            pending_file_reads.erase(pending_reads_itr);
-        } else {
-            throw std::runtime_error(
-                    "SimulationTimestampFileRead::setEndpoints() could not find a SimulationTimestampFileReadStart object.");
-        }
-    }
-
     /**
      * @brief Constructor
      * @param date: the date
@@ -438,9 +384,6 @@ namespace wrench {
                     "SimulationTimestampFileReadStart::SimulationTimestampFileReadStart() cannot take nullptr arguments");
         }
 #endif
-
-
-        pending_file_reads.insert(std::make_pair(FileReadWrite(this->file, this->source, this->service), std::make_pair(this, this->task)));
     }
 
     /**
@@ -450,11 +393,13 @@ namespace wrench {
      * @param src: the source location
      * @param service: service requesting file read
      * @param task: a workflow task associated to this file read
+     * @param start: the matching start timestamp
      */
     SimulationTimestampFileReadFailure::SimulationTimestampFileReadFailure(double date, const std::shared_ptr<DataFile> &file,
                                                                            const std::shared_ptr<FileLocation> &src,
                                                                            const std::shared_ptr<StorageService> &service,
-                                                                           std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileRead(date, file, src, service, std::move(task)) {
+                                                                           std::shared_ptr<WorkflowTask> task,
+                                                                           SimulationTimestampFileReadStart *start) : SimulationTimestampFileRead(date, file, src, service, std::move(task)) {
         WRENCH_DEBUG("Inserting a FileReadFailure timestamp for file read");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -465,7 +410,7 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampFileReadStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -475,11 +420,13 @@ namespace wrench {
      * @param src: the source location
      * @param service: service requesting file read
      * @param task: a task associated to  this file read (or nullptr)
+     * @param start: the matching start timestamp
      */
     SimulationTimestampFileReadCompletion::SimulationTimestampFileReadCompletion(double date, const std::shared_ptr<DataFile> &file,
                                                                                  const std::shared_ptr<FileLocation> &src,
                                                                                  const std::shared_ptr<StorageService> &service,
-                                                                                 std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileRead(date, file, src, service, std::move(task)) {
+                                                                                 std::shared_ptr<WorkflowTask> task,
+                                                                                 SimulationTimestampFileReadStart *start) : SimulationTimestampFileRead(date, file, src, service, std::move(task)) {
         WRENCH_DEBUG("Inserting a FileReadCompletion timestamp for file read");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -490,7 +437,7 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampFileReadStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -549,32 +496,6 @@ namespace wrench {
         return dynamic_cast<SimulationTimestampFileWrite *>(this->endpoint);
     }
 
-    /**
-     * @brief A static unordered multimap of SimulationTimestampFileWriteStart objects that have yet to be matched with Failure, Terminated or Completion timestamps
-     */
-    std::unordered_multimap<FileReadWrite, std::pair<SimulationTimestampFileWrite *, std::shared_ptr<WorkflowTask>>> SimulationTimestampFileWrite::pending_file_writes;
-
-    /**
-     * @brief Sets the endpoint of the calling object (SimulationTimestampFileWriteFailure, SimulationTimestampFileWriteTerminated, SimulationTimestampFileWriteStart) with a SimulationTimestampFileWriteStart object
-     */
-    void SimulationTimestampFileWrite::setEndpoints() {
-        // find the SimulationTimestampFileWrite object containing the same task
-        auto pending_writes_itr = pending_file_writes.find(FileReadWrite(this->file, this->destination, this->service));
-        if (pending_writes_itr != pending_file_writes.end()) {
-            // set my endpoint to the SimulationTimestampFileWriteStart
-            this->endpoint = (*pending_writes_itr).second.first;
-
-            // set the SimulationTimestampFileWriteStart's endpoint to me
-            (*pending_writes_itr).second.first->endpoint = this;
-
-            // the SimulationTimestampFileWriteStart is no longer waiting to be matched with an end timestamp, remove it from the map
-            pending_file_writes.erase(pending_writes_itr);
-        } else {
-            throw std::runtime_error(
-                    "SimulationTimestampFileWrite::setEndpoints() could not find a SimulationTimestampFileWriteStart object.");
-        }
-    }
-
     /**
      * @brief Constructor
      * @param date: the date
@@ -600,9 +521,6 @@ namespace wrench {
                     "SimulationTimestampFileWriteStart::SimulationTimestampFileWriteStart() cannot take nullptr arguments");
         }
 #endif
-
-
-        pending_file_writes.insert(std::make_pair(FileReadWrite(this->file, this->destination, this->service), std::make_pair(this, this->task)));
     }
 
     /**
@@ -612,11 +530,13 @@ namespace wrench {
      * @param dst: the destination location
      * @param service: service requesting file write
      * @param task: the workflow task
+     * @param start: the matching start timestamp
      */
     SimulationTimestampFileWriteFailure::SimulationTimestampFileWriteFailure(double date, const std::shared_ptr<DataFile> &file,
                                                                              const std::shared_ptr<FileLocation> &dst,
                                                                              const std::shared_ptr<StorageService> &service,
-                                                                             std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileWrite(date, file, dst, service, std::move(task)) {
+                                                                             std::shared_ptr<WorkflowTask> task,
+                                                                             SimulationTimestampFileWriteStart *start) : SimulationTimestampFileWrite(date, file, dst, service, std::move(task)) {
         WRENCH_DEBUG("Inserting a FileWriteFailure timestamp for file write");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -627,7 +547,7 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampFileWriteStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -637,11 +557,13 @@ namespace wrench {
      * @param dst: the destination location
      * @param service: service requesting file write
      * @param task: a workfow task associated to this file write
+     * @param start: the matching start timestamp
      */
     SimulationTimestampFileWriteCompletion::SimulationTimestampFileWriteCompletion(double date, const std::shared_ptr<DataFile> &file,
                                                                                    const std::shared_ptr<FileLocation> &dst,
                                                                                    const std::shared_ptr<StorageService> &service,
-                                                                                   std::shared_ptr<WorkflowTask> task) : SimulationTimestampFileWrite(date, file, dst, service, std::move(task)) {
+                                                                                   std::shared_ptr<WorkflowTask> task,
+                                                                                   SimulationTimestampFileWriteStart *start) : SimulationTimestampFileWrite(date, file, dst, service, std::move(task)) {
         WRENCH_DEBUG("Inserting a FileWriteCompletion timestamp for file write");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -652,7 +574,7 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampFileWriteStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -667,7 +589,7 @@ namespace wrench {
                                                              std::string hostname,
                                                              std::string mount,
                                                              sg_size_t bytes,
-                                                             int counter) : hostname(std::move(hostname)), mount(std::move(mount)), bytes(bytes), counter(counter) {
+                                                             int counter) : hostname(internString(hostname)), mount(internString(mount)), bytes(bytes), counter(counter) {
         this->date = date;
     }
 
@@ -676,7 +598,7 @@ namespace wrench {
      * @return string of hostname
      */
     std::string SimulationTimestampDiskRead::getHostname() {
-        return this->hostname;
+        return *this->hostname;
     }
 
     /**
@@ -684,7 +606,7 @@ namespace wrench {
      * @return string of mount point
      */
     std::string SimulationTimestampDiskRead::getMount() {
-        return this->mount;
+        return *this->mount;
     }
 
     /**
@@ -711,32 +633,6 @@ namespace wrench {
         return dynamic_cast<SimulationTimestampDiskRead *>(this->endpoint);
     }
 
-    /**
-     * @brief A static unordered multimap of SimulationTimestampDiskReadStart objects that have yet to be matched with Failure, Terminated or Completion timestamps
-     */
-    std::unordered_multimap<DiskAccess, SimulationTimestampDiskRead *> SimulationTimestampDiskRead::pending_disk_reads;
-
-    /**
-     * @brief Sets the endpoint of the calling object (SimulationTimestampDiskReadFailure, SimulationTimestampDiskReadTerminated, SimulationTimestampDiskReadStart) with a SimulationTimestampDiskReadStart object
-     */
-    void SimulationTimestampDiskRead::setEndpoints() {
-        // find the SimulationTimestampDiskRead object containing the same task
-        auto pending_disk_reads_itr = pending_disk_reads.find(DiskAccess(this->hostname, this->mount, this->counter));
-        if (pending_disk_reads_itr != pending_disk_reads.end()) {
-            // set my endpoint to the SimulationTimestampDiskReadStart
-            this->endpoint = (*pending_disk_reads_itr).second;
-
-            // set the SimulationTimestampDiskReadStart's endpoint to me
-            (*pending_disk_reads_itr).second->endpoint = this;
-
-            // the SimulationTimestampDiskReadStart is no longer waiting to be matched with an end timestamp, remove it from the map
-            pending_disk_reads.erase(pending_disk_reads_itr);
-        } else {
-            throw std::runtime_error(
-                    "SimulationTimestampDiskRead::setEndpoints() could not find a SimulationTimestampDiskReadStart object.");
-        }
-    }
-
     /**
      * @brief Constructor
      * @param date: the date
@@ -753,14 +649,11 @@ namespace wrench {
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         // all information about a disk read should be passed
-        if (this->hostname.empty() || this->mount.empty()) {
+        if (this->hostname->empty() || this->mount->empty()) {
             throw std::invalid_argument(
                     "SimulationTimestampDiskReadStart::SimulationTimestampDiskReadStart() cannot take nullptr arguments");
         }
 #endif
-
-
-        pending_disk_reads.insert(std::make_pair(DiskAccess(this->hostname, this->mount, this->counter), this));
     }
 
     /**
@@ -770,11 +663,13 @@ namespace wrench {
      * @param mount: mount point of disk being read
      * @param bytes: number of bytes read
      * @param counter: an integer ID
+     * @param start: the matching start timestamp
      */
     SimulationTimestampDiskReadFailure::SimulationTimestampDiskReadFailure(double date, const std::string &hostname,
                                                                            const std::string &mount,
                                                                            sg_size_t bytes,
-                                                                           int counter) : SimulationTimestampDiskRead(date, hostname, mount, bytes, counter) {
+                                                                           int counter,
+                                                                           SimulationTimestampDiskReadStart *start) : SimulationTimestampDiskRead(date, hostname, mount, bytes, counter) {
         WRENCH_DEBUG("Inserting a DiskReadFailure timestamp for disk read");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -785,7 +680,7 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampDiskReadStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -795,12 +690,14 @@ namespace wrench {
      * @param mount: mount point of disk being read
      * @param bytes: number of bytes read
      * @param counter: an integer ID
+     * @param start: the matching start timestamp
      */
     SimulationTimestampDiskReadCompletion::SimulationTimestampDiskReadCompletion(double date,
                                                                                  const std::string &hostname,
                                                                                  const std::string &mount,
                                                                                  sg_size_t bytes,
-                                                                                 int counter) : SimulationTimestampDiskRead(date, hostname, mount, bytes, counter) {
+                                                                                 int counter,
+                                                                                 SimulationTimestampDiskReadStart *start) : SimulationTimestampDiskRead(date, hostname, mount, bytes, counter) {
         WRENCH_DEBUG("Inserting a DiskReadCompletion timestamp for disk read");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -811,7 +708,7 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampDiskReadStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -825,7 +722,7 @@ namespace wrench {
     SimulationTimestampDiskWrite::SimulationTimestampDiskWrite(double date, std::string hostname,
                                                                std::string mount,
                                                                sg_size_t bytes,
-                                                               int counter) : hostname(std::move(hostname)), mount(std::move(mount)), bytes(bytes), counter(counter) {
+                                                               int counter) : hostname(internString(hostname)), mount(internString(mount)), bytes(bytes), counter(counter) {
         this->date = date;
     }
 
@@ -834,7 +731,7 @@ namespace wrench {
      * @return string of hostname
      */
     std::string SimulationTimestampDiskWrite::getHostname() {
-        return this->hostname;
+        return *this->hostname;
     }
 
     /**
@@ -842,7 +739,7 @@ namespace wrench {
      * @return string of mount point
      */
     std::string SimulationTimestampDiskWrite::getMount() {
-        return this->mount;
+        return *this->mount;
     }
 
     /**
@@ -869,33 +766,6 @@ namespace wrench {
         return dynamic_cast<SimulationTimestampDiskWrite *>(this->endpoint);
     }
 
-    /**
-     * @brief A static unordered multimap of SimulationTimestampDiskWriteStart objects that have yet to be matched with Failure, Terminated or Completion timestamps
-     */
-    std::unordered_multimap<DiskAccess, SimulationTimestampDiskWrite *> SimulationTimestampDiskWrite::pending_disk_writes;
-
-    /**
-     * @brief Sets the endpoint of the calling object (SimulationTimestampDiskWriteFailure, SimulationTimestampDiskWriteTerminated, SimulationTimestampDiskWriteStart) with a SimulationTimestampDiskWriteStart object
-     */
-    void SimulationTimestampDiskWrite::setEndpoints() {
-        // find the SimulationTimestampDiskWrite object containing the same task
-        auto pending_disk_writes_itr = pending_disk_writes.find(DiskAccess(this->hostname, this->mount, this->counter));
-        if (pending_disk_writes_itr != pending_disk_writes.end()) {
-            // set my endpoint to the SimulationTimestampDiskWriteStart
-            this->endpoint = (*pending_disk_writes_itr).second;
-
-            // set the SimulationTimestampDiskWriteStart's endpoint to me
-            (*pending_disk_writes_itr).second->endpoint = this;
-
-            // the SimulationTimestampDiskWriteStart is no longer waiting to be matched with an end timestamp, remove it from the map
-            pending_disk_writes.erase(pending_disk_writes_itr);
-        } else {
-            throw std::runtime_error(
-                    "SimulationTimestampDiskWrite::setEndpoints() could not find a SimulationTimestampDiskWriteStart object.");
-        }
-    }
-
-
     /**
      * @brief Constructor
      * @param date: the date
@@ -912,13 +782,11 @@ namespace wrench {
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         // all information about a disk write should be passed
-        if (this->hostname.empty() || this->mount.empty()) {
+        if (this->hostname->empty() || this->mount->empty()) {
             throw std::invalid_argument(
                     "SimulationTimestampDiskWriteStart::SimulationTimestampDiskWriteStart() cannot take nullptr arguments");
         }
 #endif
-
-        pending_disk_writes.insert(std::make_pair(DiskAccess(this->hostname, this->mount, this->counter), this));
     }
 
     /**
@@ -928,11 +796,13 @@ namespace wrench {
      * @param mount: mount point of disk being write
      * @param bytes: number of bytes write
      * @param counter: an integer ID
+     * @param start: the matching start timestamp
      */
     SimulationTimestampDiskWriteFailure::SimulationTimestampDiskWriteFailure(double date, const std::string &hostname,
                                                                              const std::string &mount,
                                                                              sg_size_t bytes,
-                                                                             int counter) : SimulationTimestampDiskWrite(date, hostname, mount, bytes, counter) {
+                                                                             int counter,
+                                                                             SimulationTimestampDiskWriteStart *start) : SimulationTimestampDiskWrite(date, hostname, mount, bytes, counter) {
         WRENCH_DEBUG("Inserting a DiskWriteFailure timestamp for disk write");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -943,7 +813,7 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampDiskWriteStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -953,11 +823,13 @@ namespace wrench {
      * @param mount: mount point of disk being write
      * @param bytes: number of bytes write
      * @param counter: an integer ID
+     * @param start: the matching start timestamp
      */
     SimulationTimestampDiskWriteCompletion::SimulationTimestampDiskWriteCompletion(double date, const std::string &hostname,
                                                                                    const std::string &mount,
                                                                                    sg_size_t bytes,
-                                                                                   int counter) : SimulationTimestampDiskWrite(date, hostname, mount, bytes, counter) {
+                                                                                   int counter,
+                                                                                   SimulationTimestampDiskWriteStart *start) : SimulationTimestampDiskWrite(date, hostname, mount, bytes, counter) {
         WRENCH_DEBUG("Inserting a DiskWriteCompletion timestamp for disk write");
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -968,7 +840,7 @@ namespace wrench {
 #endif
 
         // match this timestamp with a SimulationTimestampDiskWriteStart
-        setEndpoints();
+        setEndpoints(start);
     }
 
     /**
@@ -977,7 +849,7 @@ namespace wrench {
      * @param hostname: the host on which a pstate is being set
      * @param pstate: the pstate that is being set on this host
      */
-    SimulationTimestampPstateSet::SimulationTimestampPstateSet(double date, const std::string &hostname, int pstate) : hostname(hostname), pstate(pstate) {
+    SimulationTimestampPstateSet::SimulationTimestampPstateSet(double date, const std::string &hostname, int pstate) : hostname(internString(hostname)), pstate(pstate) {
         this->date = date;
 
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
@@ -993,7 +865,7 @@ namespace wrench {
      * @return the hostname associated with this timestamp
      */
     std::string SimulationTimestampPstateSet::getHostname() {
-        return this->hostname;
+        return *this->hostname;
     }
 
     /**
@@ -1011,7 +883,7 @@ namespace wrench {
      * @param joules: the energy consumption in joules 
      */
     SimulationTimestampEnergyConsumption::SimulationTimestampEnergyConsumption(double date, const std::string &hostname, double joules)
-        : hostname(hostname), joules(joules) {
+        : hostname(internString(hostname)), joules(joules) {
         this->date = date;
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (hostname.empty() || joules < 0.0) {
@@ -1026,7 +898,7 @@ namespace wrench {
      * @return the hostname associated with this timestamp
      */
     std::string SimulationTimestampEnergyConsumption::getHostname() {
-        return this->hostname;
+        return *this->hostname;
     }
 
     /**
@@ -1044,7 +916,7 @@ namespace wrench {
      * @param bytes_per_second: the bandwidth usage in bytes per second
      */
     SimulationTimestampLinkUsage::SimulationTimestampLinkUsage(double date, const std::string &linkname, double bytes_per_second)
-        : linkname(linkname), bytes_per_second(bytes_per_second) {
+        : linkname(internString(linkname)), bytes_per_second(bytes_per_second) {
         this->date = date;
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         if (linkname.empty() || bytes_per_second < 0.0) {
@@ -1059,7 +931,7 @@ namespace wrench {
      * @return the linkname associated with this timestamp
      */
     std::string SimulationTimestampLinkUsage::getLinkname() {
-        return this->linkname;
+        return *this->linkname;
     }
 
     /**
@@ -0,0 +1,702 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <wrench/simulation/SimulationTraceFileSink.h>
+
+#define DBL_EQUAL(x, y) (std::abs((x) - (y)) < 0.1)
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    namespace {
+
+        /* Binary trace file layout (native byte order):
+         *   char     magic[8]
+         *   uint32_t byte_order_mark
+         *   uint32_t version
+         *   followed by records, each starting with a uint8_t record type:
+         *     STRING:                  uint32_t length, char data[length] (strings get IDs 0, 1, 2, ... in order)
+         *     DISK_READ / DISK_WRITE:  int32_t sequence_number, uint32_t hostname_id, uint32_t mount_id,
+         *                              double start_date, double end_date, double bytes, uint8_t failed
+         *     PSTATE_SET / ENERGY_CONSUMPTION / LINK_USAGE: double date, uint32_t name_id, double value
+         */
+
+        const char TRACE_MAGIC[8] = {'W', 'R', 'E', 'N', 'C', 'H', 'T', 'S'};
+        const uint32_t TRACE_BYTE_ORDER_MARK = 0x01020304;
+
+        const uint8_t RECORD_STRING = 0;
+        const uint8_t RECORD_DISK_READ = 1;
+        const uint8_t RECORD_DISK_WRITE = 2;
+        const uint8_t RECORD_PSTATE_SET = 3;
+        const uint8_t RECORD_ENERGY_CONSUMPTION = 4;
+        const uint8_t RECORD_LINK_USAGE = 5;
+
+        const char *const CSV_HEADER = "type,sequence_number,name,mount,start,end,value,failed";
+
+        /**
+         * @brief Name of a record type in the NDJSON and CSV formats
+         */
+        const char *recordTypeName(uint8_t record_type) {
+            switch (record_type) {
+                case RECORD_DISK_READ:
+                    return "disk_read";
+                case RECORD_DISK_WRITE:
+                    return "disk_write";
+                case RECORD_PSTATE_SET:
+                    return "pstate_set";
+                case RECORD_ENERGY_CONSUMPTION:
+                    return "energy_consumption";
+                case RECORD_LINK_USAGE:
+                    return "link_usage";
+                default:
+                    return "unknown";
+            }
+        }
+
+        /**
+         * @brief Record type from its name in the NDJSON and CSV formats
+         */
+        uint8_t recordTypeFromName(const std::string &name) {
+            for (uint8_t record_type = RECORD_DISK_READ; record_type <= RECORD_LINK_USAGE; record_type++) {
+                if (name == recordTypeName(record_type)) {
+                    return record_type;
+                }
+            }
+            throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Unknown record type '" + name + "'");
+        }
+
+        /**
+         * @brief Format a double so that it can be read back exactly
+         */
+        std::string formatDouble(double value) {
+            char str[32];
+            snprintf(str, sizeof(str), "%.17g", value);
+            return str;
+        }
+
+        /**
+         * @brief A class that rebuilds the JSON outputs of SimulationOutput from trace records, applying
+         *        the same merging rules as SimulationOutput applies to in-memory timestamps
+         */
+        class TraceJSONBuilder {
+
+        public:
+            void addDiskOperation(bool read, int sequence_number, const std::string &hostname, const std::string &mount,
+                                  double start_date, double end_date, double bytes, bool failed) {
+                auto &operations = this->disk_operations[hostname][mount];
+                (read ? operations.first : operations.second).push_back({sequence_number, start_date, end_date, bytes, failed});
+            }
+
+            void addSample(uint8_t record_type, double date, const std::string &name, double value) {
+                switch (record_type) {
+                    case RECORD_PSTATE_SET: {
+                        // A pstate set at the same date as the previous one replaces it
+                        auto &trace = this->getHostTraces(name).first;
+                        if ((not trace.empty()) and (std::fabs(trace.back().first - date) < DBL_EPSILON)) {
+                            trace.back().second = value;
+                        } else {
+                            trace.emplace_back(date, value);
+                        }
+                        break;
+                    }
+                    case RECORD_ENERGY_CONSUMPTION:
+                        addMergedSample(this->getHostTraces(name).second, date, value);
+                        break;
+                    case RECORD_LINK_USAGE: {
+                        auto it = this->link_traces.find(name);
+                        if (it == this->link_traces.end()) {
+                            this->linknames.push_back(name);
+                            it = this->link_traces.insert({name, {}}).first;
+                        }
+                        addMergedSample(it->second, date, value);
+                        break;
+                    }
+                    default:
+                        throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Invalid record type");
+                }
+            }
+
+            nlohmann::json getJSON() {
+                nlohmann::json disk_operations_json;
+                for (auto &host: this->disk_operations) {
+                    for (auto &mount: host.second) {
+                        disk_operations_json[host.first][mount.first]["reads"] = getDiskOperationsJSON(mount.second.first);
+                        disk_operations_json[host.first][mount.first]["writes"] = getDiskOperationsJSON(mount.second.second);
+                    }
+                }
+
+                nlohmann::json energy_json;
+                for (auto const &hostname: this->hostnames) {
+                    nlohmann::json datum;
+                    datum["hostname"] = hostname;
+                    for (auto const &sample: this->host_traces[hostname].first) {
+                        datum["pstate_trace"].push_back({{"time", sample.first}, {"pstate", (int) sample.second}});
+                    }
+                    for (auto const &sample: this->host_traces[hostname].second) {
+                        datum["consumed_energy_trace"].push_back({{"time", sample.first}, {"joules", sample.second}});
+                    }
+                    energy_json.push_back(datum);
+                }
+
+                nlohmann::json bandwidth_json;
+                for (auto const &linkname: this->linknames) {
+                    nlohmann::json datum;
+                    datum["linkname"] = linkname;
+                    for (auto const &sample: this->link_traces[linkname]) {
+                        datum["link_usage_trace"].push_back({{"time", sample.first}, {"bytes per second", sample.second}});
+                    }
+                    bandwidth_json.push_back(datum);
+                }
+                nlohmann::json links_list;
+                links_list["links"] = bandwidth_json;
+
+                return {{"disk_operations", disk_operations_json},
+                        {"energy_consumption", energy_json},
+                        {"link_usage", links_list}};
+            }
+
+        private:
+            struct DiskOperation {
+                int sequence_number;
+                double start_date;
+                double end_date;
+                double bytes;
+                bool failed;
+            };
+
+            typedef std::vector<std::pair<double, double>> SampleTrace;
+
+            /**
+             * @brief Add a sample to a trace, extending the last sample when the last
+             *        two samples and the new one have the same value
+             */
+            static void addMergedSample(SampleTrace &trace, double date, double value) {
+                auto size = trace.size();
+                if ((size >= 2) and DBL_EQUAL(trace[size - 2].second, trace[size - 1].second) and
+                    DBL_EQUAL(trace[size - 1].second, value)) {
+                    trace[size - 1].first = date;
+                } else {
+                    trace.emplace_back(date, value);
+                }
+            }
+
+            static nlohmann::json getDiskOperationsJSON(std::vector<DiskOperation> &operations) {
+                // Operations are recorded when they complete, but are listed in the order in which they started
+                std::sort(operations.begin(), operations.end(), [](const DiskOperation &a, const DiskOperation &b) {
+                    return a.sequence_number < b.sequence_number;
+                });
+                nlohmann::json operations_json;
+                for (auto const &operation: operations) {
+                    operations_json.push_back({{"start", operation.start_date},
+                                               {"end", operation.end_date},
+                                               {"bytes", operation.bytes},
+                                               {"failed", operation.failed ? "1" : "-1"}});
+                }
+                return operations_json;
+            }
+
+            std::pair<SampleTrace, SampleTrace> &getHostTraces(const std::string &hostname) {
+                auto it = this->host_traces.find(hostname);
+                if (it == this->host_traces.end()) {
+                    this->hostnames.push_back(hostname);
+                    it = this->host_traces.insert({hostname, {}}).first;
+                }
+                return it->second;
+            }
+
+            std::map<std::string, std::map<std::string, std::pair<std::vector<DiskOperation>, std::vector<DiskOperation>>>> disk_operations;
+            std::vector<std::string> hostnames;                                              // in order of appearance
+            std::unordered_map<std::string, std::pair<SampleTrace, SampleTrace>> host_traces;// pstates, energy
+            std::vector<std::string> linknames;                                              // in order of appearance
+            std::unordered_map<std::string, SampleTrace> link_traces;
+        };
+
+        /**
+         * @brief Read a value from a binary trace file
+         */
+        template<typename V>
+        V readBinary(std::istream &input) {
+            V value;
+            if (not input.read(reinterpret_cast<char *>(&value), sizeof(V))) {
+                throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Truncated trace file");
+            }
+            return value;
+        }
+
+        void readBinaryTrace(std::istream &input, TraceJSONBuilder &builder) {
+            if (readBinary<uint32_t>(input) != TRACE_BYTE_ORDER_MARK) {
+                throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Trace file was written with a different byte order");
+            }
+            if (readBinary<uint32_t>(input) != SimulationTraceFileSink::FORMAT_VERSION) {
+                throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Unsupported trace file version");
+            }
+
+            std::vector<std::string> strings;
+            auto get_string = [&strings](uint32_t id) -> const std::string & {
+                if (id >= strings.size()) {
+                    throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Invalid string ID in trace file");
+                }
+                return strings[id];
+            };
+
+            char record_type;
+            while (input.get(record_type)) {
+                switch ((uint8_t) record_type) {
+                    case RECORD_STRING: {
+                        auto length = readBinary<uint32_t>(input);
+                        std::string string(length, '\0');
+                        if (not input.read(&string[0], length)) {
+                            throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Truncated trace file");
+                        }
+                        strings.push_back(std::move(string));
+                        break;
+                    }
+                    case RECORD_DISK_READ:
+                    case RECORD_DISK_WRITE: {
+                        auto sequence_number = readBinary<int32_t>(input);
+                        auto hostname_id = readBinary<uint32_t>(input);
+                        auto mount_id = readBinary<uint32_t>(input);
+                        auto start_date = readBinary<double>(input);
+                        auto end_date = readBinary<double>(input);
+                        auto bytes = readBinary<double>(input);
+                        auto failed = readBinary<uint8_t>(input);
+                        builder.addDiskOperation(record_type == RECORD_DISK_READ, sequence_number,
+                                                 get_string(hostname_id), get_string(mount_id),
+                                                 start_date, end_date, bytes, failed != 0);
+                        break;
+                    }
+                    case RECORD_PSTATE_SET:
+                    case RECORD_ENERGY_CONSUMPTION:
+                    case RECORD_LINK_USAGE: {
+                        auto date = readBinary<double>(input);
+                        auto name_id = readBinary<uint32_t>(input);
+                        auto value = readBinary<double>(input);
+                        builder.addSample(record_type, date, get_string(name_id), value);
+                        break;
+                    }
+                    default:
+                        throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Invalid record type in trace file");
+                }
+            }
+        }
+
+        void readNDJSONTrace(std::istream &input, TraceJSONBuilder &builder) {
+            std::string line;
+            while (std::getline(input, line)) {
+                if (line.empty()) {
+                    continue;
+                }
+                try {
+                    auto record = nlohmann::json::parse(line);
+                    auto record_type = recordTypeFromName(record.at("type").get<std::string>());
+                    switch (record_type) {
+                        case RECORD_DISK_READ:
+                        case RECORD_DISK_WRITE:
+                            builder.addDiskOperation(record_type == RECORD_DISK_READ, record.at("sequence_number").get<int>(),
+                                                     record.at("hostname").get<std::string>(), record.at("mount").get<std::string>(),
+                                                     record.at("start").get<double>(), record.at("end").get<double>(),
+                                                     record.at("bytes").get<double>(), record.at("failed").get<bool>());
+                            break;
+                        case RECORD_PSTATE_SET:
+                            builder.addSample(record_type, record.at("date").get<double>(), record.at("hostname").get<std::string>(),
+                                              record.at("pstate").get<int>());
+                            break;
+                        case RECORD_ENERGY_CONSUMPTION:
+                            builder.addSample(record_type, record.at("date").get<double>(), record.at("hostname").get<std::string>(),
+                                              record.at("joules").get<double>());
+                            break;
+                        default:
+                            builder.addSample(record_type, record.at("date").get<double>(), record.at("linkname").get<std::string>(),
+                                              record.at("bytes_per_second").get<double>());
+                            break;
+                    }
+                } catch (nlohmann::json::exception &e) {
+                    throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Invalid trace file record: " + std::string(e.what()));
+                }
+            }
+        }
+
+        /**
+         * @brief Split a CSV line into fields (fields may be double-quoted, with "" standing for ")
+         */
+        std::vector<std::string> splitCSVLine(const std::string &line) {
+            std::vector<std::string> fields(1);
+            bool quoted = false;
+            for (size_t i = 0; i < line.size(); i++) {
+                char c = line[i];
+                if (quoted) {
+                    if (c != '"') {
+                        fields.back() += c;
+                    } else if ((i + 1 < line.size()) and (line[i + 1] == '"')) {
+                        fields.back() += '"';
+                        i++;
+                    } else {
+                        quoted = false;
+                    }
+                } else if (c == '"') {
+                    quoted = true;
+                } else if (c == ',') {
+                    fields.emplace_back();
+                } else {
+                    fields.back() += c;
+                }
+            }
+            return fields;
+        }
+
+        /**
+         * @brief Read a CSV record, which spans several lines if a quoted field contains newlines
+         * @return false if there is no record left to read
+         */
+        bool readCSVRecord(std::istream &input, std::string &record) {
+            if (not std::getline(input, record)) {
+                return false;
+            }
+            // An odd number of quotes means that a quoted field is still open
+            auto num_quotes = std::count(record.begin(), record.end(), '"');
+            std::string line;
+            while ((num_quotes % 2) and std::getline(input, line)) {
+                record += '\n';
+                record += line;
+                num_quotes += std::count(line.begin(), line.end(), '"');
+            }
+            return true;
+        }
+
+        void readCSVTrace(std::istream &input, TraceJSONBuilder &builder) {
+            std::string line;
+            std::getline(input, line);// header
+            while (readCSVRecord(input, line)) {
+                if (line.empty()) {
+                    continue;
+                }
+                auto fields = splitCSVLine(line);
+                if (fields.size() != 8) {
+                    throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Invalid trace file record: " + line);
+                }
+                try {
+                    auto record_type = recordTypeFromName(fields[0]);
+                    if ((record_type == RECORD_DISK_READ) or (record_type == RECORD_DISK_WRITE)) {
+                        builder.addDiskOperation(record_type == RECORD_DISK_READ, std::stoi(fields[1]), fields[2], fields[3],
+                                                 std::stod(fields[4]), std::stod(fields[5]), std::stod(fields[6]),
+                                                 fields[7] == "1");
+                    } else {
+                        builder.addSample(record_type, std::stod(fields[4]), fields[2], std::stod(fields[6]));
+                    }
+                } catch (std::logic_error &e) {
+                    throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Invalid trace file record: " + line);
+                }
+            }
+        }
+
+    }// namespace
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+    /**
+     * @brief Constructor
+     * @param file_path: the path of the trace file (which is overwritten if it exists)
+     * @param format: the trace file format
+     * @param buffer_size: the size of the in-memory buffer, in bytes
+     */
+    SimulationTraceFileSink::SimulationTraceFileSink(const std::string &file_path, Format format, size_t buffer_size)
+        : format(format), buffer_size(buffer_size) {
+        this->file.open(file_path, std::ios::binary | std::ios::trunc);
+        if (not this->file) {
+            throw std::invalid_argument("SimulationTraceFileSink::SimulationTraceFileSink(): Cannot open file " + file_path);
+        }
+        this->buffer.reserve(buffer_size);
+
+        switch (this->format) {
+            case BINARY:
+                this->buffer.append(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+                this->writeBinary(TRACE_BYTE_ORDER_MARK);
+                this->writeBinary(FORMAT_VERSION);
+                break;
+            case CSV:
+                this->buffer.append(CSV_HEADER);
+                this->buffer += '\n';
+                break;
+            case NDJSON:
+                break;
+        }
+    }
+
+    /**
+     * @brief Destructor (writes out all buffered records)
+     */
+    SimulationTraceFileSink::~SimulationTraceFileSink() {
+        try {
+            this->flush();
+        } catch (std::runtime_error &) {
+            // Nothing can be done about it at this point
+        }
+    }
+
+    /**
+     * @brief Record a completed (or failed) disk read
+     * @param sequence_number: the unique sequence number of the disk operation
+     * @param hostname: the name of the host of the disk
+     * @param mount: the path being read
+     * @param start_date: the date at which the operation started
+     * @param end_date: the date at which the operation completed (or failed)
+     * @param bytes: the number of bytes read
+     * @param failed: whether the operation failed
+     */
+    void SimulationTraceFileSink::recordDiskRead(int sequence_number, const std::string &hostname, const std::string &mount,
+                                                 double start_date, double end_date, double bytes, bool failed) {
+        this->recordDiskOperation(true, sequence_number, hostname, mount, start_date, end_date, bytes, failed);
+    }
+
+    /**
+     * @brief Record a completed (or failed) disk write
+     * @param sequence_number: the unique sequence number of the disk operation
+     * @param hostname: the name of the host of the disk
+     * @param mount: the path being written
+     * @param start_date: the date at which the operation started
+     * @param end_date: the date at which the operation completed (or failed)
+     * @param bytes: the number of bytes written
+     * @param failed: whether the operation failed
+     */
+    void SimulationTraceFileSink::recordDiskWrite(int sequence_number, const std::string &hostname, const std::string &mount,
+                                                  double start_date, double end_date, double bytes, bool failed) {
+        this->recordDiskOperation(false, sequence_number, hostname, mount, start_date, end_date, bytes, failed);
+    }
+
+    /**
+     * @brief Record a pstate change
+     * @param date: the date
+     * @param hostname: a hostname
+     * @param pstate: a pstate index
+     */
+    void SimulationTraceFileSink::recordPstateSet(double date, const std::string &hostname, int pstate) {
+        this->recordSample(RECORD_PSTATE_SET, date, hostname, pstate);
+    }
+
+    /**
+     * @brief Record an energy consumption measurement
+     * @param date: the date
+     * @param hostname: a hostname
+     * @param joules: the energy consumed so far, in joules
+     */
+    void SimulationTraceFileSink::recordEnergyConsumption(double date, const std::string &hostname, double joules) {
+        this->recordSample(RECORD_ENERGY_CONSUMPTION, date, hostname, joules);
+    }
+
+    /**
+     * @brief Record a link usage measurement
+     * @param date: the date
+     * @param linkname: a link name
+     * @param bytes_per_second: the link usage in bytes per second
+     */
+    void SimulationTraceFileSink::recordLinkUsage(double date, const std::string &linkname, double bytes_per_second) {
+        this->recordSample(RECORD_LINK_USAGE, date, linkname, bytes_per_second);
+    }
+
+    /**
+     * @brief Write out all buffered records
+     */
+    void SimulationTraceFileSink::flush() {
+        if (not this->buffer.empty()) {
+            this->file.write(this->buffer.data(), (std::streamsize) this->buffer.size());
+            this->buffer.clear();
+        }
+        this->file.flush();
+        if (not this->file) {
+            throw std::runtime_error("SimulationTraceFileSink::flush(): Cannot write to trace file");
+        }
+    }
+
+    /**
+     * @brief Rebuild, from a trace file, the JSON outputs that SimulationOutput would have generated had the
+     *        streamed timestamps been kept in memory. The returned JSON object has the same "disk_operations",
+     *        "energy_consumption" and "link_usage" members as the JSON written by SimulationOutput::dumpUnifiedJSON().
+     *        Since the trace file does not describe the platform, hosts and links for which nothing was recorded are
+     *        not listed, hosts do not have "pstates" and "wattage_off" members, and hosts and links are listed in the
+     *        order in which they appear in the trace file.
+     *
+     * @param file_path: the path of a trace file (in any format)
+     * @return a JSON object
+     */
+    nlohmann::json SimulationTraceFileSink::reconstructJSON(const std::string &file_path) {
+        std::ifstream input(file_path, std::ios::binary);
+        if (not input) {
+            throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Cannot open file " + file_path);
+        }
+
+        TraceJSONBuilder builder;
+
+        char magic[sizeof(TRACE_MAGIC)];
+        if (input.read(magic, sizeof(magic)) and (memcmp(magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) == 0)) {
+            readBinaryTrace(input, builder);
+        } else {
+            input.clear();
+            input.seekg(0);
+            std::string first_line;
+            std::getline(input, first_line);
+            input.clear();
+            input.seekg(0);
+            if (first_line == CSV_HEADER) {
+                readCSVTrace(input, builder);
+            } else if (first_line.empty() or (first_line[0] == '{')) {
+                readNDJSONTrace(input, builder);
+            } else {
+                throw std::invalid_argument("SimulationTraceFileSink::reconstructJSON(): Unknown trace file format");
+            }
+        }
+
+        return builder.getJSON();
+    }
+
+    /**
+     * @brief Record a disk operation
+     */
+    void SimulationTraceFileSink::recordDiskOperation(bool read, int sequence_number, const std::string &hostname, const std::string &mount,
+                                                      double start_date, double end_date, double bytes, bool failed) {
+        auto record_type = read ? RECORD_DISK_READ : RECORD_DISK_WRITE;
+        switch (this->format) {
+            case BINARY: {
+                auto hostname_id = this->getStringID(hostname);
+                auto mount_id = this->getStringID(mount);
+                this->writeBinary(record_type);
+                this->writeBinary((int32_t) sequence_number);
+                this->writeBinary(hostname_id);
+                this->writeBinary(mount_id);
+                this->writeBinary(start_date);
+                this->writeBinary(end_date);
+                this->writeBinary(bytes);
+                this->writeBinary((uint8_t) (failed ? 1 : 0));
+                break;
+            }
+            case NDJSON:
+                this->buffer += nlohmann::json({{"type", recordTypeName(record_type)},
+                                                {"sequence_number", sequence_number},
+                                                {"hostname", hostname},
+                                                {"mount", mount},
+                                                {"start", start_date},
+                                                {"end", end_date},
+                                                {"bytes", bytes},
+                                                {"failed", failed}})
+                                        .dump();
+                this->buffer += '\n';
+                break;
+            case CSV:
+                this->buffer += recordTypeName(record_type);
+                this->buffer += ',' + std::to_string(sequence_number) + ',';
+                this->writeCSVString(hostname);
+                this->buffer += ',';
+                this->writeCSVString(mount);
+                this->buffer += ',' + formatDouble(start_date) + ',' + formatDouble(end_date) + ',' +
+                                formatDouble(bytes) + ',' + (failed ? "1" : "0") + '\n';
+                break;
+        }
+        this->flushIfFull();
+    }
+
+    /**
+     * @brief Record a (pstate, energy consumption or link usage) sample
+     */
+    void SimulationTraceFileSink::recordSample(uint8_t record_type, double date, const std::string &name, double value) {
+        switch (this->format) {
+            case BINARY: {
+                auto name_id = this->getStringID(name);
+                this->writeBinary(record_type);
+                this->writeBinary(date);
+                this->writeBinary(name_id);
+                this->writeBinary(value);
+                break;
+            }
+            case NDJSON: {
+                nlohmann::json record = {{"type", recordTypeName(record_type)}, {"date", date}};
+                if (record_type == RECORD_PSTATE_SET) {
+                    record["hostname"] = name;
+                    record["pstate"] = (int) value;
+                } else if (record_type == RECORD_ENERGY_CONSUMPTION) {
+                    record["hostname"] = name;
+                    record["joules"] = value;
+                } else {
+                    record["linkname"] = name;
+                    record["bytes_per_second"] = value;
+                }
+                this->buffer += record.dump();
+                this->buffer += '\n';
+                break;
+            }
+            case CSV:
+                this->buffer += recordTypeName(record_type);
+                this->buffer += ",,";
+                this->writeCSVString(name);
+                this->buffer += ",," + formatDouble(date) + ",," + formatDouble(value) + ",\n";
+                break;
+        }
+        this->flushIfFull();
+    }
+
+    /**
+     * @brief Write out the buffer if it is full
+     */
+    void SimulationTraceFileSink::flushIfFull() {
+        if (this->buffer.size() >= this->buffer_size) {
+            this->flush();
+        }
+    }
+
+    /**
+     * @brief Get the ID of a string in a binary trace file, writing a string record
+     *        if the string has not been written yet
+     * @param string: a string
+     * @return a string ID
+     */
+    uint32_t SimulationTraceFileSink::getStringID(const std::string &string) {
+        auto it = this->string_ids.find(string);
+        if (it != this->string_ids.end()) {
+            return it->second;
+        }
+        auto id = (uint32_t) this->string_ids.size();
+        this->string_ids[string] = id;
+        this->writeBinary(RECORD_STRING);
+        this->writeBinary((uint32_t) string.size());
+        this->buffer.append(string);
+        return id;
+    }
+
+    /**
+     * @brief Append a CSV field to the buffer, quoting it if needed
+     * @param string: the field's value
+     */
+    void SimulationTraceFileSink::writeCSVString(const std::string &string) {
+        if (string.find_first_of(",\"\n") == std::string::npos) {
+            this->buffer += string;
+            return;
+        }
+        this->buffer += '"';
+        for (auto c: string) {
+            if (c == '"') {
+                this->buffer += '"';
+            }
+            this->buffer += c;
+        }
+        this->buffer += '"';
+    }
+
+}// namespace wrench
@@ -7,10 +7,12 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
 #include <vector>
+#include <climits>
+#include <unordered_set>
 #include <wrench/workflow/DagOfTasks.h>
 #include <wrench/logging/TerminalOutput.h>
-#include <boost/property_map/property_map.hpp>
 
 
 WRENCH_LOG_CATEGORY(dag_of_tasks, "Log category for DagOfTasks");
@@ -20,38 +22,65 @@ namespace wrench {
     /**
  * @brief Method to add a task vertex to the DAG
  * @param task: the task
+ * @return the index of the new vertex
  */
-    void wrench::DagOfTasks::addVertex(const wrench::WorkflowTask *task) {
-        // Add a new vertex
-        VertexProperties p = {task};
-        boost::add_vertex(p, this->dag);
+    vertex_t wrench::DagOfTasks::addVertex(const wrench::WorkflowTask *task) {
         // Update the vertex vector
         this->task_list.push_back(task);
+        this->added_children.emplace_back();
+        this->added_parents.emplace_back();
+        this->num_children.push_back(0);
+        this->num_parents.push_back(0);
         // Set the task's vertex id in the task map
         this->task_map[task] = this->task_list.size() - 1;
+        return this->task_list.size() - 1;
     }
 
     /**
- * @brief Method to remove a task vertex from the DAG
+ * @brief Method to remove a task vertex from the DAG (the vertex is tombstoned, and
+ *        its index is only reclaimed when the DAG is compacted)
  * @param task: the task
  */
     void wrench::DagOfTasks::removeVertex(wrench::WorkflowTask *task) {
         // Find the vertex
-        if (this->task_map.find(task) == this->task_map.end() or this->task_map[task] >= this->task_list.size()) {
-            throw std::invalid_argument("wrench::DagOfTasks::removeVertex(): Trying to remove a non-existing vertex");
+        auto vertex = this->lookupVertex(task, "wrench::DagOfTasks::removeVertex(): Trying to remove a non-existing vertex");
+
+        // Remove all in and out edges at that vertex
+        std::vector<vertex_t> children;
+        std::vector<vertex_t> parents;
+        this->forEachNeighbor(vertex, true, [&children](vertex_t v) { children.push_back(v); });
+        this->forEachNeighbor(vertex, false, [&parents](vertex_t v) { parents.push_back(v); });
+        for (auto const &child: children) {
+            this->removeFromAdjacency(child, vertex, false);
         }
-        // Remove the corresponding task list item
-        this->task_list.erase(this->task_list.begin() + this->task_map[task]);
-        // Update subsequent task's vertex indices
-        for (auto it = this->task_list.begin() + this->task_map[task]; it != this->task_list.end(); ++it) {
-            this->task_map[*it]--;
+        for (auto const &parent: parents) {
+            this->removeFromAdjacency(parent, vertex, true);
         }
+        if (vertex + 1 < this->out_offsets.size()) {
+            for (auto i = this->out_offsets[vertex]; i < this->out_offsets[vertex + 1]; i++) {
+                if (this->out_neighbors[i] != NO_VERTEX) {
+                    this->out_neighbors[i] = NO_VERTEX;
+                    this->num_removed_csr_edges++;
+                }
+            }
+            for (auto i = this->in_offsets[vertex]; i < this->in_offsets[vertex + 1]; i++) {
+                this->in_neighbors[i] = NO_VERTEX;
+            }
+        }
+        this->num_added_edges -= std::min<unsigned long>(this->num_added_edges, this->added_children[vertex].size());
+        this->added_children[vertex].clear();
+        this->added_children[vertex].shrink_to_fit();
+        this->added_parents[vertex].clear();
+        this->added_parents[vertex].shrink_to_fit();
+        this->num_children[vertex] = 0;
+        this->num_parents[vertex] = 0;
 
-        // Remove all in and out edges at that vertex
-        boost::clear_vertex(this->task_map[task], this->dag);
+        // Tombstone the vertex
+        this->task_list[vertex] = nullptr;
+        this->task_map.erase(task);
+        this->num_removed_vertices++;
 
-        // Remove the vertex
-        boost::remove_vertex(this->task_map[task], this->dag);
+        this->rebuildCSRIfNeeded();
     }
 
 
@@ -62,16 +91,177 @@ namespace wrench {
  */
     void wrench::DagOfTasks::addEdge(wrench::WorkflowTask *src, wrench::WorkflowTask *dst) {
         // Check that vertices exist
-        if (this->task_map.find(src) == this->task_map.end() or this->task_map[src] >= this->task_list.size()) {
-            throw std::invalid_argument(
-                    "wrench::DagOfTasks::removeVertex(): Trying to add an edge from a non-existing vertex");
+        auto src_vertex = this->lookupVertex(src, "wrench::DagOfTasks::addEdge(): Trying to add an edge from a non-existing vertex");
+        auto dst_vertex = this->lookupVertex(dst, "wrench::DagOfTasks::addEdge(): Trying to add an edge to a non-existing vertex");
+
+        // Add the edge
+        this->added_children[src_vertex].push_back(dst_vertex);
+        this->added_parents[dst_vertex].push_back(src_vertex);
+        this->num_children[src_vertex]++;
+        this->num_parents[dst_vertex]++;
+        this->num_added_edges++;
+
+        this->rebuildCSRIfNeeded();
+    }
+
+    /**
+     * @brief Method to add a batch of edges at once. The whole batch is checked for
+     *        cycles with a single topological sort, and edges that are implied by other
+     *        paths in the resulting graph are dropped unless they are flagged as to be kept.
+     *        Either all (non-redundant) edges are added, or none is. The CSR arrays are
+     *        rebuilt once all edges have been added.
+     *
+     * @param edges: the edges as (source task, destination task, keep-even-if-redundant) tuples
+     * @param added_edges: the edges that were actually added to the DAG (output)
+     * @return true if the edges were added, false if adding them would create a cycle
+     *         (in which case the DAG is not modified)
+     */
+    bool wrench::DagOfTasks::addEdges(const std::vector<std::tuple<WorkflowTask *, WorkflowTask *, bool>> &edges,
+                                      std::vector<std::pair<WorkflowTask *, WorkflowTask *>> &added_edges) {
+        // Check that vertices exist
+        for (auto const &edge: edges) {
+            this->lookupVertex(std::get<0>(edge), "wrench::DagOfTasks::addEdges(): Trying to add an edge from a non-existing vertex");
+            this->lookupVertex(std::get<1>(edge), "wrench::DagOfTasks::addEdges(): Trying to add an edge to a non-existing vertex");
+        }
+
+        const unsigned long num_vertices = this->task_list.size();
+        auto edge_key = [num_vertices](vertex_t src, vertex_t dst) { return src * num_vertices + dst; };
+
+        // Build the adjacency lists of the graph with both existing and new edges
+        std::vector<std::vector<vertex_t>> children(num_vertices);
+        std::vector<unsigned long> in_degree(num_vertices, 0);
+        std::unordered_set<unsigned long> existing_edges;
+        for (vertex_t src_vertex = 0; src_vertex < num_vertices; src_vertex++) {
+            this->forEachNeighbor(src_vertex, true, [&](vertex_t dst_vertex) {
+                if (existing_edges.insert(edge_key(src_vertex, dst_vertex)).second) {
+                    children[src_vertex].push_back(dst_vertex);
+                    in_degree[dst_vertex]++;
+                }
+            });
         }
-        if (this->task_map.find(dst) == this->task_map.end() or this->task_map[dst] >= this->task_list.size()) {
-            throw std::invalid_argument("wrench::DagOfTasks::removeVertex(): Trying to add an edge to a non-existing vertex");
+
+        // Candidate new edges (duplicates and already-existing edges are discarded)
+        std::vector<std::pair<vertex_t, vertex_t>> new_edges;
+        std::vector<bool> keep_new_edge;
+        std::unordered_map<unsigned long, unsigned long> new_edge_indices;
+        for (auto const &edge: edges) {
+            auto src_vertex = this->task_map[std::get<0>(edge)];
+            auto dst_vertex = this->task_map[std::get<1>(edge)];
+            auto key = edge_key(src_vertex, dst_vertex);
+            if (existing_edges.find(key) != existing_edges.end()) {
+                continue;
+            }
+            auto it = new_edge_indices.find(key);
+            if (it != new_edge_indices.end()) {
+                keep_new_edge[it->second] = keep_new_edge[it->second] or std::get<2>(edge);
+                continue;
+            }
+            new_edge_indices[key] = new_edges.size();
+            new_edges.emplace_back(src_vertex, dst_vertex);
+            keep_new_edge.push_back(std::get<2>(edge));
+            children[src_vertex].push_back(dst_vertex);
+            in_degree[dst_vertex]++;
         }
 
-        // Add the edge
-        boost::add_edge(this->task_map[src], this->task_map[dst], this->dag);
+        // Topological sort (Kahn's algorithm) to detect cycles
+        std::vector<vertex_t> topological_order;
+        topological_order.reserve(num_vertices);
+        for (vertex_t v = 0; v < num_vertices; v++) {
+            if (in_degree[v] == 0) {
+                topological_order.push_back(v);
+            }
+        }
+        for (unsigned long i = 0; i < topological_order.size(); i++) {
+            for (auto const &child: children[topological_order[i]]) {
+                if (--in_degree[child] == 0) {
+                    topological_order.push_back(child);
+                }
+            }
+        }
+        if (topological_order.size() < num_vertices) {
+            return false;
+        }
+
+        // Transitive reduction of the new edges: a new edge src->dst is redundant if dst can
+        // be reached from src through a path of length >= 2. The search from src is pruned
+        // at vertices that come after all of src's children in the topological order.
+        std::vector<unsigned long> position(num_vertices);
+        for (unsigned long i = 0; i < num_vertices; i++) {
+            position[topological_order[i]] = i;
+        }
+        std::vector<std::vector<unsigned long>> removable_edges_from(num_vertices);
+        for (unsigned long i = 0; i < new_edges.size(); i++) {
+            if (not keep_new_edge[i]) {
+                removable_edges_from[new_edges[i].first].push_back(i);
+            }
+        }
+        std::vector<bool> redundant(new_edges.size(), false);
+        std::vector<unsigned long> child_stamp(num_vertices, ULONG_MAX);
+        std::vector<unsigned long> visited_stamp(num_vertices, ULONG_MAX);
+        std::vector<vertex_t> to_visit;
+        for (vertex_t src_vertex = 0; src_vertex < num_vertices; src_vertex++) {
+            if (removable_edges_from[src_vertex].empty() or children[src_vertex].size() < 2) {
+                continue;
+            }
+            unsigned long max_position = 0;
+            for (auto const &child: children[src_vertex]) {
+                child_stamp[child] = src_vertex;
+                max_position = std::max<unsigned long>(max_position, position[child]);
+            }
+            std::unordered_set<vertex_t> reachable_children;
+            to_visit.clear();
+            for (auto const &child: children[src_vertex]) {
+                if (visited_stamp[child] != src_vertex) {
+                    visited_stamp[child] = src_vertex;
+                    to_visit.push_back(child);
+                }
+            }
+            while (not to_visit.empty()) {
+                auto v = to_visit.back();
+                to_visit.pop_back();
+                if (position[v] >= max_position) {
+                    continue;
+                }
+                for (auto const &w: children[v]) {
+                    if (position[w] > max_position) {
+                        continue;
+                    }
+                    if (child_stamp[w] == src_vertex) {
+                        reachable_children.insert(w);
+                    }
+                    if (visited_stamp[w] != src_vertex) {
+                        visited_stamp[w] = src_vertex;
+                        to_visit.push_back(w);
+                    }
+                }
+            }
+            for (auto const &edge_index: removable_edges_from[src_vertex]) {
+                if (reachable_children.find(new_edges[edge_index].second) != reachable_children.end()) {
+                    redundant[edge_index] = true;
+                }
+            }
+        }
+
+        // Add the non-redundant edges, and rebuild the CSR arrays
+        for (unsigned long i = 0; i < new_edges.size(); i++) {
+            if (redundant[i]) {
+                continue;
+            }
+            this->added_children[new_edges[i].first].push_back(new_edges[i].second);
+            this->added_parents[new_edges[i].second].push_back(new_edges[i].first);
+            this->num_children[new_edges[i].first]++;
+            this->num_parents[new_edges[i].second]++;
+            this->num_added_edges++;
+            added_edges.emplace_back(const_cast<WorkflowTask *>(this->task_list[new_edges[i].first]),
+                                     const_cast<WorkflowTask *>(this->task_list[new_edges[i].second]));
+        }
+        std::vector<vertex_t> same_indices(num_vertices);
+        for (vertex_t v = 0; v < num_vertices; v++) {
+            same_indices[v] = v;
+        }
+        this->rebuildCSR(same_indices, num_vertices);
+
+        return true;
     }
 
     /**
@@ -81,15 +271,14 @@ namespace wrench {
  */
     void wrench::DagOfTasks::removeEdge(wrench::WorkflowTask *src, wrench::WorkflowTask *dst) {
         // Check that vertices exist
-        if (this->task_map.find(src) == this->task_map.end() or this->task_map[src] >= this->task_list.size()) {
-            throw std::invalid_argument("wrench::DagOfTasks::removeEdge(): Trying add an edge from a non-existing vertex");
-        }
-        if (this->task_map.find(dst) == this->task_map.end() or this->task_map[dst] >= this->task_list.size()) {
-            throw std::invalid_argument("wrench::DagOfTasks::removeEdge(): Trying add an edge to a non-existing vertex");
-        }
+        auto src_vertex = this->lookupVertex(src, "wrench::DagOfTasks::removeEdge(): Trying add an edge from a non-existing vertex");
+        auto dst_vertex = this->lookupVertex(dst, "wrench::DagOfTasks::removeEdge(): Trying add an edge to a non-existing vertex");
 
         // Remove the edge
-        boost::remove_edge(this->task_map[src], this->task_map[dst], this->dag);
+        this->removeFromAdjacency(src_vertex, dst_vertex, true);
+        this->removeFromAdjacency(dst_vertex, src_vertex, false);
+
+        this->rebuildCSRIfNeeded();
     }
 
     /**
@@ -100,30 +289,35 @@ namespace wrench {
  */
     bool wrench::DagOfTasks::doesPathExist(const wrench::WorkflowTask *src, const wrench::WorkflowTask *dst) {
         // Check that vertices exist
-        if (this->task_map.find(src) == this->task_map.end() or this->task_map[src] >= this->task_list.size()) {
-            throw std::invalid_argument(
-                    "wrench::DagOfTasks::doesPathExist(): Trying to find a path from a non-existing vertex");
-        }
-        if (this->task_map.find(dst) == this->task_map.end() or this->task_map[dst] >= this->task_list.size()) {
-            throw std::invalid_argument(
-                    "wrench::DagOfTasks::doesPathExist(): Trying to find a path to a non-existing vertex");
-        }
-        // Find the vertices
-        auto src_vertex = this->task_map[src];
-        auto dst_vertex = this->task_map[dst];
-
-        auto indexmap = boost::get(boost::vertex_index, dag);
-        auto colormap = boost::make_vector_property_map<boost::default_color_type>(indexmap);
-
-        using vertex_descriptor = boost::graph_traits<DAG>::vertex_descriptor;
-        boost::queue<vertex_descriptor> Q;
-        custom_bfs_visitor vis(dst);
+        auto src_vertex = this->lookupVertex(src, "wrench::DagOfTasks::doesPathExist(): Trying to find a path from a non-existing vertex");
+        auto dst_vertex = this->lookupVertex(dst, "wrench::DagOfTasks::doesPathExist(): Trying to find a path to a non-existing vertex");
 
-        try {
-            boost::breadth_first_visit(dag, src_vertex, Q, vis, colormap);
-        } catch (std::runtime_error &) {
+        if (src_vertex == dst_vertex) {
             return true;
         }
+
+        // Depth-first search, using stamps to mark visited vertices
+        this->visit_stamps.resize(this->task_list.size(), 0);
+        auto stamp = ++this->current_visit_stamp;
+        std::vector<vertex_t> to_visit = {src_vertex};
+        this->visit_stamps[src_vertex] = stamp;
+        while (not to_visit.empty()) {
+            auto vertex = to_visit.back();
+            to_visit.pop_back();
+            bool found = false;
+            this->forEachNeighbor(vertex, true, [&](vertex_t child) {
+                if (child == dst_vertex) {
+                    found = true;
+                }
+                if (this->visit_stamps[child] != stamp) {
+                    this->visit_stamps[child] = stamp;
+                    to_visit.push_back(child);
+                }
+            });
+            if (found) {
+                return true;
+            }
+        }
         return false;
     }
 
@@ -135,19 +329,14 @@ namespace wrench {
  */
     bool wrench::DagOfTasks::doesEdgeExist(const wrench::WorkflowTask *src, const wrench::WorkflowTask *dst) {
         // Check that vertices exist
-        if (this->task_map.find(src) == this->task_map.end() or this->task_map[src] >= this->task_list.size()) {
-            throw std::invalid_argument(
-                    "wrench::DagOfTasks::doesPathExist(): Trying to find a path from a non-existing vertex");
-        }
-        if (this->task_map.find(dst) == this->task_map.end() or this->task_map[dst] >= this->task_list.size()) {
-            throw std::invalid_argument(
-                    "wrench::DagOfTasks::doesPathExist(): Trying to find a path to a non-existing vertex");
-        }
-        // Find the vertices
-        auto src_vertex = this->task_map[src];
-        auto dst_vertex = this->task_map[dst];
+        auto src_vertex = this->lookupVertex(src, "wrench::DagOfTasks::doesPathExist(): Trying to find a path from a non-existing vertex");
+        auto dst_vertex = this->lookupVertex(dst, "wrench::DagOfTasks::doesPathExist(): Trying to find a path to a non-existing vertex");
 
-        return boost::edge(src_vertex, dst_vertex, this->dag).second;
+        bool found = false;
+        this->forEachNeighbor(src_vertex, true, [&found, dst_vertex](vertex_t child) {
+            found = found or (child == dst_vertex);
+        });
+        return found;
     }
 
     /**
@@ -157,16 +346,8 @@ namespace wrench {
  */
     long wrench::DagOfTasks::getNumberOfChildren(const WorkflowTask *task) {
         // Find the vertex
-        if (this->task_map.find(task) == this->task_map.end() or this->task_map[task] >= this->task_list.size()) {
-            throw std::invalid_argument("wrench::DagOfTasks::getNumberOfChildren(): Non-existing vertex");
-        }
-        auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
-        long count = 0;
-        for (boost::tie(eo, edge_end) = boost::out_edges(vertex, dag); eo != edge_end; ++eo) {
-            count++;
-        }
-        return count;
+        auto vertex = this->lookupVertex(task, "wrench::DagOfTasks::getNumberOfChildren(): Non-existing vertex");
+        return (long) this->num_children[vertex];
     }
 
     /**
@@ -176,17 +357,8 @@ namespace wrench {
  */
     std::vector<WorkflowTask *> wrench::DagOfTasks::getChildren(const WorkflowTask *task) {
         // Find the vertex
-        if (this->task_map.find(task) == this->task_map.end() or this->task_map[task] >= this->task_list.size()) {
-            throw std::invalid_argument("wrench::DagOfTasks::getChildren(): Non-existing vertex");
-        }
-        auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
-        std::vector<WorkflowTask *> children;
-        for (boost::tie(eo, edge_end) = boost::out_edges(vertex, dag); eo != edge_end; ++eo) {
-            // Discard the const qualifier
-            children.push_back(const_cast<WorkflowTask*>(dag[target(*eo, dag)].task));
-        }
-        return children;
+        auto vertex = this->lookupVertex(task, "wrench::DagOfTasks::getChildren(): Non-existing vertex");
+        return this->getVertexChildren(vertex);
     }
 
     /**
@@ -196,16 +368,8 @@ namespace wrench {
  */
     long wrench::DagOfTasks::getNumberOfParents(const WorkflowTask *task) {
         // Find the vertex
-        if (this->task_map.find(task) == this->task_map.end() or this->task_map[task] >= this->task_list.size()) {
-            throw std::invalid_argument("wrench::DagOfTasks::getNumberOfParents(): Non-existing vertex");
-        }
-        auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::in_edge_iterator ei, edge_end;
-        long count = 0;
-        for (boost::tie(ei, edge_end) = boost::in_edges(vertex, dag); ei != edge_end; ++ei) {
-            count++;
-        }
-        return count;
+        auto vertex = this->lookupVertex(task, "wrench::DagOfTasks::getNumberOfParents(): Non-existing vertex");
+        return (long) this->num_parents[vertex];
     }
 
     /**
@@ -215,17 +379,222 @@ namespace wrench {
      */
     std::vector<WorkflowTask *> wrench::DagOfTasks::getParents(const WorkflowTask *task) {
         // Find the vertex
-        if (this->task_map.find(task) == this->task_map.end() or this->task_map[task] >= this->task_list.size()) {
-            throw std::invalid_argument("wrench::DagOfTasks::getParents(): Non-existing vertex");
-        }
-        auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::in_edge_iterator ei, edge_end;
+        auto vertex = this->lookupVertex(task, "wrench::DagOfTasks::getParents(): Non-existing vertex");
+        return this->getVertexParents(vertex);
+    }
+
+    /**
+     * @brief Method to get the number of children of a vertex
+     * @param vertex: the vertex index
+     * @return a number of children
+     */
+    long wrench::DagOfTasks::getVertexNumberOfChildren(vertex_t vertex) const {
+        this->checkVertex(vertex, "wrench::DagOfTasks::getVertexNumberOfChildren(): Non-existing vertex");
+        return (long) this->num_children[vertex];
+    }
+
+    /**
+     * @brief Method to get the children of a vertex
+     * @param vertex: the vertex index
+     * @return the children
+     */
+    std::vector<WorkflowTask *> wrench::DagOfTasks::getVertexChildren(vertex_t vertex) const {
+        this->checkVertex(vertex, "wrench::DagOfTasks::getVertexChildren(): Non-existing vertex");
+        std::vector<WorkflowTask *> children;
+        children.reserve(this->num_children[vertex]);
+        this->forEachNeighbor(vertex, true, [this, &children](vertex_t child) {
+            // Discard the const qualifier
+            children.push_back(const_cast<WorkflowTask *>(this->task_list[child]));
+        });
+        return children;
+    }
+
+    /**
+     * @brief Method to get the number of parents of a vertex
+     * @param vertex: the vertex index
+     * @return a number of parents
+     */
+    long wrench::DagOfTasks::getVertexNumberOfParents(vertex_t vertex) const {
+        this->checkVertex(vertex, "wrench::DagOfTasks::getVertexNumberOfParents(): Non-existing vertex");
+        return (long) this->num_parents[vertex];
+    }
+
+    /**
+     * @brief Method to get the parents of a vertex
+     * @param vertex: the vertex index
+     * @return the parents
+     */
+    std::vector<WorkflowTask *> wrench::DagOfTasks::getVertexParents(vertex_t vertex) const {
+        this->checkVertex(vertex, "wrench::DagOfTasks::getVertexParents(): Non-existing vertex");
         std::vector<WorkflowTask *> parents;
-        for (boost::tie(ei, edge_end) = boost::in_edges(vertex, dag); ei != edge_end; ++ei) {
+        parents.reserve(this->num_parents[vertex]);
+        this->forEachNeighbor(vertex, false, [this, &parents](vertex_t parent) {
             // Discard the const qualifier
-            parents.push_back(const_cast<WorkflowTask*>(dag[source(*ei, dag)].task));
-        }
+            parents.push_back(const_cast<WorkflowTask *>(this->task_list[parent]));
+        });
         return parents;
     }
 
-}// namespace wrench
\ No newline at end of file
+    /**
+     * @brief Determine whether enough vertices have been removed that the DAG should be compacted
+     * @return true or false
+     */
+    bool wrench::DagOfTasks::shouldBeCompacted() const {
+        return (this->num_removed_vertices > 1024) and (2 * this->num_removed_vertices >= this->task_list.size());
+    }
+
+    /**
+     * @brief Compact the DAG, i.e., reclaim the indices of removed vertices and
+     *        fold all edges into the CSR arrays
+     * @return a vector that maps each old vertex index to the new one (NO_VERTEX for removed vertices)
+     */
+    std::vector<vertex_t> wrench::DagOfTasks::compact() {
+        std::vector<vertex_t> new_indices(this->task_list.size(), NO_VERTEX);
+        unsigned long new_num_vertices = 0;
+        for (vertex_t v = 0; v < this->task_list.size(); v++) {
+            if (this->task_list[v] != nullptr) {
+                new_indices[v] = new_num_vertices++;
+            }
+        }
+        this->rebuildCSR(new_indices, new_num_vertices);
+        this->num_removed_vertices = 0;
+        return new_indices;
+    }
+
+    /**
+     * @brief Find the vertex of a task
+     * @param task: the task
+     * @param error_message: the message of the exception thrown if the task is not in the DAG
+     * @return the vertex index
+     */
+    vertex_t wrench::DagOfTasks::lookupVertex(const WorkflowTask *task, const std::string &error_message) {
+        auto it = this->task_map.find(task);
+        if (it == this->task_map.end()) {
+            throw std::invalid_argument(error_message);
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Check that a vertex exists
+     * @param vertex: the vertex index
+     * @param error_message: the message of the exception thrown if the vertex does not exist
+     */
+    void wrench::DagOfTasks::checkVertex(vertex_t vertex, const std::string &error_message) const {
+        if ((vertex >= this->task_list.size()) or (this->task_list[vertex] == nullptr)) {
+            throw std::invalid_argument(error_message);
+        }
+    }
+
+    /**
+     * @brief Remove all occurrences of a neighbor from the children (or parents) of a vertex
+     * @param vertex: the vertex
+     * @param neighbor: the neighbor
+     * @param children: true if the neighbor is to be removed from the children, false from the parents
+     * @return the number of removed occurrences
+     */
+    unsigned long wrench::DagOfTasks::removeFromAdjacency(vertex_t vertex, vertex_t neighbor, bool children) {
+        auto &offsets = children ? this->out_offsets : this->in_offsets;
+        auto &neighbors = children ? this->out_neighbors : this->in_neighbors;
+        unsigned long num_removed = 0;
+        if (vertex + 1 < offsets.size()) {
+            for (auto i = offsets[vertex]; i < offsets[vertex + 1]; i++) {
+                if (neighbors[i] == neighbor) {
+                    neighbors[i] = NO_VERTEX;
+                    num_removed++;
+                    if (children) {
+                        this->num_removed_csr_edges++;
+                    }
+                }
+            }
+        }
+        auto &added = (children ? this->added_children : this->added_parents)[vertex];
+        auto num_added_before = added.size();
+        added.erase(std::remove(added.begin(), added.end(), neighbor), added.end());
+        num_removed += num_added_before - added.size();
+        if (children) {
+            this->num_added_edges -= std::min<unsigned long>(this->num_added_edges, num_added_before - added.size());
+        }
+        auto &count = (children ? this->num_children : this->num_parents)[vertex];
+        count -= std::min<unsigned long>(count, num_removed);
+        return num_removed;
+    }
+
+    /**
+     * @brief Periodically rebuild the CSR arrays (without changing vertex indices), so that
+     *        neither the edges added since they were last rebuilt nor the removed edges that
+     *        still take up room in them grow unboundedly
+     */
+    void wrench::DagOfTasks::rebuildCSRIfNeeded() {
+        if ((this->num_added_edges <= std::max<unsigned long>(1024, this->out_neighbors.size())) and
+            (this->num_removed_csr_edges <= std::max<unsigned long>(1024, this->out_neighbors.size() / 2))) {
+            return;
+        }
+        std::vector<vertex_t> same_indices(this->task_list.size());
+        for (vertex_t v = 0; v < same_indices.size(); v++) {
+            same_indices[v] = v;
+        }
+        this->rebuildCSR(same_indices, same_indices.size());
+    }
+
+    /**
+     * @brief Rebuild the CSR arrays so that they contain all (and only) live edges
+     * @param new_indices: the new index of each vertex (NO_VERTEX for vertices to be discarded)
+     * @param new_num_vertices: the new number of vertices
+     */
+    void wrench::DagOfTasks::rebuildCSR(const std::vector<vertex_t> &new_indices, unsigned long new_num_vertices) {
+        std::vector<const WorkflowTask *> new_task_list(new_num_vertices, nullptr);
+        std::vector<unsigned long> new_num_children(new_num_vertices, 0);
+        std::vector<unsigned long> new_num_parents(new_num_vertices, 0);
+        for (vertex_t v = 0; v < this->task_list.size(); v++) {
+            if (new_indices[v] == NO_VERTEX) {
+                continue;
+            }
+            new_task_list[new_indices[v]] = this->task_list[v];
+            new_num_children[new_indices[v]] = this->num_children[v];
+            new_num_parents[new_indices[v]] = this->num_parents[v];
+        }
+
+        std::vector<unsigned long> new_out_offsets(new_num_vertices + 1, 0);
+        std::vector<unsigned long> new_in_offsets(new_num_vertices + 1, 0);
+        for (vertex_t v = 0; v < new_num_vertices; v++) {
+            new_out_offsets[v + 1] = new_out_offsets[v] + new_num_children[v];
+            new_in_offsets[v + 1] = new_in_offsets[v] + new_num_parents[v];
+        }
+        std::vector<vertex_t> new_out_neighbors(new_out_offsets[new_num_vertices]);
+        std::vector<vertex_t> new_in_neighbors(new_in_offsets[new_num_vertices]);
+        for (vertex_t v = 0; v < this->task_list.size(); v++) {
+            if (new_indices[v] == NO_VERTEX) {
+                continue;
+            }
+            auto out_position = new_out_offsets[new_indices[v]];
+            this->forEachNeighbor(v, true, [&](vertex_t child) {
+                new_out_neighbors[out_position++] = new_indices[child];
+            });
+            auto in_position = new_in_offsets[new_indices[v]];
+            this->forEachNeighbor(v, false, [&](vertex_t parent) {
+                new_in_neighbors[in_position++] = new_indices[parent];
+            });
+        }
+
+        for (vertex_t v = 0; v < new_num_vertices; v++) {
+            if (new_task_list[v] != nullptr) {
+                this->task_map[new_task_list[v]] = v;
+            }
+        }
+        this->task_list = std::move(new_task_list);
+        this->num_children = std::move(new_num_children);
+        this->num_parents = std::move(new_num_parents);
+        this->out_offsets = std::move(new_out_offsets);
+        this->out_neighbors = std::move(new_out_neighbors);
+        this->in_offsets = std::move(new_in_offsets);
+        this->in_neighbors = std::move(new_in_neighbors);
+        this->added_children.assign(new_num_vertices, {});
+        this->added_parents.assign(new_num_vertices, {});
+        this->num_removed_csr_edges = 0;
+        this->num_added_edges = 0;
+        this->visit_stamps.clear();
+        this->current_visit_stamp = 0;
+    }
+
+}// namespace wrench
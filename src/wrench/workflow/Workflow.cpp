@@ -7,6 +7,10 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
+#include <climits>
+#include <deque>
+
 #include <wrench/workflow/WorkflowTask.h>
 #include <wrench/simulation/Simulation.h>
 #include <wrench/logging/TerminalOutput.h>
@@ -21,7 +25,20 @@ namespace wrench {
      *         by these tasks
      */
     void Workflow::clear() {
+        // Tasks may outlive the workflow's indexes, so they should no longer point into them
+        for (auto const &t: this->tasks) {
+            t.second->ready_index = ULONG_MAX;
+            t.second->ready_cluster_index = ULONG_MAX;
+            t.second->top_level_index = ULONG_MAX;
+            t.second->bottom_level_index = ULONG_MAX;
+        }
         this->tasks.clear();
+        this->ready_tasks.clear();
+        this->ready_task_clusters.clear();
+        this->tasks_by_top_level.clear();
+        this->tasks_by_bottom_level.clear();
+        this->invalidateEntryExitTasks();
+        this->invalidateInputOutputFiles();
         //        for (auto const &f: this->data_files) {
         //            //            std::cerr << "SIMULATION REMOVING FILE " << f->getID() << "\n";
         //            Simulation::removeFile(f);
@@ -58,14 +75,17 @@ namespace wrench {
         // Create the WorkflowTask object
         auto task = std::shared_ptr<WorkflowTask>(new WorkflowTask(id, flops, min_num_cores, max_num_cores,
                                                                    memory_requirement));
-        this->ready_tasks.insert(task);
         // Associate the workflow to the task
         task->workflow = this;
+        this->addReadyTask(task.get());
 
         task->toplevel = 0;// upon creation, a task is an exit task
+        Workflow::addToLevelBucket(this->tasks_by_top_level, task->toplevel, task.get(), &WorkflowTask::top_level_index);
+        Workflow::addToLevelBucket(this->tasks_by_bottom_level, task->bottomlevel, task.get(), &WorkflowTask::bottom_level_index);
 
         // Create a DAG node for it
-        this->dag.addVertex(task.get());
+        task->dag_index = this->dag.addVertex(task.get());
+        this->invalidateEntryExitTasks();
 
         tasks[task->id] = task;// owner
 
@@ -94,6 +114,7 @@ namespace wrench {
         this->task_output_files.erase(file);
         this->task_input_files.erase(file);
         this->data_files.erase(file->getID());
+        this->invalidateInputOutputFiles();
         //        Simulation::removeFile(file);
     }
 
@@ -113,11 +134,17 @@ namespace wrench {
             throw std::invalid_argument("Workflow::removeTask(): Task '" + task->id + "' does not exist");
         }
 
-        // Remove the task from the ready tasks, just in case
-        if (this->ready_tasks.find(task) != this->ready_tasks.end()) {
-            this->ready_tasks.erase(task);
+        if (this->bulk_dependency_insertion_in_progress) {
+            throw std::runtime_error("Workflow::removeTask(): Cannot remove a task while a bulk dependency insertion is in progress");
         }
 
+        // Remove the task from the ready tasks, just in case
+        this->removeReadyTask(task.get());
+
+        // Remove the task from the level index
+        Workflow::removeFromLevelBucket(this->tasks_by_top_level, task->toplevel, task.get(), &WorkflowTask::top_level_index);
+        Workflow::removeFromLevelBucket(this->tasks_by_bottom_level, task->bottomlevel, task.get(), &WorkflowTask::bottom_level_index);
+
         // Fix all files
         for (auto &f: task->getInputFiles()) {
             this->task_input_files[f].erase(task);
@@ -128,34 +155,43 @@ namespace wrench {
         for (auto &f: task->getOutputFiles()) {
             this->task_output_files.erase(f);
         }
+        this->invalidateInputOutputFiles();
 
 
         // Get the children
-        auto children = this->dag.getChildren(task.get());
+        auto children = this->dag.getVertexChildren(task->dag_index);
 
         // Get the parents
-        auto parents = this->dag.getParents(task.get());
+        auto parents = this->dag.getVertexParents(task->dag_index);
 
         // Remove the task from the DAG
         this->dag.removeVertex(task.get());
+        task->dag_index = DagOfTasks::NO_VERTEX;
+
+        // Reclaim the indices of removed vertices if needed
+        if (this->dag.shouldBeCompacted()) {
+            auto new_indices = this->dag.compact();
+            for (auto const &t: this->tasks) {
+                if (t.second != task) {
+                    t.second->dag_index = new_indices[t.second->dag_index];
+                }
+            }
+        }
 
         // Remove the task from the master list
         tasks.erase(tasks.find(task->id));
+        this->invalidateEntryExitTasks();
 
         // Make the children ready, if the case
         for (auto const &child: children) {
             Workflow::updateReadiness(child);
         }
 
-        // Brute-force update of the top-level of all the children and the bottom-level
-        // of the parents of the removed task (if we're doing it dynamically)
+        // Update the top-levels from the children and the bottom-levels from the parents
+        // of the removed task (if we're doing it dynamically)
         if (this->update_top_bottom_levels_dynamically) {
-            for (auto const &child: children) {
-                child->updateTopLevel();
-            }
-            for (auto const &parent: parents) {
-                parent->updateBottomLevel();
-            }
+            this->propagateTopLevels(children);
+            this->propagateBottomLevels(parents);
         }
     }
 
@@ -192,6 +228,12 @@ namespace wrench {
             return;
         }
 
+        // In bulk mode, simply record the dependency (it will be checked and added upon commit)
+        if (this->bulk_dependency_insertion_in_progress) {
+            this->pending_control_dependencies.emplace_back(src.get(), dst.get(), redundant_dependencies);
+            return;
+        }
+
         if (this->dag.doesPathExist(dst.get(), src.get())) {
             throw std::runtime_error("Workflow::addControlDependency(): Adding dependency between task " + src->getID() +
                                      " and " + dst->getID() + " would create a cycle in the workflow graph");
@@ -200,10 +242,11 @@ namespace wrench {
         if (redundant_dependencies || not this->dag.doesPathExist(src.get(), dst.get())) {
             WRENCH_DEBUG("Adding control dependency %s-->%s", src->getID().c_str(), dst->getID().c_str());
             this->dag.addEdge(src.get(), dst.get());
+            this->invalidateEntryExitTasks();
 
             if (this->update_top_bottom_levels_dynamically) {
-                dst->updateTopLevel();
-                src->updateBottomLevel();
+                this->propagateTopLevels({dst.get()});
+                this->propagateBottomLevels({src.get()});
             }
 
             if (src->getState() != WorkflowTask::State::COMPLETED) {
@@ -213,6 +256,78 @@ namespace wrench {
         }
     }
 
+    /**
+     * @brief Start a bulk insertion of control dependencies. Until commitBulkDependencyInsertion()
+     *        is called, control dependencies (including those induced by task input/output files) are only
+     *        recorded, and they are then all checked for cycles and redundancy, and added to the workflow graph, at once.
+     *        This is much faster than adding dependencies one at a time when building large workflows.
+     */
+    void Workflow::beginBulkDependencyInsertion() {
+        if (this->bulk_dependency_insertion_in_progress) {
+            throw std::runtime_error("Workflow::beginBulkDependencyInsertion(): A bulk dependency insertion is already in progress");
+        }
+        this->bulk_dependency_insertion_in_progress = true;
+    }
+
+    /**
+     * @brief Commit a bulk insertion of control dependencies started with beginBulkDependencyInsertion().
+     *        Cycles are detected with a single topological sort of the workflow graph, redundant dependencies
+     *        (i.e., those added with redundant_dependencies=false and implied by other dependencies) are
+     *        removed in one pass, and top/bottom levels are recomputed once (if dynamic updates are enabled).
+     *
+     * @param ignore_cycle_creating_dependencies: if true, dependencies that would create a cycle are ignored (in which
+     *        case dependencies are added one at a time, in the order in which they were recorded). If false, a
+     *        std::runtime_error is thrown and no dependency is added.
+     */
+    void Workflow::commitBulkDependencyInsertion(bool ignore_cycle_creating_dependencies) {
+        if (not this->bulk_dependency_insertion_in_progress) {
+            throw std::runtime_error("Workflow::commitBulkDependencyInsertion(): No bulk dependency insertion is in progress");
+        }
+        this->bulk_dependency_insertion_in_progress = false;
+        auto pending = std::move(this->pending_control_dependencies);
+        this->pending_control_dependencies.clear();
+
+        std::vector<std::pair<WorkflowTask *, WorkflowTask *>> added_dependencies;
+        if (this->dag.addEdges(pending, added_dependencies)) {
+            this->invalidateEntryExitTasks();
+            for (auto const &dependency: added_dependencies) {
+                if (dependency.first->getState() != WorkflowTask::State::COMPLETED) {
+                    dependency.second->setInternalState(WorkflowTask::InternalState::TASK_NOT_READY);
+                    dependency.second->setState(WorkflowTask::State::NOT_READY);
+                }
+            }
+        } else {
+            if (not ignore_cycle_creating_dependencies) {
+                throw std::runtime_error("Workflow::commitBulkDependencyInsertion(): Adding the dependencies would create a cycle in the workflow graph");
+            }
+            // Fall back to adding dependencies one at a time so as to skip only the cycle-creating ones
+            bool dynamic_updates = this->update_top_bottom_levels_dynamically;
+            this->update_top_bottom_levels_dynamically = false;
+            for (auto const &dependency: pending) {
+                try {
+                    this->addControlDependency(std::get<0>(dependency)->getSharedPtr(),
+                                               std::get<1>(dependency)->getSharedPtr(),
+                                               std::get<2>(dependency));
+                } catch (std::runtime_error &) {
+                    // ignore
+                }
+            }
+            this->update_top_bottom_levels_dynamically = dynamic_updates;
+        }
+
+        if (this->update_top_bottom_levels_dynamically) {
+            this->updateAllTopBottomLevels();
+        }
+    }
+
+    /**
+     * @brief Determine whether a bulk insertion of control dependencies is in progress
+     * @return true or false
+     */
+    bool Workflow::isBulkDependencyInsertionInProgress() const {
+        return this->bulk_dependency_insertion_in_progress;
+    }
+
     /**
      * @brief Remove a control dependency between tasks  (does nothing if none)
      * @param src: the source task
@@ -223,6 +338,10 @@ namespace wrench {
             throw std::invalid_argument("Workflow::removeControlDependency(): Invalid arguments");
         }
 
+        if (this->bulk_dependency_insertion_in_progress) {
+            throw std::runtime_error("Workflow::removeControlDependency(): Cannot remove a dependency while a bulk dependency insertion is in progress");
+        }
+
         /*  Check that the two tasks don't have a data dependency; if so, just return */
         for (auto const &f: dst->getInputFiles()) {
             if (this->task_output_files[f] == src) {
@@ -233,10 +352,11 @@ namespace wrench {
         /* If there is an edge between the two tasks, remove it */
         if (this->dag.doesEdgeExist(src.get(), dst.get())) {
             this->dag.removeEdge(src.get(), dst.get());
+            this->invalidateEntryExitTasks();
 
             if (this->update_top_bottom_levels_dynamically) {
-                dst->updateTopLevel();
-                src->updateBottomLevel();
+                this->propagateTopLevels({dst.get()});
+                this->propagateBottomLevels({src.get()});
             }
 
             /* Update state */
@@ -291,6 +411,7 @@ namespace wrench {
     Workflow::Workflow() {
         static int workflow_number = 0;
         this->update_top_bottom_levels_dynamically = true;
+        this->bulk_dependency_insertion_in_progress = false;
         this->name = "workflow_" + std::to_string(workflow_number++);
     }
 
@@ -308,42 +429,104 @@ namespace wrench {
      * @return a vector of tasks
      */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getReadyTasks() {
-        std::vector<std::shared_ptr<WorkflowTask>> vector_of_ready_tasks(this->ready_tasks.begin(), this->ready_tasks.end());
-        return vector_of_ready_tasks;
+        return this->ready_tasks;
+    }
+
+    /**
+     * @brief Get the ready tasks without copying them. The returned reference
+     *        is only valid until the next task state change.
+     *
+     * @return a reference to a vector of tasks (in no particular order)
+     */
+    const std::vector<std::shared_ptr<WorkflowTask>> &Workflow::getReadyTasksView() const {
+        return this->ready_tasks;
     }
 
     /**
-     * @brief Get a map of clusters composed of ready tasks
+     * @brief Get a map of clusters composed of ready tasks. Each ready task that does not have a cluster ID
+     *        is in its own cluster, indexed by the task's ID.
      *
      * @return map of workflow cluster tasks
      */
     std::map<std::string, std::vector<std::shared_ptr<WorkflowTask>>> Workflow::getReadyClusters() const {
-        // TODO: Implement this more efficiently
-
         std::map<std::string, std::vector<std::shared_ptr<WorkflowTask>>> task_map;
 
-        for (auto &it: this->tasks) {
-            std::shared_ptr<WorkflowTask> task = it.second;
+        for (auto const &cluster: this->ready_task_clusters) {
+            task_map[cluster.first] = cluster.second;
+        }
+        for (auto const &task: this->ready_tasks) {
+            if (task->cluster_id.empty()) {
+                task_map[task->getID()] = {task};
+            }
+        }
+        return task_map;
+    }
 
-            if (task->getState() == WorkflowTask::State::READY) {
-                if (task->getClusterID().empty()) {
-                    task_map[task->getID()] = {task};
+    /**
+     * @brief Get the ready tasks with a given cluster ID without copying them. The returned reference
+     *        is only valid until the next task state or cluster ID change.
+     *
+     * @param cluster_id: a (non-empty) cluster ID
+     * @return a reference to a vector of tasks (in no particular order)
+     */
+    const std::vector<std::shared_ptr<WorkflowTask>> &Workflow::getReadyClusterView(const std::string &cluster_id) const {
+        static const std::vector<std::shared_ptr<WorkflowTask>> no_tasks;
+        auto it = this->ready_task_clusters.find(cluster_id);
+        return (it == this->ready_task_clusters.end()) ? no_tasks : it->second;
+    }
 
-                } else {
-                    if (task_map.find(task->getClusterID()) == task_map.end()) {
-                        task_map[task->getClusterID()] = {task};
-                    } else {
-                        // add to clustered task
-                        task_map[task->getClusterID()].push_back(task);
-                    }
-                }
-            } else {
-                if (task_map.find(task->getClusterID()) != task_map.end()) {
-                    task_map[task->getClusterID()].push_back(task);
-                }
+    /**
+     * @brief Get all ready tasks that have a cluster ID, indexed by cluster ID, without copying them.
+     *        The returned reference is only valid until the next task state or cluster ID change.
+     *
+     * @return a reference to a map of vectors of tasks
+     */
+    const std::unordered_map<std::string, std::vector<std::shared_ptr<WorkflowTask>>> &Workflow::getReadyClustersView() const {
+        return this->ready_task_clusters;
+    }
+
+    /**
+     * @brief Add a task to the ready tasks (does nothing if already there)
+     * @param task: the task
+     */
+    void Workflow::addReadyTask(WorkflowTask *task) {
+        if (task->ready_index != ULONG_MAX) {
+            return;
+        }
+        task->ready_index = this->ready_tasks.size();
+        this->ready_tasks.push_back(task->getSharedPtr());
+        if (not task->cluster_id.empty()) {
+            auto &cluster = this->ready_task_clusters[task->cluster_id];
+            task->ready_cluster_index = cluster.size();
+            cluster.push_back(task->getSharedPtr());
+        }
+    }
+
+    /**
+     * @brief Remove a task from the ready tasks (does nothing if not there)
+     * @param task: the task
+     */
+    void Workflow::removeReadyTask(WorkflowTask *task) {
+        if (task->ready_index == ULONG_MAX) {
+            return;
+        }
+        // Swap with the last task and pop
+        this->ready_tasks.back()->ready_index = task->ready_index;
+        std::swap(this->ready_tasks[task->ready_index], this->ready_tasks.back());
+        this->ready_tasks.pop_back();
+        task->ready_index = ULONG_MAX;
+
+        if (task->ready_cluster_index != ULONG_MAX) {
+            auto it = this->ready_task_clusters.find(task->cluster_id);
+            auto &cluster = it->second;
+            cluster.back()->ready_cluster_index = task->ready_cluster_index;
+            std::swap(cluster[task->ready_cluster_index], cluster.back());
+            cluster.pop_back();
+            if (cluster.empty()) {
+                this->ready_task_clusters.erase(it);
             }
+            task->ready_cluster_index = ULONG_MAX;
         }
-        return task_map;
     }
 
     /**
@@ -370,6 +553,15 @@ namespace wrench {
         return this->tasks;
     }
 
+    /**
+     * @brief Get a (non-copying) read-only view of all tasks in the workflow
+     *
+     * @return a reference to the map of tasks, indexed by ID (invalidated when tasks are added/removed)
+     */
+    const std::map<std::string, std::shared_ptr<WorkflowTask>> &Workflow::getTaskMapView() const {
+        return this->tasks;
+    }
+
     /**
      * @brief Get the list of all tasks in the workflow
      *
@@ -377,6 +569,7 @@ namespace wrench {
      */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getTasks() const {
         std::vector<std::shared_ptr<WorkflowTask>> all_tasks;
+        all_tasks.reserve(this->tasks.size());
         for (auto const &t: this->tasks) {
             all_tasks.push_back(t.second);
         }
@@ -394,7 +587,10 @@ namespace wrench {
         if (task == nullptr) {
             throw std::invalid_argument("Workflow::getTaskChildren(): Invalid arguments");
         }
-        auto raw_ptrs = this->dag.getChildren(task.get());
+        if (task->workflow != this) {
+            throw std::invalid_argument("Workflow::getTaskChildren(): Task '" + task->getID() + "' is not in this workflow");
+        }
+        auto raw_ptrs = this->dag.getVertexChildren(task->dag_index);
         std::vector<std::shared_ptr<WorkflowTask>> shared_ptrs;
         shared_ptrs.reserve(raw_ptrs.size());
         for (const auto &raw_ptr: raw_ptrs) {
@@ -415,7 +611,10 @@ namespace wrench {
         if (task == nullptr) {
             throw std::invalid_argument("Workflow::getTaskNumberOfChildren(): Invalid arguments");
         }
-        return this->dag.getNumberOfChildren(task.get());
+        if (task->workflow != this) {
+            throw std::invalid_argument("Workflow::getTaskNumberOfChildren(): Task '" + task->getID() + "' is not in this workflow");
+        }
+        return this->dag.getVertexNumberOfChildren(task->dag_index);
     }
 
     /**
@@ -429,7 +628,10 @@ namespace wrench {
         if (task == nullptr) {
             throw std::invalid_argument("Workflow::getTaskParents(): Invalid arguments");
         }
-        auto raw_ptrs = this->dag.getParents(task.get());
+        if (task->workflow != this) {
+            throw std::invalid_argument("Workflow::getTaskParents(): Task '" + task->getID() + "' is not in this workflow");
+        }
+        auto raw_ptrs = this->dag.getVertexParents(task->dag_index);
         std::vector<std::shared_ptr<WorkflowTask>> shared_ptrs;
         shared_ptrs.reserve(raw_ptrs.size());
         for (auto const &raw_ptr: raw_ptrs) {
@@ -449,7 +651,10 @@ namespace wrench {
         if (task == nullptr) {
             throw std::invalid_argument("Workflow::getTaskNumberOfParents(): Invalid arguments");
         }
-        return this->dag.getNumberOfParents(task.get());
+        if (task->workflow != this) {
+            throw std::invalid_argument("Workflow::getTaskNumberOfParents(): Task '" + task->getID() + "' is not in this workflow");
+        }
+        return this->dag.getVertexNumberOfParents(task->dag_index);
     }
 
     /**
@@ -459,19 +664,18 @@ namespace wrench {
      * @return a map of files indexed by file ID
      */
     std::map<std::string, std::shared_ptr<DataFile>> Workflow::getInputFileMap() const {
-        std::map<std::string, std::shared_ptr<DataFile>> input_files;
-        for (auto const &f: Simulation::getFileMap()) {
-            // If the file is not input to any task, then it can't be what we want
-            if (this->task_input_files.find(f.second) == this->task_input_files.end()) {
-                continue;
-            }
-            // If the file is output to a task, then it can't be what we want
-            if (this->task_output_files.find(f.second) != this->task_output_files.end()) {
-                continue;
-            }
-            input_files[f.second->getID()] = f.second;
-        }
-        return input_files;
+        return this->getInputFileMapView();
+    }
+
+    /**
+     * @brief Retrieve a (non-copying) read-only view of the input files of the workflow (i.e., those files
+     *        that are input to some tasks but output from none)
+     *
+     * @return a reference to a map of files indexed by file ID (invalidated when the workflow is modified)
+     */
+    const std::map<std::string, std::shared_ptr<DataFile>> &Workflow::getInputFileMapView() const {
+        this->computeInputOutputFiles();
+        return this->input_files;
     }
 
     /**
@@ -482,15 +686,9 @@ namespace wrench {
      */
     std::vector<std::shared_ptr<DataFile>> Workflow::getInputFiles() const {
         std::vector<std::shared_ptr<DataFile>> input_files;
-        for (auto const &f: Simulation::getFileMap()) {
-            // If the file is not input to any task, then it can't be what we want
-            if (this->task_input_files.find(f.second) == this->task_input_files.end()) {
-                continue;
-            }
-            // If the file is output to a task, then it can't be what we want
-            if (this->task_output_files.find(f.second) != this->task_output_files.end()) {
-                continue;
-            }
+        auto const &input_file_map = this->getInputFileMapView();
+        input_files.reserve(input_file_map.size());
+        for (auto const &f: input_file_map) {
             input_files.push_back(f.second);
         }
         return input_files;
@@ -503,19 +701,18 @@ namespace wrench {
     * @return a map of files indexed by ID
     */
     std::map<std::string, std::shared_ptr<DataFile>> Workflow::getOutputFileMap() const {
-        std::map<std::string, std::shared_ptr<DataFile>> output_files;
-        for (auto const &f: Simulation::getFileMap()) {
-            // If the file is not output to any task, then it can't be what we want
-            if (this->task_output_files.find(f.second) == this->task_output_files.end()) {
-                continue;
-            }
-            // If the file is input to a task, then it can't be what we want
-            if (this->task_input_files.find(f.second) != this->task_input_files.end() and (not this->task_input_files.at(f.second).empty())) {
-                continue;
-            }
-            output_files[f.second->getID()] = f.second;
-        }
-        return output_files;
+        return this->getOutputFileMapView();
+    }
+
+    /**
+     * @brief Retrieve a (non-copying) read-only view of the output files of the workflow (i.e., those files
+     *        that are output from some tasks but input to none)
+     *
+     * @return a reference to a map of files indexed by file ID (invalidated when the workflow is modified)
+     */
+    const std::map<std::string, std::shared_ptr<DataFile>> &Workflow::getOutputFileMapView() const {
+        this->computeInputOutputFiles();
+        return this->output_files;
     }
 
     /**
@@ -526,18 +723,47 @@ namespace wrench {
    */
     std::vector<std::shared_ptr<DataFile>> Workflow::getOutputFiles() const {
         std::vector<std::shared_ptr<DataFile>> output_files;
-        for (auto const &f: Simulation::getFileMap()) {
-            // If the file is not output to any task, then it can't be what we want
-            if (this->task_output_files.find(f.second) == this->task_output_files.end()) {
+        auto const &output_file_map = this->getOutputFileMapView();
+        output_files.reserve(output_file_map.size());
+        for (auto const &f: output_file_map) {
+            output_files.push_back(f.second);
+        }
+        return output_files;
+    }
+
+    /**
+     * @brief Mark the cached input/output files as out of date
+     */
+    void Workflow::invalidateInputOutputFiles() {
+        this->input_output_files_are_valid = false;
+    }
+
+    /**
+     * @brief Recompute the cached input/output files, if out of date. Only the files known
+     *        to the workflow's tasks are looked at, rather than all the files in the simulation.
+     */
+    void Workflow::computeInputOutputFiles() const {
+        if (this->input_output_files_are_valid) {
+            return;
+        }
+        this->input_files.clear();
+        this->output_files.clear();
+        for (auto const &f: this->task_input_files) {
+            // If the file is output to a task, then it can't be what we want
+            if (f.second.empty() or (this->task_output_files.find(f.first) != this->task_output_files.end())) {
                 continue;
             }
+            this->input_files[f.first->getID()] = f.first;
+        }
+        for (auto const &f: this->task_output_files) {
             // If the file is input to a task, then it can't be what we want
-            if (this->task_input_files.find(f.second) != this->task_input_files.end() and (not this->task_input_files.at(f.second).empty())) {
+            auto it = this->task_input_files.find(f.first);
+            if ((it != this->task_input_files.end()) and (not it->second.empty())) {
                 continue;
             }
-            output_files.push_back(f.second);
+            this->output_files[f.first->getID()] = f.first;
         }
-        return output_files;
+        this->input_output_files_are_valid = true;
     }
 
     /**
@@ -559,64 +785,161 @@ namespace wrench {
      * @brief Returns all tasks with top-levels in a range
      * @param min: the low end of the range (inclusive)
      * @param max: the high end of the range (inclusive)
-     * @return a vector of tasks
+     * @return a vector of tasks, in the same order as in getTasks() (i.e., sorted by ID)
      */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getTasksInTopLevelRange(int min, int max) const {
-        std::vector<std::shared_ptr<WorkflowTask>> to_return;
-        for (auto const &task: this->getTasks()) {
-            if ((task->getTopLevel() >= min) and (task->getTopLevel() <= max)) {
-                to_return.push_back(task);
-            }
-        }
-        return to_return;
+        return this->getTasksInLevelRange(this->tasks_by_top_level, min, max);
     }
 
     /**
      * @brief Returns all tasks with bottom-levels in a range
      * @param min: the low end of the range (inclusive)
      * @param max: the high end of the range (inclusive)
-     * @return a vector of tasks
+     * @return a vector of tasks, in the same order as in getTasks() (i.e., sorted by ID)
      */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getTasksInBottomLevelRange(int min, int max) const {
+        return this->getTasksInLevelRange(this->tasks_by_bottom_level, min, max);
+    }
+
+    /**
+     * @brief Returns all tasks in a range of level buckets
+     * @param buckets: the level buckets
+     * @param min: the low end of the range (inclusive)
+     * @param max: the high end of the range (inclusive)
+     * @return a vector of tasks
+     */
+    std::vector<std::shared_ptr<WorkflowTask>> Workflow::getTasksInLevelRange(const std::vector<std::vector<WorkflowTask *>> &buckets, int min, int max) const {
         std::vector<std::shared_ptr<WorkflowTask>> to_return;
-        for (auto const &task: this->getTasks()) {
-            if ((task->getBottomLevel() >= min) and (task->getBottomLevel() <= max)) {
-                to_return.push_back(task);
+        long low = std::max<long>(min, 0);
+        long high = std::min<long>(max, (long) buckets.size() - 1);
+        for (long level = low; level <= high; level++) {
+            for (auto const &task: buckets[level]) {
+                to_return.push_back(task->getSharedPtr());
             }
         }
+        // Only the returned tasks are sorted, rather than all tasks being scanned in ID order
+        std::sort(to_return.begin(), to_return.end(),
+                  [](const std::shared_ptr<WorkflowTask> &lhs, const std::shared_ptr<WorkflowTask> &rhs) {
+                      return lhs->getID() < rhs->getID();
+                  });
         return to_return;
     }
 
     /**
-     * @brief Get the list of exit tasks of the workflow, i.e., those tasks
+     * @brief Set the top-level of a task, keeping the level index up to date
+     * @param task: the task
+     * @param level: the top-level
+     */
+    void Workflow::setTaskTopLevel(WorkflowTask *task, int level) {
+        if (task->toplevel == level) {
+            return;
+        }
+        Workflow::removeFromLevelBucket(this->tasks_by_top_level, task->toplevel, task, &WorkflowTask::top_level_index);
+        task->toplevel = level;
+        Workflow::addToLevelBucket(this->tasks_by_top_level, task->toplevel, task, &WorkflowTask::top_level_index);
+    }
+
+    /**
+     * @brief Set the bottom-level of a task, keeping the level index up to date
+     * @param task: the task
+     * @param level: the bottom-level
+     */
+    void Workflow::setTaskBottomLevel(WorkflowTask *task, int level) {
+        if (task->bottomlevel == level) {
+            return;
+        }
+        Workflow::removeFromLevelBucket(this->tasks_by_bottom_level, task->bottomlevel, task, &WorkflowTask::bottom_level_index);
+        task->bottomlevel = level;
+        Workflow::addToLevelBucket(this->tasks_by_bottom_level, task->bottomlevel, task, &WorkflowTask::bottom_level_index);
+    }
+
+    /**
+     * @brief Rebuild the level index from scratch (after all levels have been recomputed)
+     */
+    void Workflow::rebuildLevelIndex() {
+        this->tasks_by_top_level.clear();
+        this->tasks_by_bottom_level.clear();
+        for (auto const &t: this->tasks) {
+            t.second->top_level_index = ULONG_MAX;
+            t.second->bottom_level_index = ULONG_MAX;
+            Workflow::addToLevelBucket(this->tasks_by_top_level, t.second->toplevel, t.second.get(), &WorkflowTask::top_level_index);
+            Workflow::addToLevelBucket(this->tasks_by_bottom_level, t.second->bottomlevel, t.second.get(), &WorkflowTask::bottom_level_index);
+        }
+    }
+
+    /**
+     * @brief Add a task to a level bucket
+     * @param buckets: the level buckets
+     * @param level: the task's level (nothing is done if negative, i.e., unknown)
+     * @param task: the task
+     * @param position: the task's field that holds its position in the bucket
+     */
+    void Workflow::addToLevelBucket(std::vector<std::vector<WorkflowTask *>> &buckets, int level,
+                                    WorkflowTask *task, unsigned long WorkflowTask::*position) {
+        if (level < 0) {
+            return;
+        }
+        if (buckets.size() <= (unsigned long) level) {
+            buckets.resize(level + 1);
+        }
+        task->*position = buckets[level].size();
+        buckets[level].push_back(task);
+    }
+
+    /**
+     * @brief Remove a task from a level bucket
+     * @param buckets: the level buckets
+     * @param level: the task's level (nothing is done if negative, i.e., unknown)
+     * @param task: the task
+     * @param position: the task's field that holds its position in the bucket
+     */
+    void Workflow::removeFromLevelBucket(std::vector<std::vector<WorkflowTask *>> &buckets, int level,
+                                         WorkflowTask *task, unsigned long WorkflowTask::*position) {
+        if ((level < 0) or (task->*position == ULONG_MAX)) {
+            return;
+        }
+        auto &bucket = buckets[level];
+        // Swap with the last task and pop
+        bucket.back()->*position = task->*position;
+        std::swap(bucket[task->*position], bucket.back());
+        bucket.pop_back();
+        task->*position = ULONG_MAX;
+        // Trim empty top buckets
+        while ((not buckets.empty()) and buckets.back().empty()) {
+            buckets.pop_back();
+        }
+    }
+
+    /**
+     * @brief Get the list of entry tasks of the workflow, i.e., those tasks
      *        that don't have parents
      * @return A map of tasks indexed by their IDs
      */
     std::map<std::string, std::shared_ptr<WorkflowTask>> Workflow::getEntryTaskMap() const {
-        // TODO: This could be done more efficiently at the DAG level
-        std::map<std::string, std::shared_ptr<WorkflowTask>> entry_tasks;
-        for (auto const &t: this->tasks) {
-            auto task = t.second;
-            if (task->getNumberOfParents() == 0) {
-                entry_tasks[task->getID()] = task;
-            }
-        }
-        return entry_tasks;
+        return this->getEntryTaskMapView();
+    }
+
+    /**
+     * @brief Get a (non-copying) read-only view of the entry tasks of the workflow, i.e., those tasks
+     *        that don't have parents
+     * @return A reference to a map of tasks indexed by their IDs (invalidated when the workflow is modified)
+     */
+    const std::map<std::string, std::shared_ptr<WorkflowTask>> &Workflow::getEntryTaskMapView() const {
+        this->computeEntryExitTasks();
+        return this->entry_tasks;
     }
 
     /**
-     * @brief Get the list of exit tasks of the workflow, i.e., those tasks
+     * @brief Get the list of entry tasks of the workflow, i.e., those tasks
      *        that don't have parents
      * @return A vector of tasks
      */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getEntryTasks() const {
-        // TODO: This could be done more efficiently at the DAG level
         std::vector<std::shared_ptr<WorkflowTask>> entry_tasks;
-        for (auto const &t: this->tasks) {
-            auto task = t.second;
-            if (task->getNumberOfParents() == 0) {
-                entry_tasks.push_back(task);
-            }
+        auto const &entry_task_map = this->getEntryTaskMapView();
+        entry_tasks.reserve(entry_task_map.size());
+        for (auto const &t: entry_task_map) {
+            entry_tasks.push_back(t.second);
         }
         return entry_tasks;
     }
@@ -627,15 +950,17 @@ namespace wrench {
      * @return A map of tasks indexed by their IDs
      */
     std::map<std::string, std::shared_ptr<WorkflowTask>> Workflow::getExitTaskMap() const {
-        // TODO: This could be done more efficiently at the DAG level
-        std::map<std::string, std::shared_ptr<WorkflowTask>> exit_tasks;
-        for (auto const &t: this->tasks) {
-            auto task = t.second;
-            if (task->getNumberOfChildren() == 0) {
-                exit_tasks[task->getID()] = task;
-            }
-        }
-        return exit_tasks;
+        return this->getExitTaskMapView();
+    }
+
+    /**
+     * @brief Get a (non-copying) read-only view of the exit tasks of the workflow, i.e., those tasks
+     *        that don't have children
+     * @return A reference to a map of tasks indexed by their IDs (invalidated when the workflow is modified)
+     */
+    const std::map<std::string, std::shared_ptr<WorkflowTask>> &Workflow::getExitTaskMapView() const {
+        this->computeEntryExitTasks();
+        return this->exit_tasks;
     }
 
     /**
@@ -644,15 +969,40 @@ namespace wrench {
     * @return A vector of tasks
     */
     std::vector<std::shared_ptr<WorkflowTask>> Workflow::getExitTasks() const {
-        // TODO: This could be done more efficiently at the DAG level
         std::vector<std::shared_ptr<WorkflowTask>> exit_tasks;
+        auto const &exit_task_map = this->getExitTaskMapView();
+        exit_tasks.reserve(exit_task_map.size());
+        for (auto const &t: exit_task_map) {
+            exit_tasks.push_back(t.second);
+        }
+        return exit_tasks;
+    }
+
+    /**
+     * @brief Mark the cached entry/exit tasks as out of date
+     */
+    void Workflow::invalidateEntryExitTasks() {
+        this->entry_exit_tasks_are_valid = false;
+    }
+
+    /**
+     * @brief Recompute the cached entry/exit tasks, if out of date
+     */
+    void Workflow::computeEntryExitTasks() const {
+        if (this->entry_exit_tasks_are_valid) {
+            return;
+        }
+        this->entry_tasks.clear();
+        this->exit_tasks.clear();
         for (auto const &t: this->tasks) {
-            auto task = t.second;
-            if (task->getNumberOfChildren() == 0) {
-                exit_tasks.push_back(task);
+            if (this->dag.getVertexNumberOfParents(t.second->dag_index) == 0) {
+                this->entry_tasks.emplace_hint(this->entry_tasks.end(), t.first, t.second);
+            }
+            if (this->dag.getVertexNumberOfChildren(t.second->dag_index) == 0) {
+                this->exit_tasks.emplace_hint(this->exit_tasks.end(), t.first, t.second);
             }
         }
-        return exit_tasks;
+        this->entry_exit_tasks_are_valid = true;
     }
 
     /**
@@ -660,16 +1010,123 @@ namespace wrench {
      * @return the number of levels
      */
     unsigned long Workflow::getNumLevels() const {
-        int max_top_level = 0;
-        for (auto const &t: this->tasks) {
-            auto task = t.second.get();
-            if (task->getNumberOfChildren() == 0) {
-                if (1 + task->getTopLevel() > max_top_level) {
-                    max_top_level = 1 + task->getTopLevel();
+        // The highest top-level is always that of an exit task, and empty top buckets are trimmed
+        return this->tasks_by_top_level.size();
+    }
+
+    /**
+     * @brief Returns the length of the workflow's critical path in flops, i.e., the largest
+     *        total number of flops of the tasks on a path from an entry task to an exit task
+     *        (only up to date if dynamic top/bottom level updates are enabled, or after
+     *        a call to updateAllTopBottomLevels())
+     * @return a number of flops
+     */
+    double Workflow::getCriticalPathFlops() const {
+        double critical_path_flops = 0;
+        for (auto const &t: this->getEntryTaskMapView()) {
+            critical_path_flops = std::max<double>(critical_path_flops, t.second->flop_weighted_bottomlevel);
+        }
+        return critical_path_flops;
+    }
+
+    /**
+     * @brief Returns the length of the workflow's critical path in bytes, i.e., the largest
+     *        total size of the input files of the tasks on a path from an entry task to an exit task
+     *        (only up to date if dynamic top/bottom level updates are enabled, or after
+     *        a call to updateAllTopBottomLevels())
+     * @return a number of bytes
+     */
+    double Workflow::getCriticalPathBytes() const {
+        double critical_path_bytes = 0;
+        for (auto const &t: this->getEntryTaskMapView()) {
+            critical_path_bytes = std::max<double>(critical_path_bytes, t.second->byte_weighted_bottomlevel);
+        }
+        return critical_path_bytes;
+    }
+
+    /**
+     * @brief Recompute the top-levels of tasks, and propagate changes to descendants. Only
+     *        tasks whose top-level has changed have their children (re)visited.
+     * @param frontier: the tasks whose top-levels may be out of date
+     */
+    void Workflow::propagateTopLevels(const std::vector<WorkflowTask *> &frontier) {
+        std::deque<WorkflowTask *> worklist;
+        for (auto const &task: frontier) {
+            if (not task->in_level_worklist) {
+                task->in_level_worklist = true;
+                worklist.push_back(task);
+            }
+        }
+
+        while (not worklist.empty()) {
+            auto task = worklist.front();
+            worklist.pop_front();
+            task->in_level_worklist = false;
+
+            int level = 0;
+            for (auto const &parent: this->dag.getVertexParents(task->dag_index)) {
+                level = std::max<int>(level, 1 + parent->toplevel);
+            }
+            if (level == task->toplevel) {
+                continue;
+            }
+            this->setTaskTopLevel(task, level);
+
+            for (auto const &child: this->dag.getVertexChildren(task->dag_index)) {
+                if (not child->in_level_worklist) {
+                    child->in_level_worklist = true;
+                    worklist.push_back(child);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Recompute the bottom-levels (and flop/byte-weighted bottom-levels) of tasks, and
+     *        propagate changes to ancestors. Only tasks whose bottom-levels have changed
+     *        have their parents (re)visited.
+     * @param frontier: the tasks whose bottom-levels may be out of date
+     */
+    void Workflow::propagateBottomLevels(const std::vector<WorkflowTask *> &frontier) {
+        std::deque<WorkflowTask *> worklist;
+        for (auto const &task: frontier) {
+            if (not task->in_level_worklist) {
+                task->in_level_worklist = true;
+                worklist.push_back(task);
+            }
+        }
+
+        while (not worklist.empty()) {
+            auto task = worklist.front();
+            worklist.pop_front();
+            task->in_level_worklist = false;
+
+            int level = 0;
+            double flops_below = 0;
+            double bytes_below = 0;
+            for (auto const &child: this->dag.getVertexChildren(task->dag_index)) {
+                level = std::max<int>(level, 1 + child->bottomlevel);
+                flops_below = std::max<double>(flops_below, child->flop_weighted_bottomlevel);
+                bytes_below = std::max<double>(bytes_below, child->byte_weighted_bottomlevel);
+            }
+            double flop_weighted_level = task->flops + flops_below;
+            double byte_weighted_level = task->getInputBytes() + bytes_below;
+            if ((level == task->bottomlevel) and
+                (flop_weighted_level == task->flop_weighted_bottomlevel) and
+                (byte_weighted_level == task->byte_weighted_bottomlevel)) {
+                continue;
+            }
+            this->setTaskBottomLevel(task, level);
+            task->flop_weighted_bottomlevel = flop_weighted_level;
+            task->byte_weighted_bottomlevel = byte_weighted_level;
+
+            for (auto const &parent: this->dag.getVertexParents(task->dag_index)) {
+                if (not parent->in_level_worklist) {
+                    parent->in_level_worklist = true;
+                    worklist.push_back(parent);
                 }
             }
         }
-        return max_top_level;
     }
 
     /**
@@ -781,36 +1238,51 @@ namespace wrench {
      */
     void Workflow::updateAllTopBottomLevels() {
 
-        // Compute entry tasks
-        std::vector<std::shared_ptr<WorkflowTask>> entry_tasks;
+        // Compute a topological order of the tasks
+        std::vector<WorkflowTask *> order;
+        order.reserve(this->tasks.size());
+        std::unordered_map<WorkflowTask *, long> num_unvisited_parents;
         for (auto const &t: this->tasks) {
-            if (t.second->getNumberOfParents() == 0) {
-                entry_tasks.push_back(t.second);
+            auto num_parents = this->dag.getVertexNumberOfParents(t.second->dag_index);
+            if (num_parents == 0) {
+                order.push_back(t.second.get());
+            } else {
+                num_unvisited_parents[t.second.get()] = num_parents;
             }
         }
-        // Compute exit tasks
-        std::vector<std::shared_ptr<WorkflowTask>> exit_tasks;
-        for (auto const &t: this->tasks) {
-            if (t.second->getNumberOfChildren() == 0) {
-                exit_tasks.push_back(t.second);
+        for (unsigned long i = 0; i < order.size(); i++) {
+            for (auto const &child: this->dag.getVertexChildren(order[i]->dag_index)) {
+                if (--num_unvisited_parents[child] == 0) {
+                    order.push_back(child);
+                }
             }
         }
 
-        // Reset all levels to -1 for memoization purposes
-        for (auto const &t: this->tasks) {
-            t.second->toplevel = -1;
-            t.second->bottomlevel = -1;
+        // Update top levels in topological order
+        for (auto const &task: order) {
+            task->toplevel = 0;
+            for (auto const &parent: this->dag.getVertexParents(task->dag_index)) {
+                task->toplevel = std::max<int>(task->toplevel, 1 + parent->toplevel);
+            }
         }
 
-        // Update top levels recursively
-        for (auto const &et: exit_tasks) {
-            et->computeTopLevel();
+        // Update bottom levels in reverse topological order
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            auto task = *it;
+            task->bottomlevel = 0;
+            double flops_below = 0;
+            double bytes_below = 0;
+            for (auto const &child: this->dag.getVertexChildren(task->dag_index)) {
+                task->bottomlevel = std::max<int>(task->bottomlevel, 1 + child->bottomlevel);
+                flops_below = std::max<double>(flops_below, child->flop_weighted_bottomlevel);
+                bytes_below = std::max<double>(bytes_below, child->byte_weighted_bottomlevel);
+            }
+            task->flop_weighted_bottomlevel = task->flops + flops_below;
+            task->byte_weighted_bottomlevel = task->getInputBytes() + bytes_below;
         }
 
-        // Update bottom levels recursively
-        for (auto const &et: entry_tasks) {
-            et->computeBottomLevel();
-        }
+        // Re-index all tasks by level at once
+        this->rebuildLevelIndex();
     }
 
 }// namespace wrench
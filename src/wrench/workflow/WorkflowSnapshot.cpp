@@ -0,0 +1,489 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <wrench/workflow/WorkflowSnapshot.h>
+#include <wrench/workflow/Workflow.h>
+#include <wrench/simulation/Simulation.h>
+#include <wrench/logging/TerminalOutput.h>
+
+WRENCH_LOG_CATEGORY(wrench_core_workflow_snapshot, "Log category for WorkflowSnapshot");
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    namespace {
+
+        /* Snapshot file layout (native byte order, all sections 8-byte aligned):
+         *   Header
+         *   uint64_t string_offsets[num_strings + 1]
+         *   char     string_data[string_data_size]     (padded to 8 bytes)
+         *   FileRecord files[num_files]
+         *   TaskRecord tasks[num_tasks]
+         *   uint64_t input_offsets[num_tasks + 1],  uint64_t input_files[num_input_files]
+         *   uint64_t output_offsets[num_tasks + 1], uint64_t output_files[num_output_files]
+         *   uint64_t child_offsets[num_tasks + 1],  uint64_t children[num_edges]
+         */
+
+        const char SNAPSHOT_MAGIC[8] = {'W', 'R', 'E', 'N', 'C', 'H', 'W', 'S'};
+        const uint32_t SNAPSHOT_BYTE_ORDER_MARK = 0x01020304;
+
+        struct Header {
+            char magic[8];
+            uint32_t byte_order_mark;
+            uint32_t version;
+            uint64_t num_strings;
+            uint64_t string_data_size;
+            uint64_t num_files;
+            uint64_t num_tasks;
+            uint64_t num_input_files;
+            uint64_t num_output_files;
+            uint64_t num_edges;
+        };
+
+        struct FileRecord {
+            uint64_t id;// index in the string table
+            uint64_t size;
+        };
+
+        enum ParallelModelKind : uint32_t {
+            CONSTANT_EFFICIENCY = 0,
+            AMDAHL = 1
+        };
+
+        struct TaskRecord {
+            uint64_t id;        // index in the string table
+            uint64_t cluster_id;// index in the string table
+            uint64_t color;     // index in the string table
+            double flops;
+            uint64_t min_num_cores;
+            uint64_t max_num_cores;
+            uint64_t memory_requirement;
+            uint64_t priority;
+            uint64_t bytes_read;
+            uint64_t bytes_written;
+            uint32_t parallel_model;
+            uint32_t padding;
+            double parallel_model_parameter;
+        };
+
+        /**
+         * @brief Round a size up to a multiple of 8
+         * @param size: a size
+         * @return the rounded size
+         */
+        uint64_t align8(uint64_t size) {
+            return (size + 7) & ~((uint64_t) 7);
+        }
+
+        /**
+         * @brief A string table in which each distinct string is stored once
+         */
+        class StringTable {
+        public:
+            /**
+             * @brief Get the index of a string, adding it to the table if needed
+             * @param string: a string
+             * @return an index
+             */
+            uint64_t intern(const std::string &string) {
+                auto it = this->indices.find(string);
+                if (it != this->indices.end()) {
+                    return it->second;
+                }
+                uint64_t index = this->offsets.size() - 1;
+                this->indices[string] = index;
+                this->data.insert(this->data.end(), string.begin(), string.end());
+                this->offsets.push_back(this->data.size());
+                return index;
+            }
+
+            std::unordered_map<std::string, uint64_t> indices;
+            std::vector<uint64_t> offsets = {0};
+            std::vector<char> data;
+        };
+
+        /**
+         * @brief Write an array to a stream
+         * @param stream: the stream
+         * @param array: the array
+         */
+        template<typename T>
+        void writeArray(std::ofstream &stream, const std::vector<T> &array) {
+            stream.write(reinterpret_cast<const char *>(array.data()), (std::streamsize) (array.size() * sizeof(T)));
+        }
+
+        /**
+         * @brief A read-only memory mapping of a whole file
+         */
+        class MappedFile {
+        public:
+            explicit MappedFile(const std::string &file_path) {
+                int fd = open(file_path.c_str(), O_RDONLY);
+                if (fd == -1) {
+                    throw std::invalid_argument("WorkflowSnapshot::load(): Cannot open file " + file_path + " (" + std::string(strerror(errno)) + ")");
+                }
+                struct stat st {};
+                if (fstat(fd, &st) == -1) {
+                    close(fd);
+                    throw std::invalid_argument("WorkflowSnapshot::load(): Cannot stat file " + file_path + " (" + std::string(strerror(errno)) + ")");
+                }
+                this->size = st.st_size;
+                if (this->size > 0) {
+                    this->data = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+                }
+                close(fd);
+                if (this->data == MAP_FAILED) {
+                    throw std::invalid_argument("WorkflowSnapshot::load(): Cannot map file " + file_path + " (" + std::string(strerror(errno)) + ")");
+                }
+            }
+
+            ~MappedFile() {
+                if ((this->data != nullptr) and (this->data != MAP_FAILED)) {
+                    munmap(this->data, this->size);
+                }
+            }
+
+            MappedFile(const MappedFile &) = delete;
+            MappedFile &operator=(const MappedFile &) = delete;
+
+            void *data = nullptr;
+            uint64_t size = 0;
+        };
+
+        /**
+         * @brief A cursor over the sections of a mapped snapshot, which checks section bounds
+         */
+        class SectionReader {
+        public:
+            SectionReader(const char *data, uint64_t size) : data(data), size(size) {}
+
+            /**
+             * @brief Get the next section
+             * @param num_elements: the number of elements in the section
+             * @return a pointer to the section's first element
+             */
+            template<typename T>
+            const T *next(uint64_t num_elements) {
+                if ((num_elements > (this->size - this->offset) / sizeof(T)) or
+                    (align8(num_elements * sizeof(T)) > this->size - this->offset)) {
+                    throw std::invalid_argument("WorkflowSnapshot::load(): Truncated or corrupted snapshot file");
+                }
+                auto section = reinterpret_cast<const T *>(this->data + this->offset);
+                this->offset += align8(num_elements * sizeof(T));
+                return section;
+            }
+
+        private:
+            const char *data;
+            uint64_t size;
+            uint64_t offset = 0;
+        };
+
+        /**
+         * @brief Check that a CSR offset array is well-formed
+         * @param offsets: the offsets
+         * @param num_rows: the number of rows
+         * @param num_values: the number of values
+         */
+        void checkOffsets(const uint64_t *offsets, uint64_t num_rows, uint64_t num_values) {
+            if ((offsets[0] != 0) or (offsets[num_rows] > num_values)) {
+                throw std::invalid_argument("WorkflowSnapshot::load(): Corrupted snapshot file (invalid offsets)");
+            }
+            for (uint64_t i = 0; i < num_rows; i++) {
+                if (offsets[i] > offsets[i + 1]) {
+                    throw std::invalid_argument("WorkflowSnapshot::load(): Corrupted snapshot file (invalid offsets)");
+                }
+            }
+        }
+
+        /**
+         * @brief Check that indices are in range
+         * @param indices: the indices
+         * @param num_indices: the number of indices
+         * @param bound: an exclusive upper bound for indices
+         */
+        void checkIndices(const uint64_t *indices, uint64_t num_indices, uint64_t bound) {
+            for (uint64_t i = 0; i < num_indices; i++) {
+                if (indices[i] >= bound) {
+                    throw std::invalid_argument("WorkflowSnapshot::load(): Corrupted snapshot file (invalid index)");
+                }
+            }
+        }
+
+    }// namespace
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+    /**
+     * @brief Save a workflow to a snapshot file. Task execution states are not saved.
+     *
+     * @param workflow: a workflow
+     * @param file_path: the path of the snapshot file
+     */
+    void WorkflowSnapshot::save(const std::shared_ptr<Workflow> &workflow, const std::string &file_path) {
+        if (workflow == nullptr) {
+            throw std::invalid_argument("WorkflowSnapshot::save(): Invalid arguments");
+        }
+
+        StringTable strings;
+        std::vector<FileRecord> files;
+        std::unordered_map<DataFile *, uint64_t> file_indices;
+        std::vector<TaskRecord> tasks;
+        std::unordered_map<WorkflowTask *, uint64_t> task_indices;
+        std::vector<uint64_t> input_offsets = {0}, input_files, output_offsets = {0}, output_files;
+        std::vector<uint64_t> child_offsets = {0}, children;
+
+        auto file_index = [&](const std::shared_ptr<DataFile> &file) {
+            auto it = file_indices.find(file.get());
+            if (it != file_indices.end()) {
+                return it->second;
+            }
+            uint64_t index = files.size();
+            files.push_back({strings.intern(file->getID()), (uint64_t) file->getSize()});
+            file_indices[file.get()] = index;
+            return index;
+        };
+
+        // Task table and task files
+        auto const &task_map = workflow->getTaskMapView();
+        tasks.reserve(task_map.size());
+        for (auto const &t: task_map) {
+            auto const &task = t.second;
+            TaskRecord record{};
+            record.id = strings.intern(task->getID());
+            record.cluster_id = strings.intern(task->getClusterID());
+            record.color = strings.intern(task->getColor());
+            record.flops = task->getFlops();
+            record.min_num_cores = task->getMinNumCores();
+            record.max_num_cores = task->getMaxNumCores();
+            record.memory_requirement = task->getMemoryRequirement();
+            record.priority = task->getPriority();
+            record.bytes_read = task->getBytesRead();
+            record.bytes_written = task->getBytesWritten();
+            auto parallel_model = task->getParallelModel();
+            if (auto amdahl = std::dynamic_pointer_cast<AmdahlParallelModel>(parallel_model)) {
+                record.parallel_model = AMDAHL;
+                record.parallel_model_parameter = amdahl->getAlpha();
+            } else if (auto constant_efficiency = std::dynamic_pointer_cast<ConstantEfficiencyParallelModel>(parallel_model)) {
+                record.parallel_model = CONSTANT_EFFICIENCY;
+                record.parallel_model_parameter = constant_efficiency->getEfficiency();
+            } else {
+                throw std::invalid_argument("WorkflowSnapshot::save(): Task " + task->getID() +
+                                            " has a custom parallel model, which cannot be saved to a snapshot");
+            }
+            task_indices[task.get()] = tasks.size();
+            tasks.push_back(record);
+
+            for (auto const &f: task->getInputFiles()) {
+                input_files.push_back(file_index(f));
+            }
+            input_offsets.push_back(input_files.size());
+            for (auto const &f: task->getOutputFiles()) {
+                output_files.push_back(file_index(f));
+            }
+            output_offsets.push_back(output_files.size());
+        }
+
+        // Task dependencies
+        for (auto const &t: task_map) {
+            for (auto const &child: workflow->getTaskChildren(t.second)) {
+                children.push_back(task_indices[child.get()]);
+            }
+            child_offsets.push_back(children.size());
+        }
+
+        Header header{};
+        memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        header.byte_order_mark = SNAPSHOT_BYTE_ORDER_MARK;
+        header.version = WorkflowSnapshot::FORMAT_VERSION;
+        header.num_strings = strings.offsets.size() - 1;
+        header.string_data_size = align8(strings.data.size());
+        header.num_files = files.size();
+        header.num_tasks = tasks.size();
+        header.num_input_files = input_files.size();
+        header.num_output_files = output_files.size();
+        header.num_edges = children.size();
+
+        std::ofstream stream;
+        stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+        try {
+            stream.open(file_path, std::ios::binary | std::ios::trunc);
+            auto write_section = [&stream](const auto &array) {
+                writeArray(stream, array);
+                auto num_bytes = array.size() * sizeof(array[0]);
+                static const char padding[8] = {};
+                stream.write(padding, (std::streamsize) (align8(num_bytes) - num_bytes));
+            };
+            stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            write_section(strings.offsets);
+            write_section(strings.data);
+            write_section(files);
+            write_section(tasks);
+            write_section(input_offsets);
+            write_section(input_files);
+            write_section(output_offsets);
+            write_section(output_files);
+            write_section(child_offsets);
+            write_section(children);
+            stream.close();
+        } catch (const std::ofstream::failure &e) {
+            throw std::invalid_argument("WorkflowSnapshot::save(): Cannot write file " + file_path + " (" + std::string(e.what()) + ")");
+        }
+
+        WRENCH_DEBUG("Saved a snapshot of %lu tasks, %lu files, and %lu dependencies to %s",
+                     (unsigned long) tasks.size(), (unsigned long) files.size(), (unsigned long) children.size(), file_path.c_str());
+    }
+
+    /**
+     * @brief Create a workflow from a snapshot file. Files that do not exist in the simulation
+     *        are created, and files that already exist are re-used.
+     *
+     * @param file_path: the path of the snapshot file
+     * @return a workflow
+     */
+    std::shared_ptr<Workflow> WorkflowSnapshot::load(const std::string &file_path) {
+        MappedFile mapped_file(file_path);
+
+        // Check the header
+        if (mapped_file.size < sizeof(Header)) {
+            throw std::invalid_argument("WorkflowSnapshot::load(): File " + file_path + " is not a workflow snapshot");
+        }
+        Header header{};
+        memcpy(&header, mapped_file.data, sizeof(Header));
+        if (memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+            throw std::invalid_argument("WorkflowSnapshot::load(): File " + file_path + " is not a workflow snapshot");
+        }
+        if (header.byte_order_mark != SNAPSHOT_BYTE_ORDER_MARK) {
+            throw std::invalid_argument("WorkflowSnapshot::load(): Snapshot file " + file_path + " was written on a machine with a different byte order");
+        }
+        if (header.version != WorkflowSnapshot::FORMAT_VERSION) {
+            throw std::invalid_argument("WorkflowSnapshot::load(): Snapshot file " + file_path + " has unsupported format version " +
+                                        std::to_string(header.version) + " (expected " + std::to_string(WorkflowSnapshot::FORMAT_VERSION) + ")");
+        }
+
+        // Locate and check all sections
+        for (auto count: {header.num_strings, header.num_files, header.num_tasks, header.num_input_files, header.num_output_files, header.num_edges}) {
+            if (count >= mapped_file.size) {
+                throw std::invalid_argument("WorkflowSnapshot::load(): Truncated or corrupted snapshot file");
+            }
+        }
+        SectionReader reader(static_cast<const char *>(mapped_file.data) + sizeof(Header), mapped_file.size - sizeof(Header));
+        auto string_offsets = reader.next<uint64_t>(header.num_strings + 1);
+        auto string_data = reader.next<char>(header.string_data_size);
+        auto files = reader.next<FileRecord>(header.num_files);
+        auto tasks = reader.next<TaskRecord>(header.num_tasks);
+        auto input_offsets = reader.next<uint64_t>(header.num_tasks + 1);
+        auto input_files = reader.next<uint64_t>(header.num_input_files);
+        auto output_offsets = reader.next<uint64_t>(header.num_tasks + 1);
+        auto output_files = reader.next<uint64_t>(header.num_output_files);
+        auto child_offsets = reader.next<uint64_t>(header.num_tasks + 1);
+        auto children = reader.next<uint64_t>(header.num_edges);
+
+        checkOffsets(string_offsets, header.num_strings, header.string_data_size);
+        checkOffsets(input_offsets, header.num_tasks, header.num_input_files);
+        checkOffsets(output_offsets, header.num_tasks, header.num_output_files);
+        checkOffsets(child_offsets, header.num_tasks, header.num_edges);
+        checkIndices(input_files, header.num_input_files, header.num_files);
+        checkIndices(output_files, header.num_output_files, header.num_files);
+        checkIndices(children, header.num_edges, header.num_tasks);
+
+        auto get_string = [&](uint64_t index) {
+            if (index >= header.num_strings) {
+                throw std::invalid_argument("WorkflowSnapshot::load(): Corrupted snapshot file (invalid string index)");
+            }
+            return std::string(string_data + string_offsets[index], string_offsets[index + 1] - string_offsets[index]);
+        };
+
+        auto workflow = Workflow::createWorkflow();
+        workflow->enableTopBottomLevelDynamicUpdates(false);
+        workflow->beginBulkDependencyInsertion();
+
+        // Files
+        std::vector<std::shared_ptr<DataFile>> data_files;
+        data_files.reserve(header.num_files);
+        for (uint64_t i = 0; i < header.num_files; i++) {
+            auto file_id = get_string(files[i].id);
+            auto file = Simulation::getFileByIDOrNull(file_id);
+            if (file == nullptr) {
+                file = Simulation::addFile(file_id, (sg_size_t) files[i].size);
+            }
+            data_files.push_back(file);
+        }
+
+        // Tasks
+        std::vector<std::shared_ptr<WorkflowTask>> workflow_tasks;
+        workflow_tasks.reserve(header.num_tasks);
+        for (uint64_t i = 0; i < header.num_tasks; i++) {
+            auto const &record = tasks[i];
+            auto task = workflow->addTask(get_string(record.id), record.flops,
+                                          record.min_num_cores, record.max_num_cores,
+                                          (sg_size_t) record.memory_requirement);
+            auto cluster_id = get_string(record.cluster_id);
+            if (not cluster_id.empty()) {
+                task->setClusterID(cluster_id);
+            }
+            auto color = get_string(record.color);
+            if (not color.empty()) {
+                task->setColor(color);
+            }
+            task->setPriority((long) record.priority);
+            task->setBytesRead(record.bytes_read);
+            task->setBytesWritten(record.bytes_written);
+            if (record.parallel_model == AMDAHL) {
+                task->setParallelModel(ParallelModel::AMDAHL(record.parallel_model_parameter));
+            } else {
+                task->setParallelModel(ParallelModel::CONSTANTEFFICIENCY(record.parallel_model_parameter));
+            }
+            workflow_tasks.push_back(task);
+        }
+
+        // Task files
+        for (uint64_t i = 0; i < header.num_tasks; i++) {
+            for (uint64_t j = input_offsets[i]; j < input_offsets[i + 1]; j++) {
+                workflow_tasks[i]->addInputFile(data_files[input_files[j]]);
+            }
+            for (uint64_t j = output_offsets[i]; j < output_offsets[i + 1]; j++) {
+                workflow_tasks[i]->addOutputFile(data_files[output_files[j]]);
+            }
+        }
+
+        // Task dependencies (all of which were in the saved workflow, and are thus kept)
+        for (uint64_t i = 0; i < header.num_tasks; i++) {
+            for (uint64_t j = child_offsets[i]; j < child_offsets[i + 1]; j++) {
+                workflow->addControlDependency(workflow_tasks[i], workflow_tasks[children[j]], true);
+            }
+        }
+        workflow->commitBulkDependencyInsertion();
+
+        workflow->enableTopBottomLevelDynamicUpdates(true);
+        workflow->updateAllTopBottomLevels();
+
+        WRENCH_DEBUG("Loaded a snapshot of %lu tasks, %lu files, and %lu dependencies from %s",
+                     (unsigned long) header.num_tasks, (unsigned long) header.num_files, (unsigned long) header.num_edges, file_path.c_str());
+
+        return workflow;
+    }
+
+}// namespace wrench
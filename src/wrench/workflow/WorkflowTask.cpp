@@ -44,6 +44,8 @@ namespace wrench {
         this->parallel_model = ParallelModel::CONSTANTEFFICIENCY(1.0);
         this->bottomlevel = 0;
         this->toplevel = 0;
+        this->flop_weighted_bottomlevel = flops;
+        this->byte_weighted_bottomlevel = 0;
     }
 
     /**
@@ -69,6 +71,11 @@ namespace wrench {
         // Add the file
         this->input_files[file->getID()] = file;
         this->workflow->task_input_files[file].insert(this->getSharedPtr());
+        this->workflow->invalidateInputOutputFiles();
+        // A task removed from the workflow is no longer in the DAG, so it has no levels to propagate
+        if (this->workflow->update_top_bottom_levels_dynamically and this->dag_index != DagOfTasks::NO_VERTEX) {
+            this->workflow->propagateBottomLevels({this});
+        }
 
         // Add control dependency
         if (this->workflow->task_output_files.find(file) != this->workflow->task_output_files.end()) {
@@ -100,6 +107,7 @@ namespace wrench {
         // Otherwise proceed
         this->output_files[file->getID()] = file;
         this->workflow->task_output_files[file] = this->getSharedPtr();
+        this->workflow->invalidateInputOutputFiles();
 
         for (auto const &x: this->workflow->getTasksThatInput(file)) {
             workflow->addControlDependency(this->getSharedPtr(), x);
@@ -133,6 +141,10 @@ namespace wrench {
      */
     void WorkflowTask::setFlops(double f) {
         this->flops = f;
+        // A task removed from the workflow is no longer in the DAG, so it has no levels to propagate
+        if (this->workflow->update_top_bottom_levels_dynamically and this->dag_index != DagOfTasks::NO_VERTEX) {
+            this->workflow->propagateBottomLevels({this});
+        }
     }
 
     /**
@@ -339,8 +351,8 @@ namespace wrench {
      * @param state: the task state
      */
     void WorkflowTask::setState(WorkflowTask::State state) {
-        if (this->visible_state == WorkflowTask::State::READY) {
-            this->workflow->ready_tasks.erase(this->getSharedPtr());
+        if (this->visible_state == WorkflowTask::State::READY and state != WorkflowTask::State::READY) {
+            this->workflow->removeReadyTask(this);
         }
         if (this->visible_state == WorkflowTask::State::READY and state == WorkflowTask::State::NOT_READY) {
             this->ready_date = -1.0;
@@ -348,7 +360,7 @@ namespace wrench {
         this->visible_state = state;
         if (state == WorkflowTask::State::READY) {
             this->ready_date = Simulation::getCurrentSimulatedDate();
-            this->workflow->ready_tasks.insert(this->getSharedPtr());
+            this->workflow->addReadyTask(this);
         }
     }
 
@@ -383,7 +395,14 @@ namespace wrench {
      * @param c_id: cluster c_id the task belongs to
      */
     void WorkflowTask::setClusterID(const std::string &c_id) {
-        this->cluster_id = c_id;
+        // Move the task to the right ready cluster, if need be
+        if (this->ready_index != ULONG_MAX) {
+            this->workflow->removeReadyTask(this);
+            this->cluster_id = c_id;
+            this->workflow->addReadyTask(this);
+        } else {
+            this->cluster_id = c_id;
+        }
     }
 
     /**
@@ -591,6 +610,15 @@ namespace wrench {
         return this->execution_history;
     }
 
+    /**
+     * @brief Get the number of attempted executions of this task (i.e., the size of its execution history)
+     *
+     * @return a number of attempted executions
+     */
+    unsigned long WorkflowTask::getNumberOfExecutionAttempts() const {
+        return this->execution_history.size();
+    }
+
     /**
      * @brief Get the number of times a task has failed
      *
@@ -725,85 +753,41 @@ namespace wrench {
     }
 
     /**
-     * @brief Update the task's top level (looking only at the parents, and updating children)
+     * @brief Update the task's top level (looking only at the parents, and updating descendants
+     *        only as far as their top levels change)
      * @return the task's updated top level
      */
     unsigned long WorkflowTask::updateTopLevel() {
-        std::vector<std::shared_ptr<WorkflowTask>> parents = this->workflow->getTaskParents(this->getSharedPtr());
-        if (parents.empty()) {
-            this->toplevel = 0;
-        } else {
-            int max_toplevel = 0;
-            for (const auto &parent: parents) {
-                max_toplevel = (max_toplevel < parent->toplevel ? parent->toplevel : max_toplevel);
-            }
-            this->toplevel = 1 + max_toplevel;
-        }
-        std::vector<std::shared_ptr<WorkflowTask>> children = this->workflow->getTaskChildren(this->getSharedPtr());
-        for (const auto &child: children) {
-            child->updateTopLevel();
+        if (this->dag_index != DagOfTasks::NO_VERTEX) {
+            this->workflow->propagateTopLevels({this});
         }
         return this->toplevel;
     }
 
     /**
-     * @brief Update the task's bottom level (looking only at the children, and updating parents)
+     * @brief Update the task's bottom level (looking only at the children, and updating ancestors
+     *        only as far as their bottom levels change)
      * @return the task's updated bottom level
      */
     unsigned long WorkflowTask::updateBottomLevel() {
-        std::vector<std::shared_ptr<WorkflowTask>> children = this->workflow->getTaskChildren(this->getSharedPtr());
-        if (children.empty()) {
-            this->bottomlevel = 0;
-        } else {
-            int max_bottomlevel = 0;
-            for (const auto &child: children) {
-                max_bottomlevel = (max_bottomlevel < child->bottomlevel ? child->bottomlevel : max_bottomlevel);
-            }
-            this->bottomlevel = 1 + max_bottomlevel;
-        }
-        std::vector<std::shared_ptr<WorkflowTask>> parents = this->workflow->getTaskParents(this->getSharedPtr());
-        for (const auto &parent: parents) {
-            parent->updateBottomLevel();
+        if (this->dag_index != DagOfTasks::NO_VERTEX) {
+            this->workflow->propagateBottomLevels({this});
         }
         return this->bottomlevel;
     }
 
-
     /**
-     * @brief Update the task's top level recursively (to be used by the updateAllTopBottomLevels method)
+     * @brief Get the total size of the task's input files
+     * @return a number of bytes
      */
-    void WorkflowTask::computeBottomLevel() {
-
-        this->bottomlevel = 0;
-        // Compute children if needed
-        int max_child_bottom_level = -1;
-        for (const auto &child: this->getChildren()) {
-            if (child->bottomlevel == -1) {
-                child->computeBottomLevel();
-            }
-            max_child_bottom_level = std::max<int>(max_child_bottom_level, child->bottomlevel);
+    double WorkflowTask::getInputBytes() const {
+        double input_bytes = 0;
+        for (auto const &f: this->input_files) {
+            input_bytes += (double) f.second->getSize();
         }
-        this->bottomlevel = 1 + max_child_bottom_level;
+        return input_bytes;
     }
 
-    /**
-     * @brief Update the task's bottom level recursively (to be used by the updateAllTopBottomLevels method)
-     */
-    void WorkflowTask::computeTopLevel() {
-
-        this->toplevel = 0;
-        // Compute parents if needed
-        int max_parent_top_level = -1;
-        for (const auto &parent: this->getParents()) {
-            if (parent->toplevel == -1) {
-                parent->computeTopLevel();
-            }
-            max_parent_top_level = std::max<int>(max_parent_top_level, parent->toplevel);
-        }
-        this->toplevel = 1 + max_parent_top_level;
-    }
-
-
     /**
  * @brief Returns the task's top level (max number of hops on a reverse path up to an entry task. Entry
  *        tasks have a top-level of 0)
@@ -822,6 +806,25 @@ namespace wrench {
         return this->bottomlevel;
     }
 
+    /**
+     * @brief Returns the task's flop-weighted bottom level, i.e., the largest total number of flops
+     *        of the tasks on a path down to an exit task (this task included). This is the length of the
+     *        critical path from the task when task execution times are proportional to flops.
+     * @return a number of flops
+     */
+    double WorkflowTask::getFlopWeightedBottomLevel() const {
+        return this->flop_weighted_bottomlevel;
+    }
+
+    /**
+     * @brief Returns the task's byte-weighted bottom level, i.e., the largest total size of the input files
+     *        of the tasks on a path down to an exit task (this task included)
+     * @return a number of bytes
+     */
+    double WorkflowTask::getByteWeightedBottomLevel() const {
+        return this->byte_weighted_bottomlevel;
+    }
+
 
     /**
  * @brief Returns the name of the host on which the task has most recently been executed, or "" if
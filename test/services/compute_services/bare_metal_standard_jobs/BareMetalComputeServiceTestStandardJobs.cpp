@@ -70,6 +70,8 @@ public:
 
     void do_ShutdownStorageServiceBeforeJobIsSubmitted_test(double buffer_size);
 
+    void do_BarrierActions_test();
+
 protected:
     ~BareMetalComputeServiceTestStandardJobs() override {
         workflow->clear();
@@ -1690,6 +1692,177 @@ void BareMetalComputeServiceTestStandardJobs::do_ShutdownStorageServiceBeforeJob
     ASSERT_EQ(this->task2->getFailureCount(), 1);
 
 
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+/**********************************************************************/
+/**  BARRIER ACTIONS TEST                                            **/
+/**********************************************************************/
+
+class BareMetalComputeServiceBarrierActionsTestWMS : public wrench::ExecutionController {
+
+public:
+    BareMetalComputeServiceBarrierActionsTestWMS(BareMetalComputeServiceTestStandardJobs *test,
+                                                 const std::string &hostname) : wrench::ExecutionController(hostname, "test"), test(test) {
+    }
+
+private:
+    BareMetalComputeServiceTestStandardJobs *test;
+
+    int main() override {
+
+        // Create a job  manager
+        auto job_manager = this->createJobManager();
+
+        // Create a 4-task job whose task output files are all copied to scratch after the tasks
+        // have completed (so that there are 4x4 write-to-copy dependencies, or a barrier)
+        std::vector<std::shared_ptr<wrench::WorkflowTask>> tasks = {this->test->task1, this->test->task2, this->test->task3, this->test->task4};
+        std::vector<std::shared_ptr<wrench::DataFile>> output_files = {this->test->output_file1, this->test->output_file2, this->test->output_file3, this->test->output_file4};
+        auto file_locations = wrench::FileLocation::LOCATIONS(this->test->storage_service, output_files);
+        file_locations[this->test->input_file] = wrench::FileLocation::SCRATCH(this->test->input_file);
+        std::vector<std::tuple<std::shared_ptr<wrench::FileLocation>, std::shared_ptr<wrench::FileLocation>>> post_file_copies;
+        for (auto const &f: output_files) {
+            post_file_copies.emplace_back(wrench::FileLocation::LOCATION(this->test->storage_service, f), wrench::FileLocation::SCRATCH(f));
+        }
+
+        auto job = job_manager->createStandardJob(
+                tasks,
+                file_locations,
+                {std::make_tuple(
+                        wrench::FileLocation::LOCATION(this->test->storage_service, this->test->input_file),
+                        wrench::FileLocation::SCRATCH(this->test->input_file))},
+                post_file_copies, {});
+
+        if (job->getUseBarrierActions()) {
+            throw std::runtime_error("A job should not use barrier actions by default");
+        }
+        job->setUseBarrierActions(true);
+        if (not job->getUseBarrierActions()) {
+            throw std::runtime_error("The job should use barrier actions");
+        }
+
+        // Submit the job for execution
+        job_manager->submitJob(job, this->test->compute_service);
+
+        // Wait for a workflow execution event
+        std::shared_ptr<wrench::ExecutionEvent> event;
+        try {
+            event = this->waitForNextEvent();
+        } catch (wrench::ExecutionException &e) {
+            throw std::runtime_error("Error while getting and execution event: " + e.getCause()->toString());
+        }
+
+        if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+            throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+        }
+
+        // Check completion states and output files
+        for (auto const &task: tasks) {
+            if (task->getState() != wrench::WorkflowTask::COMPLETED) {
+                throw std::runtime_error("Unexpected task state for task " + task->getID());
+            }
+        }
+        for (auto const &f: output_files) {
+            if (not this->test->storage_service->lookupFile(f)) {
+                throw std::runtime_error("Output file " + f->getID() + " should be on the storage service");
+            }
+        }
+
+        // Check the shape of the action graph: 1 pre file copy, 4 x (file read, compute, file write),
+        // 4 post file copies, 1 scratch cleanup, and a single barrier between the 4 file writes and the
+        // 4 post file copies (i.e., 4 + 4 dependencies instead of 4 x 4)
+        auto actions = job->getCompoundJob()->getActions();
+        if (actions.size() != 1 + 4 * 3 + 4 + 1 + 1) {
+            throw std::runtime_error("Unexpected number of actions " + std::to_string(actions.size()));
+        }
+        unsigned long num_dependencies = 0;
+        std::vector<std::shared_ptr<wrench::Action>> barriers;
+        for (auto const &action: actions) {
+            num_dependencies += action->getChildren().size();
+            if (std::dynamic_pointer_cast<wrench::SleepAction>(action)) {
+                barriers.push_back(action);
+            }
+        }
+        if (barriers.size() != 1) {
+            throw std::runtime_error("Unexpected number of barrier actions " + std::to_string(barriers.size()));
+        }
+        auto barrier = barriers.at(0);
+        if ((barrier->getParents().size() != 4) or (barrier->getChildren().size() != 4)) {
+            throw std::runtime_error("The barrier action should have 4 parents and 4 children");
+        }
+        for (auto const &parent: barrier->getParents()) {
+            if (not std::dynamic_pointer_cast<wrench::FileWriteAction>(parent)) {
+                throw std::runtime_error("The barrier action's parents should be file write actions");
+            }
+        }
+        for (auto const &child: barrier->getChildren()) {
+            if (not std::dynamic_pointer_cast<wrench::FileCopyAction>(child)) {
+                throw std::runtime_error("The barrier action's children should be file copy actions");
+            }
+        }
+        // pre copy -> reads: 4, read -> compute: 4, compute -> write: 4, writes -> barrier -> copies: 4 + 4,
+        // copies -> scratch cleanup: 4
+        if (num_dependencies != 4 + 4 + 4 + 4 + 4 + 4) {
+            throw std::runtime_error("Unexpected number of action dependencies " + std::to_string(num_dependencies));
+        }
+
+        // The two 2-core tasks cannot run in parallel with any other task, so the job should
+        // take at least 10 + 10 + 10 seconds
+        if (wrench::Simulation::getCurrentSimulatedDate() < 30.0) {
+            throw std::runtime_error("Unexpected job completion date " + std::to_string(wrench::Simulation::getCurrentSimulatedDate()));
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BareMetalComputeServiceTestStandardJobs, BarrierActions) {
+    DO_TEST_WITH_FORK(do_BarrierActions_test);
+}
+
+void BareMetalComputeServiceTestStandardJobs::do_BarrierActions_test() {
+
+    // Create and initialize a simulation
+    auto simulation = wrench::Simulation::createSimulation();
+    int argc = 1;
+    char **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+    //    argv[1] = strdup("--wrench-full-log");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "DualCoreHost";
+
+    // Create A Storage Services
+    ASSERT_NO_THROW(storage_service = simulation->add(
+                            wrench::SimpleStorageService::createSimpleStorageService(hostname, {"/"})));
+
+    // Create a Compute Service
+    ASSERT_NO_THROW(compute_service = simulation->add(
+                            new wrench::BareMetalComputeService(
+                                    hostname,
+                                    {std::make_pair(hostname, std::make_tuple(wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM))},
+                                    {"/scratch"},
+                                    {})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::ExecutionController> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+                            new BareMetalComputeServiceBarrierActionsTestWMS(
+                                    this, hostname)));
+
+    // Staging the input file on the storage service
+    ASSERT_NO_THROW(storage_service->createFile(input_file));
+
+    // Running the simulation
+    ASSERT_NO_THROW(simulation->launch());
+
     for (int i = 0; i < argc; i++)
         free(argv[i]);
     free(argv);
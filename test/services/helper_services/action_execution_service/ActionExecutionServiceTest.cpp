@@ -46,6 +46,8 @@ public:
     void do_ActionExecutionServiceOneActionFailureTest_test();
     void do_ActionExecutionServiceOneActionNotEnoughResourcesTest_test();
     void do_ActionExecutionServiceThreeActionsInSequenceTest_test();
+    void do_ActionExecutionServiceManyActionsWithThreadCreationOverheadTest_test();
+    void do_ActionExecutionServiceReusedActionExecutorTest_test();
 
 protected:
     ActionExecutionServiceTest() {
@@ -1268,4 +1270,299 @@ void ActionExecutionServiceTest::do_ActionExecutionServiceThreeActionsInSequence
     for (int i = 0; i < argc; i++)
         free(argv[i]);
     free(argv);
-}
\ No newline at end of file
+}
+
+
+/**********************************************************************/
+/**  ACTION SCHEDULER MANY ACTIONS WITH THREAD CREATION OVERHEAD TEST **/
+/**********************************************************************/
+
+
+class ActionExecutionServiceManyActionsWithThreadCreationOverheadTestWMS : public wrench::ExecutionController {
+
+public:
+    ActionExecutionServiceManyActionsWithThreadCreationOverheadTestWMS(ActionExecutionServiceTest *test,
+                                                                       std::string hostname) : wrench::ExecutionController(hostname, "test"), test(test) {
+    }
+
+private:
+    ActionExecutionServiceTest *test;
+
+    int main() override {
+
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // Create an ActionExecutionService with a thread creation overhead
+        std::map<simgrid::s4u::Host *, std::tuple<unsigned long, sg_size_t>> compute_resources;
+        compute_resources[wrench::S4U_Simulation::get_host_or_vm_by_name("Host3")] = std::make_tuple(3, 100.0);
+        auto action_execution_service = std::shared_ptr<wrench::ActionExecutionService>(
+                new wrench::ActionExecutionService("Host2", compute_resources,
+                                                   {},
+                                                   {{wrench::ActionExecutionServiceProperty::THREAD_CREATION_OVERHEAD, "1.0"}}));
+        action_execution_service->setParentService(this->getSharedPtr<wrench::Service>());
+
+        // Start it
+        action_execution_service->setSimulation(this->getSimulation());
+        action_execution_service->start(action_execution_service, true, false);
+
+        // Create a Compound Job
+        auto job = job_manager->createCompoundJob("my_job");
+
+        // Add 1-core compute actions, which will run 3 at a time (so that action executors are reused)
+        std::vector<std::shared_ptr<wrench::ComputeAction>> actions;
+        for (int i = 0; i < 9; i++) {
+            actions.push_back(job->addComputeAction("compute_action_" + std::to_string(i), 10.0, 0.0, 1, 1, wrench::ParallelModel::AMDAHL(1.0)));
+        }
+
+        // Submit the actions to the action executor
+        for (auto const &action: actions) {
+            action_execution_service->submitAction(action);
+        }
+
+        // Wait for all action completions
+        for (int i = 0; i < 9; i++) {
+            std::shared_ptr<wrench::SimulationMessage> message;
+            try {
+                message = this->_commport->getMessage();
+            } catch (wrench::ExecutionException &e) {
+                auto cause = std::dynamic_pointer_cast<wrench::NetworkError>(e.getCause());
+                throw std::runtime_error("Network error while getting reply from Executor!" + cause->toString());
+            }
+
+            // Did we get the expected message?
+            auto msg = std::dynamic_pointer_cast<wrench::ActionExecutionServiceActionDoneMessage>(message);
+            if (!msg) {
+                throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+            }
+            if (msg->action->getState() != wrench::Action::State::COMPLETED) {
+                throw std::runtime_error("Unexpected " + msg->action->getName() + " action state: " + msg->action->getStateAsString());
+            }
+        }
+
+        // Is the thread creation overhead incurred by each action?
+        double duration = actions.at(0)->getEndDate() - actions.at(0)->getStartDate();
+        if (duration < 11.0 - EPSILON) {
+            throw std::runtime_error("Unexpected action duration " + std::to_string(duration) + " (thread creation overhead not incurred?)");
+        }
+
+        // Are the dates sensible?
+        for (unsigned long i = 0; i < actions.size(); i++) {
+            double expected_start_date = static_cast<double>(i / 3) * duration;
+            if (std::abs(actions.at(i)->getStartDate() - expected_start_date) > EPSILON)
+                throw std::runtime_error("Unexpected " + actions.at(i)->getName() + " start date " + std::to_string(actions.at(i)->getStartDate()));
+            if (std::abs(actions.at(i)->getEndDate() - (expected_start_date + duration)) > EPSILON)
+                throw std::runtime_error("Unexpected " + actions.at(i)->getName() + " end date " + std::to_string(actions.at(i)->getEndDate()));
+        }
+
+        // Are the dispatch counters sensible? (actions that could not run while all cores were busy should
+        // have been skipped without computing an allocation for each of them)
+        if (action_execution_service->getNumActionsDispatched() != 9)
+            throw std::runtime_error("Unexpected number of dispatched actions " + std::to_string(action_execution_service->getNumActionsDispatched()));
+        if (action_execution_service->getNumActionsSkippedForDispatch() == 0)
+            throw std::runtime_error("Some actions should have been skipped for dispatch");
+        if (action_execution_service->getNumActionsConsideredForDispatch() < 9)
+            throw std::runtime_error("Unexpected number of actions considered for dispatch " + std::to_string(action_execution_service->getNumActionsConsideredForDispatch()));
+
+        return 0;
+    }
+};
+
+TEST_F(ActionExecutionServiceTest, ManyActionsWithThreadCreationOverhead) {
+    DO_TEST_WITH_FORK(do_ActionExecutionServiceManyActionsWithThreadCreationOverheadTest_test);
+}
+
+void ActionExecutionServiceTest::do_ActionExecutionServiceManyActionsWithThreadCreationOverheadTest_test() {
+
+    // Create and initialize a simulation
+    simulation = wrench::Simulation::createSimulation();
+    int argc = 1;
+    char **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+    //    argv[1] = strdup("--wrench-full-log");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    this->workflow = wrench::Workflow::createWorkflow();
+
+    // Create a WMS
+    std::shared_ptr<wrench::ExecutionController> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+                            new ActionExecutionServiceManyActionsWithThreadCreationOverheadTestWMS(this, "Host1")));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    this->workflow->clear();
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  ACTION SCHEDULER REUSED ACTION EXECUTOR TEST                    **/
+/**********************************************************************/
+
+
+class ActionExecutionServiceReusedActionExecutorTestWMS : public wrench::ExecutionController {
+
+public:
+    ActionExecutionServiceReusedActionExecutorTestWMS(ActionExecutionServiceTest *test,
+                                                      std::string hostname) : wrench::ExecutionController(hostname, "test"), test(test) {
+    }
+
+private:
+    ActionExecutionServiceTest *test;
+
+    std::shared_ptr<wrench::ActionExecutor> first_executor;
+    wrench::S4U_CommPort *stale_commport = nullptr;
+    wrench::S4U_CommPort *stale_recv_commport = nullptr;
+    bool executor_reused = false;
+    bool commports_renewed = false;
+    bool stale_message_delivered = false;
+
+    int main() override {
+
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // Create an ActionExecutionService with a single core, so that actions run one after the other
+        std::map<simgrid::s4u::Host *, std::tuple<unsigned long, sg_size_t>> compute_resources;
+        compute_resources[wrench::S4U_Simulation::get_host_or_vm_by_name("Host3")] = std::make_tuple(1, 100.0);
+        auto action_execution_service = std::shared_ptr<wrench::ActionExecutionService>(
+                new wrench::ActionExecutionService("Host2", compute_resources, {}, {}));
+        action_execution_service->setParentService(this->getSharedPtr<wrench::Service>());
+
+        // Start it
+        action_execution_service->setSimulation(this->getSimulation());
+        action_execution_service->start(action_execution_service, true, false);
+
+        // Create a Compound Job
+        auto job = job_manager->createCompoundJob("my_job");
+
+        // The first action leaves "late replies" in its action executor's commports
+        auto action1 = job->addCustomAction(
+                "custom_action_1", 0, 1,
+                [this](const std::shared_ptr<wrench::ActionExecutor> &action_executor) {
+                    this->first_executor = action_executor;
+                    this->stale_commport = action_executor->_commport;
+                    this->stale_recv_commport = action_executor->recv_commport;
+                    this->stale_commport->dputMessage(new wrench::SimulationMessage(0));
+                    this->stale_recv_commport->dputMessage(new wrench::SimulationMessage(0));
+                    wrench::Simulation::sleep(1.0);
+                },
+                [](const std::shared_ptr<wrench::ActionExecutor> &action_executor) {});
+
+        // The second action should run on the same action executor, but not see these replies
+        auto action2 = job->addCustomAction(
+                "custom_action_2", 0, 1,
+                [this](const std::shared_ptr<wrench::ActionExecutor> &action_executor) {
+                    this->executor_reused = (action_executor == this->first_executor);
+                    this->commports_renewed = (action_executor->_commport != this->stale_commport) and
+                                              (action_executor->recv_commport != this->stale_recv_commport);
+                    try {
+                        wrench::S4U_Daemon::getRunningActorRecvCommPort()->getMessage(1.0);
+                        this->stale_message_delivered = true;
+                    } catch (wrench::ExecutionException &ignore) {
+                        // Expected timeout
+                    }
+                },
+                [](const std::shared_ptr<wrench::ActionExecutor> &action_executor) {});
+
+        // Submit the actions to the action executor
+        action_execution_service->submitAction(action1);
+        action_execution_service->submitAction(action2);
+
+        // Wait for all action completions
+        for (int i = 0; i < 2; i++) {
+            std::shared_ptr<wrench::SimulationMessage> message;
+            try {
+                message = this->_commport->getMessage();
+            } catch (wrench::ExecutionException &e) {
+                auto cause = std::dynamic_pointer_cast<wrench::NetworkError>(e.getCause());
+                throw std::runtime_error("Network error while getting reply from Executor!" + cause->toString());
+            }
+
+            // Did we get the expected message?
+            auto msg = std::dynamic_pointer_cast<wrench::ActionExecutionServiceActionDoneMessage>(message);
+            if (!msg) {
+                throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+            }
+            if (msg->action->getState() != wrench::Action::State::COMPLETED) {
+                throw std::runtime_error("Unexpected " + msg->action->getName() + " action state: " + msg->action->getStateAsString());
+            }
+        }
+
+        if (not this->executor_reused) {
+            throw std::runtime_error("The action executor should have been reused");
+        }
+        if (not this->commports_renewed) {
+            throw std::runtime_error("The reused action executor should have fresh commports");
+        }
+        if (this->stale_message_delivered) {
+            throw std::runtime_error("A message meant for the first action was delivered to the second action");
+        }
+        // An idle action executor should not hold on to its last action
+        if (this->first_executor->getAction() != nullptr) {
+            throw std::runtime_error("An idle action executor should not hold on to an action");
+        }
+
+        // A stray message sent to the idle action executor should not prevent it from running another action
+        this->first_executor->_commport->dputMessage(new wrench::SimulationMessage(0));
+        auto action3 = job->addSleepAction("sleep_action_3", 1.0);
+        action_execution_service->submitAction(action3);
+        std::shared_ptr<wrench::SimulationMessage> message;
+        try {
+            message = this->_commport->getMessage();
+        } catch (wrench::ExecutionException &e) {
+            throw std::runtime_error("Network error while getting reply from Executor!" + e.getCause()->toString());
+        }
+        auto msg = std::dynamic_pointer_cast<wrench::ActionExecutionServiceActionDoneMessage>(message);
+        if (!msg) {
+            throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+        }
+        if ((msg->action != action3) or (action3->getState() != wrench::Action::State::COMPLETED)) {
+            throw std::runtime_error("The third action should have completed");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(ActionExecutionServiceTest, ReusedActionExecutor) {
+    DO_TEST_WITH_FORK(do_ActionExecutionServiceReusedActionExecutorTest_test);
+}
+
+void ActionExecutionServiceTest::do_ActionExecutionServiceReusedActionExecutorTest_test() {
+
+    // Create and initialize a simulation
+    simulation = wrench::Simulation::createSimulation();
+    int argc = 1;
+    char **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+    //    argv[1] = strdup("--wrench-full-log");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    this->workflow = wrench::Workflow::createWorkflow();
+
+    // Create a WMS
+    std::shared_ptr<wrench::ExecutionController> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+                            new ActionExecutionServiceReusedActionExecutorTestWMS(this, "Host1")));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    this->workflow->clear();
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
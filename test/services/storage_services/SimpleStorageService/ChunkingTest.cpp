@@ -10,11 +10,18 @@ class SimpleStorageServiceChunkingTest : public ::testing::Test {
 public:
     std::shared_ptr<wrench::DataFile> file_size_0;
     std::shared_ptr<wrench::DataFile> file_size_100;
+    std::shared_ptr<wrench::DataFile> file_size_100000;
 
     std::shared_ptr<wrench::StorageService> storage_service_1 = nullptr;
     std::shared_ptr<wrench::StorageService> storage_service_2 = nullptr;
+    std::shared_ptr<wrench::StorageService> storage_service_chunked = nullptr;
+    std::shared_ptr<wrench::StorageService> storage_service_coalesced = nullptr;
+
+    double chunked_read_duration = 0.0;
+    double coalesced_read_duration = 0.0;
 
     void do_ChunkingTest(std::string mode);
+    void do_CoalescedChunkingTest();
 
 protected:
     ~SimpleStorageServiceChunkingTest() {
@@ -29,6 +36,7 @@ protected:
         // create the files
         file_size_0 = wrench::Simulation::addFile("file_size_0", 0);
         file_size_100 = wrench::Simulation::addFile("file_size_100", 100);
+        file_size_100000 = wrench::Simulation::addFile("file_size_100000", 100000);
 
 
         // Create a 2-host platform file
@@ -46,6 +54,14 @@ protected:
                           "             <prop id=\"size\" value=\"1000B\"/>"
                           "             <prop id=\"mount\" value=\"/disk2\"/>"
                           "          </disk>"
+                          "          <disk id=\"disk3\" read_bw=\"100Bps\" write_bw=\"100Bps\">"
+                          "             <prop id=\"size\" value=\"1MB\"/>"
+                          "             <prop id=\"mount\" value=\"/disk3\"/>"
+                          "          </disk>"
+                          "          <disk id=\"disk4\" read_bw=\"100Bps\" write_bw=\"100Bps\">"
+                          "             <prop id=\"size\" value=\"1MB\"/>"
+                          "             <prop id=\"mount\" value=\"/disk4\"/>"
+                          "          </disk>"
                           "       </host>"
                           "       <host id=\"WMSHost\" speed=\"1f\"/> "
                           "       <link id=\"link\" bandwidth=\"100Bps\" latency=\"100us\"/>"
@@ -98,6 +114,17 @@ private:
             data_movement_manager->doSynchronousFileCopy(
                     wrench::FileLocation::LOCATION(this->test->storage_service_1, this->test->file_size_100),
                     wrench::FileLocation::LOCATION(this->test->storage_service_2, this->test->file_size_100));
+
+        } else if (mode == "coalescing") {
+            double start_date = wrench::Simulation::getCurrentSimulatedDate();
+            wrench::StorageService::readFileAtLocation(
+                    wrench::FileLocation::LOCATION(this->test->storage_service_chunked, this->test->file_size_100000));
+            this->test->chunked_read_duration = wrench::Simulation::getCurrentSimulatedDate() - start_date;
+
+            start_date = wrench::Simulation::getCurrentSimulatedDate();
+            wrench::StorageService::readFileAtLocation(
+                    wrench::FileLocation::LOCATION(this->test->storage_service_coalesced, this->test->file_size_100000));
+            this->test->coalesced_read_duration = wrench::Simulation::getCurrentSimulatedDate() - start_date;
         }
 
         return 0;
@@ -116,6 +143,10 @@ TEST_F(SimpleStorageServiceChunkingTest, CopyingFile) {
     DO_TEST_WITH_FORK_ONE_ARG(do_ChunkingTest, "copying");
 }
 
+TEST_F(SimpleStorageServiceChunkingTest, CoalescedChunks) {
+    DO_TEST_WITH_FORK(do_CoalescedChunkingTest);
+}
+
 void SimpleStorageServiceChunkingTest::do_ChunkingTest(std::string mode) {
 
     // Create and initialize the simulation
@@ -157,6 +188,70 @@ void SimpleStorageServiceChunkingTest::do_ChunkingTest(std::string mode) {
     ASSERT_NO_THROW(simulation->launch());
 
 
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+void SimpleStorageServiceChunkingTest::do_CoalescedChunkingTest() {
+
+    // Create and initialize the simulation
+    auto simulation = wrench::Simulation::createSimulation();
+
+    int argc = 1;
+    char **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // set up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create a storage service that transfers data in buffer-size chunks
+    ASSERT_NO_THROW(storage_service_chunked = simulation->add(
+                            wrench::SimpleStorageService::createSimpleStorageService("StorageHost", {"/disk3"},
+                                                                                     {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "100"}})));
+
+    // Create a storage service that coalesces chunks
+    ASSERT_THROW(simulation->add(
+                         wrench::SimpleStorageService::createSimpleStorageService("StorageHost", {"/disk4"},
+                                                                                  {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "100"},
+                                                                                   {wrench::SimpleStorageServiceProperty::COALESCE_DATA_CHUNKS, "bogus"}})),
+                 std::invalid_argument);
+    ASSERT_NO_THROW(storage_service_coalesced = simulation->add(
+                            wrench::SimpleStorageService::createSimpleStorageService("StorageHost", {"/disk4"},
+                                                                                     {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "100"},
+                                                                                      {wrench::SimpleStorageServiceProperty::COALESCE_DATA_CHUNKS, "true"}})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::ExecutionController> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(new SimpleStorageServiceChunkingTestWMS(this, "coalescing", "WMSHost")));
+
+    // Stage the file on both storage services
+    ASSERT_NO_THROW(storage_service_chunked->createFile(file_size_100000));
+    ASSERT_NO_THROW(storage_service_coalesced->createFile(file_size_100000));
+
+    simulation->getOutput().enableDiskTimestamps(true);
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    // Both reads should take (about) the same time, with far fewer chunks when coalescing
+    ASSERT_GT(chunked_read_duration, 1000.0);
+    ASSERT_NEAR(coalesced_read_duration, chunked_read_duration, 0.01 * chunked_read_duration);
+
+    unsigned long num_chunked_reads = 0;
+    unsigned long num_coalesced_reads = 0;
+    for (auto const &timestamp: simulation->getOutput().getTrace<wrench::SimulationTimestampDiskReadStart>()) {
+        if (timestamp->getContent()->getMount().find("/disk3") == 0) {
+            num_chunked_reads++;
+        } else if (timestamp->getContent()->getMount().find("/disk4") == 0) {
+            num_coalesced_reads++;
+        }
+    }
+    ASSERT_EQ(num_chunked_reads, 1000);
+    ASSERT_GE(num_coalesced_reads, 128);
+    ASSERT_LT(num_coalesced_reads, 300);
+
     for (int i = 0; i < argc; i++)
         free(argv[i]);
     free(argv);
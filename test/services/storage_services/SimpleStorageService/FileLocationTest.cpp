@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../../../include/TestWithFork.h"
+#include "../../../include/UniqueTmpPathPrefix.h"
+
+
+class FileLocationTest : public ::testing::Test {
+
+public:
+    std::vector<std::shared_ptr<wrench::DataFile>> files;
+
+    std::shared_ptr<wrench::StorageService> storage_service_1 = nullptr;
+    std::shared_ptr<wrench::StorageService> storage_service_2 = nullptr;
+
+    std::shared_ptr<wrench::Workflow> workflow;
+
+    void do_InterningTest();
+
+protected:
+    ~FileLocationTest() override {
+        workflow->clear();
+        wrench::Simulation::removeAllFiles();
+    }
+
+    FileLocationTest() {
+        // simple workflow
+        workflow = wrench::Workflow::createWorkflow();
+
+        // create the files
+        for (int i = 0; i < 100; i++) {
+            files.push_back(wrench::Simulation::addFile("file_" + std::to_string(i), 10));
+        }
+
+        // Create a 1-host platform file
+        std::string xml = "<?xml version='1.0'?>"
+                          "<!DOCTYPE platform SYSTEM \"https://simgrid.org/simgrid.dtd\">"
+                          "<platform version=\"4.1\"> "
+                          "   <zone id=\"AS0\" routing=\"Full\"> "
+                          "       <host id=\"StorageHost\" speed=\"1f\"> "
+                          "          <disk id=\"disk1\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "             <prop id=\"size\" value=\"10000B\"/>"
+                          "             <prop id=\"mount\" value=\"/disk1\"/>"
+                          "          </disk>"
+                          "          <disk id=\"disk2\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "             <prop id=\"size\" value=\"10000B\"/>"
+                          "             <prop id=\"mount\" value=\"/disk2\"/>"
+                          "          </disk>"
+                          "       </host>"
+                          "   </zone> "
+                          "</platform>";
+        FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+        fprintf(platform_file, "%s", xml.c_str());
+        fclose(platform_file);
+    }
+
+    std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+};
+
+class FileLocationInterningTestWMS : public wrench::ExecutionController {
+public:
+    FileLocationInterningTestWMS(FileLocationTest *test,
+                                 std::string hostname) : wrench::ExecutionController(hostname, "test"), test(test) {
+    }
+
+private:
+    FileLocationTest *test;
+
+    int main() override {
+        auto file = this->test->files.at(0);
+
+        // Equivalent locations are the same object
+        auto location = wrench::FileLocation::LOCATION(this->test->storage_service_1, file);
+        if (wrench::FileLocation::LOCATION(this->test->storage_service_1, "/disk1/", file) != location) {
+            throw std::runtime_error("Equivalent locations should be interned as the same object");
+        }
+        if ((wrench::FileLocation::LOCATION(this->test->storage_service_2, file) == location) or
+            (wrench::FileLocation::LOCATION(this->test->storage_service_1, "/disk1/dir", file) == location) or
+            (wrench::FileLocation::LOCATION(this->test->storage_service_1, this->test->files.at(1)) == location) or
+            (wrench::FileLocation::SCRATCH(file) == location)) {
+            throw std::runtime_error("Different locations should be different objects");
+        }
+        if (wrench::FileLocation::SCRATCH(file) != wrench::FileLocation::SCRATCH(file)) {
+            throw std::runtime_error("Equivalent SCRATCH locations should be interned as the same object");
+        }
+
+        // Bulk creation
+        auto locations = wrench::FileLocation::LOCATIONS(this->test->storage_service_1, this->test->files);
+        if (locations.size() != this->test->files.size()) {
+            throw std::runtime_error("Unexpected number of locations");
+        }
+        for (auto const &f: this->test->files) {
+            if (locations.at(f) != wrench::FileLocation::LOCATION(this->test->storage_service_1, f)) {
+                throw std::runtime_error("Bulk-created locations should be interned");
+            }
+        }
+        auto dir_locations = wrench::FileLocation::LOCATIONS(this->test->storage_service_2, "/disk2/dir", this->test->files);
+        if (dir_locations.at(file)->getDirectoryPath() != "/disk2/dir/") {
+            throw std::runtime_error("Unexpected directory path " + dir_locations.at(file)->getDirectoryPath());
+        }
+        try {
+            wrench::FileLocation::LOCATIONS(nullptr, this->test->files);
+            throw std::runtime_error("Should not be able to create locations with a nullptr storage service");
+        } catch (std::invalid_argument &ignore) {
+        }
+        try {
+            wrench::FileLocation::LOCATIONS(this->test->storage_service_1, {file, nullptr});
+            throw std::runtime_error("Should not be able to create locations with a nullptr file");
+        } catch (std::invalid_argument &ignore) {
+        }
+
+        // Interned paths
+        auto path = wrench::FileLocation::internPath("/disk1//dir/");
+        if ((path != wrench::FileLocation::internPath("disk1/dir")) or
+            (path == wrench::FileLocation::internPath("/disk1"))) {
+            throw std::runtime_error("Equivalent paths should have the same handle, and different ones different handles");
+        }
+        if (path.getPath() != "/disk1/dir/") {
+            throw std::runtime_error("Unexpected interned path " + path.getPath());
+        }
+        if ((wrench::FileLocation::LOCATION(this->test->storage_service_1, path, file) !=
+             wrench::FileLocation::LOCATION(this->test->storage_service_1, "/disk1/dir", file)) or
+            (wrench::FileLocation::LOCATION(this->test->storage_service_1, path, file)->getDirectoryPathHandle() != path)) {
+            throw std::runtime_error("Locations created with a path handle should be interned");
+        }
+        if (wrench::FileLocation::LOCATIONS(this->test->storage_service_2, wrench::FileLocation::internPath("/disk2/dir"), this->test->files) != dir_locations) {
+            throw std::runtime_error("Locations bulk-created with a path handle should be interned");
+        }
+        try {
+            wrench::FileLocation::internPath("/disk1/d*r");
+            throw std::runtime_error("Should not be able to intern a path with a disallowed character");
+        } catch (std::invalid_argument &ignore) {
+        }
+        try {
+            wrench::FileLocation::LOCATION(this->test->storage_service_1, wrench::PathHandle(), file);
+            throw std::runtime_error("Should not be able to create a location with an empty path handle");
+        } catch (std::invalid_argument &ignore) {
+        }
+
+        // Opening a file via a path handle
+        auto sss = std::dynamic_pointer_cast<wrench::SimpleStorageService>(this->test->storage_service_1);
+        wrench::StorageService::createFileAtLocation(location);
+        auto opened_file = sss->openFile(wrench::FileLocation::internPath("/disk1"), file);
+        opened_file->close();
+
+        // Bulk-created locations can be used to create a job
+        auto task = this->test->workflow->addTask("task", 10.0, 1, 1, 0);
+        task->addInputFile(this->test->files.at(0));
+        task->addOutputFile(this->test->files.at(1));
+        auto job_manager = this->createJobManager();
+        auto job = job_manager->createStandardJob(
+                task, wrench::FileLocation::LOCATIONS(this->test->storage_service_1, {this->test->files.at(0), this->test->files.at(1)}));
+        for (auto const &f: {this->test->files.at(0), this->test->files.at(1)}) {
+            if (job->getFileLocations().at(f) != std::vector<std::shared_ptr<wrench::FileLocation>>{locations.at(f)}) {
+                throw std::runtime_error("The job should use the bulk-created locations");
+            }
+        }
+
+        // A location that is no longer used
+        std::weak_ptr<wrench::FileLocation> unused_location =
+                wrench::FileLocation::LOCATION(this->test->storage_service_1, "/disk1/unused", file);
+
+        // Create (and drop) many locations, so that unused locations are reclaimed, while used ones are not
+        for (int i = 0; i < 50; i++) {
+            for (auto const &f: this->test->files) {
+                wrench::FileLocation::LOCATION(this->test->storage_service_1, "/disk1/dir_" + std::to_string(i), f);
+                wrench::FileLocation::LOCATIONS(this->test->storage_service_2, "/disk2/dir_" + std::to_string(i), {f});
+            }
+        }
+        if (wrench::FileLocation::LOCATION(this->test->storage_service_1, file) != location) {
+            throw std::runtime_error("A used location should not have been reclaimed");
+        }
+        if (wrench::FileLocation::LOCATION(this->test->storage_service_2, "/disk2/dir", file) != dir_locations.at(file)) {
+            throw std::runtime_error("A used location should not have been reclaimed");
+        }
+        if (not unused_location.expired()) {
+            throw std::runtime_error("An unused location should have been reclaimed");
+        }
+
+        // A location that survived reclaims, and then is no longer used, is eventually reclaimed
+        // once enough other locations have survived reclaims
+        std::vector<std::shared_ptr<wrench::FileLocation>> held_locations;
+        for (int i = 0; i < 300; i++) {
+            for (auto const &l: wrench::FileLocation::LOCATIONS(this->test->storage_service_1, "/disk1/held_" + std::to_string(i), this->test->files)) {
+                held_locations.push_back(l.second);
+            }
+        }
+        std::weak_ptr<wrench::FileLocation> formerly_used_location = held_locations.at(0);
+        held_locations.clear();
+        for (int i = 0; (i < 1000) and (not formerly_used_location.expired()); i++) {
+            for (auto const &l: wrench::FileLocation::LOCATIONS(this->test->storage_service_2, "/disk2/held_" + std::to_string(i), this->test->files)) {
+                held_locations.push_back(l.second);
+            }
+        }
+        if (not formerly_used_location.expired()) {
+            throw std::runtime_error("A formerly used location should have been reclaimed");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(FileLocationTest, Interning) {
+    DO_TEST_WITH_FORK(do_InterningTest);
+}
+
+void FileLocationTest::do_InterningTest() {
+
+    // Create and initialize the simulation
+    auto simulation = wrench::Simulation::createSimulation();
+
+    int argc = 1;
+    char **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // set up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create two storage services
+    ASSERT_NO_THROW(storage_service_1 = simulation->add(
+                            wrench::SimpleStorageService::createSimpleStorageService("StorageHost", {"/disk1"}, {}, {})));
+    ASSERT_NO_THROW(storage_service_2 = simulation->add(
+                            wrench::SimpleStorageService::createSimpleStorageService("StorageHost", {"/disk2"}, {}, {})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::ExecutionController> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(new FileLocationInterningTestWMS(this, "StorageHost")));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
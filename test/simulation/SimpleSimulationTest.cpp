@@ -421,6 +421,10 @@ void SimpleSimulationTest::do_getReadyTasksTest_test(double buffer_size) {
     ASSERT_EQ(storage_service->getPropertyValueAsUnsignedLong(wrench::ServiceProperty::translateString("SimpleStorageServiceProperty::MAX_NUM_CONCURRENT_DATA_CONNECTIONS")), 567);
     ASSERT_EQ(storage_service->getPropertyValueAsUnsignedLong(wrench::SimpleStorageServiceProperty::BUFFER_SIZE), 678);
     ASSERT_EQ(storage_service->getPropertyValueAsUnsignedLong(wrench::ServiceProperty::translateString("StorageServiceProperty::BUFFER_SIZE")), 678);
+    // Converted values are cached per type
+    ASSERT_EQ(storage_service->getPropertyValueAsUnsignedLong(wrench::SimpleStorageServiceProperty::BUFFER_SIZE), 678);
+    ASSERT_DOUBLE_EQ(678 * 1024 * 1024,
+                     storage_service->getPropertyValueAsSizeInByte(wrench::SimpleStorageServiceProperty::BUFFER_SIZE));
 
     ASSERT_THROW(storage_service->getMessagePayloadValue(-1), std::invalid_argument);
     ASSERT_EQ(123, storage_service->getMessagePayloadValue(
@@ -452,6 +456,8 @@ void SimpleSimulationTest::do_getReadyTasksTest_test(double buffer_size) {
     ASSERT_THROW(compute_service->getPropertyValueAsDouble(wrench::CloudComputeServiceProperty::VM_RESOURCE_ALLOCATION_ALGORITHM), std::invalid_argument);
     ASSERT_THROW(compute_service->getPropertyValueAsUnsignedLong(wrench::CloudComputeServiceProperty::VM_RESOURCE_ALLOCATION_ALGORITHM), std::invalid_argument);
     ASSERT_THROW(compute_service->getPropertyValueAsBoolean(wrench::CloudComputeServiceProperty::VM_RESOURCE_ALLOCATION_ALGORITHM), std::invalid_argument);
+    ASSERT_THROW(compute_service->getPropertyValueAsDouble(wrench::CloudComputeServiceProperty::VM_RESOURCE_ALLOCATION_ALGORITHM), std::invalid_argument);
+    ASSERT_DOUBLE_EQ(compute_service->getPropertyValueAsTimeInSecond(wrench::CloudComputeServiceProperty::VM_BOOT_OVERHEAD), 0.1);
     ASSERT_EQ(compute_service->getMessagePayloadValue(wrench::CloudComputeServiceMessagePayload::DESTROY_VM_ANSWER_MESSAGE_PAYLOAD), 2);
     ASSERT_EQ(compute_service->getMessagePayloadValue(wrench::CloudComputeServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD), 3);
 
@@ -41,6 +41,7 @@ public:
     std::shared_ptr<wrench::WorkflowTask> t4 = nullptr;
 
     void do_SimulationDumpWorkflowExecutionJSON_test();
+    void do_SimulationDumpWorkflowExecutionJSONWithIO_test();
     void do_SimulationDumpWorkflowGraphJSON_test();
     void do_SimulationSearchForHostUtilizationGraphLayout_test();
     void do_SimulationDumpHostEnergyConsumptionJSON_test();
@@ -48,6 +49,7 @@ public:
     void do_SimulationDumpPlatformGraphJSONBrokenRouting_test();
     void do_SimulationDumpLinkUsageJSON_test();
     void do_SimulationDumpDiskOperationsJSON_test();
+    void do_SimulationStreamDiskOperations_test();
     void do_SimulationDumpUnifiedJSON_test();
 
 protected:
@@ -258,6 +260,7 @@ protected:
     std::string platform_graph_json_file_path = UNIQUE_TMP_PATH_PREFIX + "platform_graph.json";
     std::string link_usage_json_file_path = UNIQUE_TMP_PATH_PREFIX + "link_usage.json";
     std::string disk_operations_json_file_path = UNIQUE_TMP_PATH_PREFIX + "disk_operations.json";
+    std::string trace_file_path = UNIQUE_TMP_PATH_PREFIX + "trace.ndjson";
     std::string unified_json_file_path = UNIQUE_TMP_PATH_PREFIX + "unified_output.json";
 };
 
@@ -447,6 +450,106 @@ TEST_F(SimulationDumpJSONTest, SimulationDumpWorkflowExecutionJSONTest) {
     DO_TEST_WITH_FORK(do_SimulationDumpWorkflowExecutionJSON_test);
 }
 
+/**********************************************************************/
+/**          SimulationDumpWorkflowExecutionJSONWithIOTest           **/
+/**********************************************************************/
+
+void SimulationDumpJSONTest::do_SimulationDumpWorkflowExecutionJSONWithIO_test() {
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    auto simulation = wrench::Simulation::createSimulation();
+
+    simulation->init(&argc, argv);
+
+    simulation->instantiatePlatform(platform_file_path5);
+
+    std::shared_ptr<wrench::StorageService> storage_service;
+    ASSERT_NO_THROW(storage_service = simulation->add(wrench::SimpleStorageService::createSimpleStorageService("host1", {"/"}, {})));
+
+    simulation->getOutput().enableFileReadWriteCopyTimestamps(true);
+    auto &output = simulation->getOutput();
+
+    workflow = wrench::Workflow::createWorkflow();
+    t1 = workflow->addTask("task1", 1, 1, 1, 0);
+    auto file = wrench::Simulation::addFile("io_file", 1);
+    auto location = wrench::FileLocation::LOCATION(storage_service, file);
+
+    /*
+     * task1 is executed twice: it reads the file during its first attempt, and reads and
+     * writes it during its second attempt. Each attempt should only list its own I/O.
+     */
+    t1->setStartDate(1.0);
+    t1->setExecutionHost("host1");
+    t1->setNumCoresAllocated(1);
+    auto read1 = output.addTimestampFileReadStart(1.0, file, location, storage_service, t1);
+    output.addTimestampFileReadCompletion(1.5, file, location, storage_service, t1, read1);
+    t1->setEndDate(2.0);
+
+    t1->setStartDate(3.0);
+    t1->setExecutionHost("host2");
+    t1->setNumCoresAllocated(2);
+    auto read2 = output.addTimestampFileReadStart(3.0, file, location, storage_service, t1);
+    output.addTimestampFileReadCompletion(3.5, file, location, storage_service, t1, read2);
+    auto write2 = output.addTimestampFileWriteStart(3.5, file, location, storage_service, t1);
+    output.addTimestampFileWriteCompletion(4.0, file, location, storage_service, t1, write2);
+    t1->setEndDate(4.0);
+
+    // I/O that isn't done for a task isn't listed
+    auto read3 = output.addTimestampFileReadStart(5.0, file, location, storage_service, nullptr);
+    output.addTimestampFileReadCompletion(6.0, file, location, storage_service, nullptr, read3);
+
+    EXPECT_NO_THROW(output.dumpWorkflowExecutionJSON(workflow, execution_data_json_file_path));
+
+    std::ifstream json_file(execution_data_json_file_path);
+    std::string result_string((std::istreambuf_iterator<char>(json_file)), std::istreambuf_iterator<char>());
+    nlohmann::json result_json = nlohmann::json::parse(result_string);
+
+    // The streamed output should be exactly what pretty-printing the whole document produces
+    EXPECT_EQ(result_string, result_json.dump(4) + "\n");
+
+    auto task_executions = result_json["workflow_execution"]["tasks"];
+    ASSERT_EQ(task_executions.size(), 2);
+    std::sort(task_executions.begin(), task_executions.end(), compareStartTimes);
+
+    auto const &first_attempt = task_executions[0];
+    EXPECT_EQ(first_attempt["whole_task"]["start"], 1.0);
+    ASSERT_EQ(first_attempt["read"].size(), 1);
+    EXPECT_EQ(first_attempt["read"][0]["id"], "io_file");
+    EXPECT_EQ(first_attempt["read"][0]["start"], 1.0);
+    EXPECT_EQ(first_attempt["read"][0]["end"], 1.5);
+    EXPECT_TRUE(first_attempt["write"].is_null());
+
+    auto const &second_attempt = task_executions[1];
+    EXPECT_EQ(second_attempt["whole_task"]["start"], 3.0);
+    ASSERT_EQ(second_attempt["read"].size(), 1);
+    EXPECT_EQ(second_attempt["read"][0]["start"], 3.0);
+    EXPECT_EQ(second_attempt["read"][0]["end"], 3.5);
+    ASSERT_EQ(second_attempt["write"].size(), 1);
+    EXPECT_EQ(second_attempt["write"][0]["start"], 3.5);
+    EXPECT_EQ(second_attempt["write"][0]["end"], 4.0);
+
+    // The streamed output should have the same content as the in-memory one used for the unified JSON
+    std::string unified_json_file_path = UNIQUE_TMP_PATH_PREFIX + "unified_with_io.json";
+    EXPECT_NO_THROW(output.dumpUnifiedJSON(workflow, unified_json_file_path));
+    std::ifstream unified_json_file(unified_json_file_path);
+    nlohmann::json unified_json;
+    unified_json_file >> unified_json;
+    EXPECT_EQ(unified_json["workflow_execution"], result_json["workflow_execution"]);
+
+    workflow->clear();
+    wrench::Simulation::removeAllFiles();
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+TEST_F(SimulationDumpJSONTest, SimulationDumpWorkflowExecutionJSONWithIOTest) {
+    DO_TEST_WITH_FORK(do_SimulationDumpWorkflowExecutionJSONWithIO_test);
+}
+
 /**********************************************************************/
 /**         SimulationSearchForHostUtilizationGraphLayout            **/
 /**********************************************************************/
@@ -603,6 +706,61 @@ void SimulationDumpJSONTest::do_SimulationSearchForHostUtilizationGraphLayout_te
 
     workflow = wrench::Workflow::createWorkflow();
 
+    t1 = workflow->addTask("task1", 1, 1, 1, 0);
+    t2 = workflow->addTask("task2", 1, 1, 1, 0);
+    t3 = workflow->addTask("task3", 1, 1, 1, 0);
+    t4 = workflow->addTask("task4", 1, 1, 1, 0);
+
+    /*
+     * Three 3-core tasks start at the same time on host1 (10 cores), and the second one
+     * ends early. A 4-core task then starts: placing the first three tasks at positions
+     * 0, 3 and 6 would leave no 4 contiguous free cores, but a valid layout exists (e.g.,
+     * with the long-running tasks at positions 0 and 3).
+     */
+    t1->setStartDate(1.0);
+    t1->setEndDate(10.0);
+    t1->setExecutionHost("host1");
+    t1->setNumCoresAllocated(3);
+
+    t2->setStartDate(1.0);
+    t2->setEndDate(2.0);
+    t2->setExecutionHost("host1");
+    t2->setNumCoresAllocated(3);
+
+    t3->setStartDate(1.0);
+    t3->setEndDate(10.0);
+    t3->setExecutionHost("host1");
+    t3->setNumCoresAllocated(3);
+
+    t4->setStartDate(3.0);
+    t4->setEndDate(5.0);
+    t4->setExecutionHost("host1");
+    t4->setNumCoresAllocated(4);
+
+    EXPECT_NO_THROW(simulation->getOutput().dumpWorkflowExecutionJSON(workflow, execution_data_json_file_path, true));
+
+    json_file = std::ifstream("host_utilization_layout.json");
+    nlohmann::json result_json4;
+    json_file >> result_json4;
+
+    // Tasks that run at the same time should not overlap
+    auto overlap = [&result_json4](const std::string &task1, unsigned long num_cores1, const std::string &task2, unsigned long num_cores2) {
+        unsigned long position1 = result_json4[task1];
+        unsigned long position2 = result_json4[task2];
+        return (position1 < position2 + num_cores2) and (position2 < position1 + num_cores1);
+    };
+    EXPECT_FALSE(overlap("task1", 3, "task2", 3));
+    EXPECT_FALSE(overlap("task1", 3, "task3", 3));
+    EXPECT_FALSE(overlap("task2", 3, "task3", 3));
+    EXPECT_FALSE(overlap("task1", 3, "task4", 4));
+    EXPECT_FALSE(overlap("task3", 3, "task4", 4));
+    EXPECT_LE((unsigned long) result_json4["task4"] + 4, 10);
+
+    workflow->clear();
+    wrench::Simulation::removeAllFiles();
+
+    workflow = wrench::Workflow::createWorkflow();
+
     t1 = workflow->addTask("task1", 1, 1, 1, 0);
     t2 = workflow->addTask("task2", 1, 1, 1, 0);
 
@@ -1316,6 +1474,71 @@ void SimulationDumpJSONTest::do_SimulationDumpDiskOperationsJSON_test() {
 }
 
 
+TEST_F(SimulationDumpJSONTest, SimulationStreamDiskOperationsTest) {
+    DO_TEST_WITH_FORK(do_SimulationStreamDiskOperations_test);
+}
+
+void SimulationDumpJSONTest::do_SimulationStreamDiskOperations_test() {
+    auto simulation = wrench::Simulation::createSimulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path6));
+
+    std::string host1 = "host1";
+    std::string host2 = "host2";
+
+    ASSERT_NO_THROW(ss1 = simulation->add(wrench::SimpleStorageService::createSimpleStorageService(host1, {"/"},
+                                                                                                   {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "400000"}})));
+
+    ASSERT_NO_THROW(ss2 = simulation->add(wrench::SimpleStorageService::createSimpleStorageService(host2, {"/"},
+                                                                                                   {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "infinity"}})));
+
+    std::shared_ptr<wrench::ExecutionController> wms = nullptr;
+
+    ASSERT_NO_THROW(wms = simulation->add(new SimulationDumpDiskOperationsTestWMS(
+                            this, host1)));
+
+    // Stream disk timestamps to a file, with a tiny buffer so that it is flushed during the simulation
+    ASSERT_THROW(std::make_shared<wrench::SimulationTraceFileSink>("/bogus/trace.ndjson"), std::invalid_argument);
+    simulation->getOutput().setTraceSink(std::make_shared<wrench::SimulationTraceFileSink>(
+            this->trace_file_path, wrench::SimulationTraceFileSink::NDJSON, 128));
+    simulation->getOutput().enableDiskTimestamps(true);
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    // Streamed timestamps are not kept in memory
+    ASSERT_TRUE(simulation->getOutput().getTrace<wrench::SimulationTimestampDiskReadStart>().empty());
+    ASSERT_TRUE(simulation->getOutput().getTrace<wrench::SimulationTimestampDiskWriteCompletion>().empty());
+
+    nlohmann::json result_json;
+    ASSERT_NO_THROW(result_json = wrench::SimulationTraceFileSink::reconstructJSON(this->trace_file_path)["disk_operations"]);
+
+    ASSERT_EQ(result_json["host1"]["/file_1"]["reads"].size(), 3);
+    for (int i = 0; i < 3; i++) {
+        int num_bytes = (int) result_json["host1"]["/file_1"]["reads"][i]["bytes"];
+        double duration = (double) result_json["host1"]["/file_1"]["reads"][i]["end"] -
+                          (double) result_json["host1"]["/file_1"]["reads"][i]["start"];
+        ASSERT_EQ(num_bytes, i < 2 ? 400000 : 200000);
+        ASSERT_TRUE(std::abs(duration - (i < 2 ? 0.4 : 0.2)) < 0.0001);
+        ASSERT_EQ(result_json["host1"]["/file_1"]["reads"][i]["failed"], "-1");
+    }
+
+    ASSERT_EQ(result_json["host2"]["/file_1.wrench_tmp.1"]["writes"].size(), 1);
+    ASSERT_EQ((int) result_json["host2"]["/file_1.wrench_tmp.1"]["writes"][0]["bytes"], 1000000);
+
+    remove(this->trace_file_path.c_str());
+    wrench::Simulation::removeAllFiles();
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+
 /**********************************************************************/
 /**         SimulationDumpPlatformGraphJSONTest                      **/
 /**********************************************************************/
@@ -118,9 +118,9 @@ private:
 #ifdef WRENCH_INTERNAL_EXCEPTIONS
         try {
             this->getSimulation()->getOutput().addTimestampTaskStart(0.0, nullptr);
-            this->getSimulation()->getOutput().addTimestampTaskCompletion(0.0, nullptr);
-            this->getSimulation()->getOutput().addTimestampTaskTermination(0.0, nullptr);
-            this->getSimulation()->getOutput().addTimestampTaskFailure(0.0, nullptr);
+            this->getSimulation()->getOutput().addTimestampTaskCompletion(0.0, nullptr, nullptr);
+            this->getSimulation()->getOutput().addTimestampTaskTermination(0.0, nullptr, nullptr);
+            this->getSimulation()->getOutput().addTimestampTaskFailure(0.0, nullptr, nullptr);
             throw std::runtime_error("Should have caught exception!");
         } catch (std::exception &ignore) {
         }
@@ -288,18 +288,21 @@ void SimulationTimestampFileCopyTest::do_SimulationTimestampFileCopyBasic_test()
     ASSERT_THROW(simulation->getOutput().addTimestampFileCopyFailure(0.0,
                                                                      nullptr,
                                                                      wrench::FileLocation::LOCATION(this->source_storage_service, nullptr),
-                                                                     wrench::FileLocation::LOCATION(this->destination_storage_service, nullptr)),
+                                                                     wrench::FileLocation::LOCATION(this->destination_storage_service, nullptr),
+                                                                     nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileCopyFailure(0.0,
                                                                      this->file_1,
                                                                      nullptr,
-                                                                     wrench::FileLocation::LOCATION(this->destination_storage_service, "/", this->file_1)),
+                                                                     wrench::FileLocation::LOCATION(this->destination_storage_service, "/", this->file_1),
+                                                                     nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileCopyFailure(0.0,
                                                                      this->file_1,
                                                                      wrench::FileLocation::LOCATION(this->source_storage_service, this->file_1),
+                                                                     nullptr,
                                                                      nullptr),
                  std::invalid_argument);
 
@@ -307,18 +310,21 @@ void SimulationTimestampFileCopyTest::do_SimulationTimestampFileCopyBasic_test()
     ASSERT_THROW(simulation->getOutput().addTimestampFileCopyCompletion(0.0,
                                                                         nullptr,
                                                                         wrench::FileLocation::LOCATION(this->source_storage_service, nullptr),
-                                                                        wrench::FileLocation::LOCATION(this->destination_storage_service, nullptr)),
+                                                                        wrench::FileLocation::LOCATION(this->destination_storage_service, nullptr),
+                                                                        nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileCopyCompletion(0.0,
                                                                         this->file_1,
                                                                         nullptr,
-                                                                        wrench::FileLocation::LOCATION(this->destination_storage_service, "/", this->file_1)),
+                                                                        wrench::FileLocation::LOCATION(this->destination_storage_service, "/", this->file_1),
+                                                                        nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileCopyCompletion(0.0,
                                                                         this->file_1,
                                                                         wrench::FileLocation::LOCATION(this->source_storage_service, this->file_1),
+                                                                        nullptr,
                                                                         nullptr),
                  std::invalid_argument);
 #endif
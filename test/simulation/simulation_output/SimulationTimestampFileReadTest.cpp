@@ -275,35 +275,40 @@ void SimulationTimestampFileReadTest::do_SimulationTimestampFileReadBasic_test()
                                                                      nullptr,
                                                                      wrench::FileLocation::LOCATION(this->storage_service, file_1),
                                                                      service,
-                                                                     task1),
+                                                                     task1,
+                                                                     nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileReadFailure(0.0,
                                                                      file_1,
                                                                      wrench::FileLocation::LOCATION(this->storage_service, file_1),
                                                                      nullptr,
-                                                                     task1),
+                                                                     task1,
+                                                                     nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileReadCompletion(0.0,
                                                                         nullptr,
                                                                         nullptr,
                                                                         service,
-                                                                        task1),
+                                                                        task1,
+                                                                        nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileReadCompletion(0.0,
                                                                         file_1,
                                                                         nullptr,
                                                                         service,
-                                                                        task1),
+                                                                        task1,
+                                                                        nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileReadCompletion(0.0,
                                                                         file_1,
                                                                         wrench::FileLocation::LOCATION(this->storage_service, file_1),
                                                                         nullptr,
-                                                                        task1),
+                                                                        task1,
+                                                                        nullptr),
                  std::invalid_argument);
 #endif
 
@@ -279,21 +279,24 @@ void SimulationTimestampFileWriteTest::do_SimulationTimestampFileWriteBasic_test
                                                                       nullptr,
                                                                       wrench::FileLocation::LOCATION(this->storage_service, file_1),
                                                                       service,
-                                                                      task),
+                                                                      task,
+                                                                      nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileWriteFailure(0.0,
                                                                       file_1,
                                                                       nullptr,
                                                                       service,
-                                                                      task),
+                                                                      task,
+                                                                      nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileWriteFailure(0.0,
                                                                       file_1,
                                                                       wrench::FileLocation::LOCATION(this->storage_service, file_1),
                                                                       nullptr,
-                                                                      task),
+                                                                      task,
+                                                                      nullptr),
                  std::invalid_argument);
 
 
@@ -301,21 +304,24 @@ void SimulationTimestampFileWriteTest::do_SimulationTimestampFileWriteBasic_test
                                                                          nullptr,
                                                                          wrench::FileLocation::LOCATION(this->storage_service, file_1),
                                                                          service,
-                                                                         task),
+                                                                         task,
+                                                                         nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileWriteCompletion(0.0,
                                                                          file_1,
                                                                          nullptr,
                                                                          service,
-                                                                         task),
+                                                                         task,
+                                                                         nullptr),
                  std::invalid_argument);
 
     ASSERT_THROW(simulation->getOutput().addTimestampFileWriteCompletion(0.0,
                                                                          file_1,
                                                                          wrench::FileLocation::LOCATION(this->storage_service, file_1),
                                                                          nullptr,
-                                                                         task),
+                                                                         task,
+                                                                         nullptr),
                  std::invalid_argument);
 #endif
 
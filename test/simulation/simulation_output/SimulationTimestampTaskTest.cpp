@@ -235,6 +235,9 @@ void SimulationTimestampTaskTest::do_SimulationTimestampTaskBasic_test() {
     ASSERT_GT(task2_start_timestamp, task1_start_timestamp);
     ASSERT_GT(task2_completion_timestamp, task1_completion_timestamp);
 
+    // Retrieving a trace again returns the same timestamps
+    ASSERT_EQ(timestamp_start_trace, simulation->getOutput().getTrace<wrench::SimulationTimestampTaskStart>());
+
     // expected timeline: task2_end...failed_task_start...failed_task_failed
     auto timestamp_failure_trace = simulation->getOutput().getTrace<wrench::SimulationTimestampTaskFailure>();
     //    for (auto const &ts : timestamp_start_trace) {
@@ -284,9 +287,9 @@ void SimulationTimestampTaskTest::do_SimulationTimestampTaskBasic_test() {
 
 #ifdef WRENCH_INTERNAL_EXCEPIONS
     ASSERT_THROW(simulation->getOutput().addTimestampTaskStart(0.0, nullptr), std::invalid_argument);
-    ASSERT_THROW(simulation->getOutput().addTimestampTaskFailure(0.0, nullptr), std::invalid_argument);
-    ASSERT_THROW(simulation->getOutput().addTimestampTaskCompletion(0.0, nullptr), std::invalid_argument);
-    ASSERT_THROW(simulation->getOutput().addTimestampTaskTermination(0.0, nullptr), std::invalid_argument);
+    ASSERT_THROW(simulation->getOutput().addTimestampTaskFailure(0.0, nullptr, nullptr), std::invalid_argument);
+    ASSERT_THROW(simulation->getOutput().addTimestampTaskCompletion(0.0, nullptr, nullptr), std::invalid_argument);
+    ASSERT_THROW(simulation->getOutput().addTimestampTaskTermination(0.0, nullptr, nullptr), std::invalid_argument);
 #endif
 
     for (int i = 0; i < argc; i++)
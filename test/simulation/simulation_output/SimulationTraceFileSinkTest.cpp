@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+
+#include <wrench/simulation/SimulationTraceFileSink.h>
+#include "../../include/UniqueTmpPathPrefix.h"
+
+class SimulationTraceFileSinkTest : public ::testing::Test {
+protected:
+    SimulationTraceFileSinkTest() {
+    }
+
+    static void recordTrace(wrench::SimulationTraceSink &sink) {
+        // Disk operations are recorded in completion order
+        sink.recordDiskRead(2, "host1", "/disk/file_1", 1.0, 2.0, 100, false);
+        sink.recordDiskRead(1, "host1", "/disk/file_1", 0.5, 3.0, 50, true);
+        sink.recordDiskWrite(3, "host2", "/disk/file,\"2\"", 0.1, 0.3, 7, false);
+        // Same-date pstate sets replace each other
+        sink.recordPstateSet(0.0, "host1", 1);
+        sink.recordPstateSet(0.0, "host1", 2);
+        sink.recordPstateSet(1.0 / 3.0, "host1", 0);
+        sink.recordEnergyConsumption(0.0, "host1", 0.0);
+        sink.recordEnergyConsumption(1.0, "host1", 12.5);
+        // Runs of identical link usage measurements are merged
+        for (int i = 0; i < 5; i++) {
+            sink.recordLinkUsage(i, "link1", 10.0);
+        }
+        sink.recordLinkUsage(5.0, "link1", 20.0);
+        sink.recordLinkUsage(5.0, "link2", 0.0);
+    }
+};
+
+TEST_F(SimulationTraceFileSinkTest, AllFormats) {
+
+    std::string trace_path = UNIQUE_TMP_PATH_PREFIX + "trace";
+
+    nlohmann::json expected_json;
+    for (auto format: {wrench::SimulationTraceFileSink::BINARY,
+                       wrench::SimulationTraceFileSink::NDJSON,
+                       wrench::SimulationTraceFileSink::CSV}) {
+        {
+            wrench::SimulationTraceFileSink sink(trace_path, format, 64);
+            recordTrace(sink);
+        }
+
+        nlohmann::json json;
+        ASSERT_NO_THROW(json = wrench::SimulationTraceFileSink::reconstructJSON(trace_path));
+
+        if (format != wrench::SimulationTraceFileSink::BINARY) {
+            ASSERT_EQ(json, expected_json);
+            continue;
+        }
+        expected_json = json;
+
+        auto reads = json["disk_operations"]["host1"]["/disk/file_1"]["reads"];
+        ASSERT_EQ(reads.size(), 2);
+        ASSERT_DOUBLE_EQ(reads[0]["start"], 0.5);
+        ASSERT_EQ(reads[0]["failed"], "1");
+        ASSERT_DOUBLE_EQ(reads[1]["start"], 1.0);
+        ASSERT_EQ(reads[1]["failed"], "-1");
+        ASSERT_EQ(json["disk_operations"]["host2"]["/disk/file,\"2\""]["writes"].size(), 1);
+
+        auto host = json["energy_consumption"][0];
+        ASSERT_EQ(host["hostname"], "host1");
+        ASSERT_EQ(host["pstate_trace"].size(), 2);
+        ASSERT_EQ(host["pstate_trace"][0]["pstate"], 2);
+        ASSERT_DOUBLE_EQ(host["pstate_trace"][1]["time"], 1.0 / 3.0);
+        ASSERT_EQ(host["consumed_energy_trace"].size(), 2);
+
+        auto links = json["link_usage"]["links"];
+        ASSERT_EQ(links.size(), 2);
+        ASSERT_EQ(links[0]["linkname"], "link1");
+        ASSERT_EQ(links[0]["link_usage_trace"].size(), 3);
+        ASSERT_DOUBLE_EQ(links[0]["link_usage_trace"][1]["time"], 4.0);
+    }
+
+    remove(trace_path.c_str());
+}
+
+TEST_F(SimulationTraceFileSinkTest, CSVFieldsWithNewlines) {
+
+    std::string trace_path = UNIQUE_TMP_PATH_PREFIX + "trace";
+    std::vector<std::string> mounts = {"/disk/file\n1", "/disk/\"file\"\n\n2\n", "\n"};
+
+    nlohmann::json expected_json;
+    for (auto format: {wrench::SimulationTraceFileSink::BINARY,
+                       wrench::SimulationTraceFileSink::CSV}) {
+        {
+            wrench::SimulationTraceFileSink sink(trace_path, format, 64);
+            for (size_t i = 0; i < mounts.size(); i++) {
+                sink.recordDiskWrite((int) i, "host\n1", mounts[i], 0.0, 1.0, 10, false);
+            }
+            sink.recordLinkUsage(1.0, "link\n1", 10.0);
+        }
+
+        nlohmann::json json;
+        ASSERT_NO_THROW(json = wrench::SimulationTraceFileSink::reconstructJSON(trace_path));
+
+        if (format == wrench::SimulationTraceFileSink::BINARY) {
+            expected_json = json;
+            ASSERT_EQ(json["disk_operations"]["host\n1"].size(), mounts.size());
+            for (auto const &mount: mounts) {
+                ASSERT_EQ(json["disk_operations"]["host\n1"][mount]["writes"].size(), 1);
+            }
+            ASSERT_EQ(json["link_usage"]["links"][0]["linkname"], "link\n1");
+        } else {
+            ASSERT_EQ(json, expected_json);
+        }
+    }
+
+    remove(trace_path.c_str());
+}
+
+TEST_F(SimulationTraceFileSinkTest, InvalidTraceFiles) {
+
+    ASSERT_THROW(wrench::SimulationTraceFileSink("/bogus/trace"), std::invalid_argument);
+    ASSERT_THROW(wrench::SimulationTraceFileSink::reconstructJSON("/bogus/trace"), std::invalid_argument);
+
+    std::string trace_path = UNIQUE_TMP_PATH_PREFIX + "trace";
+    {
+        wrench::SimulationTraceFileSink sink(trace_path);
+        recordTrace(sink);
+    }
+    std::ifstream trace_file(trace_path, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(trace_file)), std::istreambuf_iterator<char>());
+    trace_file.close();
+
+    // A truncated trace file
+    std::ofstream truncated_file(trace_path, std::ios::binary);
+    truncated_file << content.substr(0, content.size() - 3);
+    truncated_file.close();
+    ASSERT_THROW(wrench::SimulationTraceFileSink::reconstructJSON(trace_path), std::invalid_argument);
+
+    // Not a trace file
+    std::ofstream bogus_file(trace_path);
+    bogus_file << "bogus\n";
+    bogus_file.close();
+    ASSERT_THROW(wrench::SimulationTraceFileSink::reconstructJSON(trace_path), std::invalid_argument);
+
+    remove(trace_path.c_str());
+}
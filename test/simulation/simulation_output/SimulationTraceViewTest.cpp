@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include <wrench/simulation/SimulationTrace.h>
+
+class SimulationTraceViewTest : public ::testing::Test {
+protected:
+    SimulationTraceViewTest() {
+    }
+
+    static void addTimestamp(wrench::SimulationTrace<wrench::SimulationTimestampDiskReadStart> &trace,
+                             double date, const std::string &hostname) {
+        auto content = new (trace.getContentStorage()) wrench::SimulationTimestampDiskReadStart(date, hostname, "/disk", 100, 0);
+        trace.addTimestamp(content);
+    }
+
+    template<class T>
+    static std::vector<double> getDates(const wrench::SimulationTraceView<T> &view) {
+        std::vector<double> dates;
+        for (auto const &timestamp: view) {
+            dates.push_back(timestamp->getDate());
+        }
+        return dates;
+    }
+};
+
+TEST_F(SimulationTraceViewTest, Views) {
+
+    wrench::SimulationTrace<wrench::SimulationTimestampDiskReadStart> trace;
+    ASSERT_TRUE(trace.getTraceView().empty());
+    ASSERT_TRUE(trace.getTraceView(0.0, 10.0).empty());
+
+    for (int i = 0; i < 10; i++) {
+        addTimestamp(trace, i, (i % 2) ? "host1" : "host2");
+    }
+
+    auto view = trace.getTraceView();
+    ASSERT_EQ(view.size(), 10);
+    ASSERT_EQ(view.toVector(), trace.getTrace());
+    ASSERT_DOUBLE_EQ(view[3]->getDate(), 3.0);
+
+    // Time windows (inclusive)
+    ASSERT_EQ(getDates(trace.getTraceView(2.5, 6.0)), std::vector<double>({3.0, 4.0, 5.0, 6.0}));
+    ASSERT_TRUE(trace.getTraceView(10.5, 20.0).empty());
+    ASSERT_THROW(trace.getTraceView(2.0, 1.0), std::invalid_argument);
+
+    // Filtered views
+    auto host1_view = view.filter([](wrench::SimulationTimestamp<wrench::SimulationTimestampDiskReadStart> *timestamp) {
+        return timestamp->getContent()->getHostname() == "host1";
+    });
+    auto host1_timestamps = host1_view.toVector();
+    ASSERT_EQ(host1_timestamps.size(), 5);
+    for (auto const &timestamp: host1_view) {
+        ASSERT_EQ(timestamp->getContent()->getHostname(), "host1");
+    }
+
+    // Timestamps added out of date order
+    addTimestamp(trace, 4.5, "host3");
+    addTimestamp(trace, 0.5, "host3");
+    ASSERT_EQ(getDates(trace.getTraceView(0.0, 2.0)), std::vector<double>({0.0, 0.5, 1.0, 2.0}));
+    addTimestamp(trace, 4.7, "host3");
+    ASSERT_EQ(getDates(trace.getTraceView(4.5, 5.0)), std::vector<double>({4.5, 4.7, 5.0}));
+    ASSERT_EQ(trace.getTraceView().size(), 13);
+}
+
+TEST_F(SimulationTraceViewTest, HostViews) {
+
+    wrench::SimulationTrace<wrench::SimulationTimestampDiskReadStart> trace;
+    ASSERT_TRUE(trace.getTraceViewForHost("host1").empty());
+
+    for (int i = 0; i < 10; i++) {
+        addTimestamp(trace, i, (i % 2) ? "host1" : "host2");
+    }
+    ASSERT_EQ(getDates(trace.getTraceViewForHost("host1")), std::vector<double>({1.0, 3.0, 5.0, 7.0, 9.0}));
+    ASSERT_EQ(getDates(trace.getTraceViewForHost("host2")), std::vector<double>({0.0, 2.0, 4.0, 6.0, 8.0}));
+    ASSERT_TRUE(trace.getTraceViewForHost("host3").empty());
+
+    // The index is extended with the timestamps added since the previous query
+    addTimestamp(trace, 10.0, "host1");
+    addTimestamp(trace, 0.5, "host3");
+    ASSERT_EQ(getDates(trace.getTraceViewForHost("host1")), std::vector<double>({1.0, 3.0, 5.0, 7.0, 9.0, 10.0}));
+    ASSERT_EQ(getDates(trace.getTraceViewForHost("host3")), std::vector<double>({0.5}));
+}
+
+TEST_F(SimulationTraceViewTest, WindowAfterMerge) {
+
+    wrench::SimulationOutput output;
+    output.enableEnergyTimestamps(true);
+    output.enableBandwidthTimestamps(true);
+
+    // Energy consumption timestamps, in date order
+    output.addTimestampEnergyConsumption(0.0, "merge_test_host_a", 10.0);
+    output.addTimestampEnergyConsumption(1.0, "merge_test_host_a", 10.0);
+    output.addTimestampEnergyConsumption(2.0, "merge_test_host_b", 5.0);
+    ASSERT_EQ(getDates(output.getTraceView<wrench::SimulationTimestampEnergyConsumption>(0.0, 10.0)), std::vector<double>({0.0, 1.0, 2.0}));
+
+    // This one is merged into the second timestamp, whose date changes (so that the trace is no longer in date order)
+    output.addTimestampEnergyConsumption(4.0, "merge_test_host_a", 10.0);
+    ASSERT_EQ(output.getTraceView<wrench::SimulationTimestampEnergyConsumption>().size(), 3);
+    ASSERT_EQ(getDates(output.getTraceView<wrench::SimulationTimestampEnergyConsumption>(3.0, 10.0)), std::vector<double>({4.0}));
+    ASSERT_EQ(getDates(output.getTraceView<wrench::SimulationTimestampEnergyConsumption>(0.0, 10.0)), std::vector<double>({0.0, 2.0, 4.0}));
+    ASSERT_EQ(getDates(output.getTraceForHost<wrench::SimulationTimestampEnergyConsumption>("merge_test_host_a")), std::vector<double>({0.0, 4.0}));
+
+    // Same thing for link usage timestamps
+    output.addTimestampLinkUsage(0.0, "merge_test_link_a", 100.0);
+    output.addTimestampLinkUsage(1.0, "merge_test_link_a", 100.0);
+    output.addTimestampLinkUsage(2.0, "merge_test_link_b", 50.0);
+    ASSERT_EQ(getDates(output.getTraceView<wrench::SimulationTimestampLinkUsage>(0.0, 10.0)), std::vector<double>({0.0, 1.0, 2.0}));
+    output.addTimestampLinkUsage(4.0, "merge_test_link_a", 100.0);
+    ASSERT_EQ(getDates(output.getTraceView<wrench::SimulationTimestampLinkUsage>(3.0, 10.0)), std::vector<double>({4.0}));
+    ASSERT_EQ(getDates(output.getTraceView<wrench::SimulationTimestampLinkUsage>(0.0, 10.0)), std::vector<double>({0.0, 2.0, 4.0}));
+}
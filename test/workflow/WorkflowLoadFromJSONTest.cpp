@@ -8,6 +8,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <nlohmann/json.hpp>
 
 #include <wrench/data_file/DataFile.h>
 #include <wrench/workflow/Workflow.h>
@@ -54,3 +57,198 @@ TEST_F(WorkflowLoadFromJSONTest, LoadValidJSON) {
 
     ASSERT_LT(workflow->getCompletionDate(), 0.0);
 }
+
+TEST_F(WorkflowLoadFromJSONTest, StreamedAndInMemoryLoadsMatch) {
+
+    // Load the file (streamed) and its content (in memory)
+    auto streamed_workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(this->json_file_path, "1Gf", false);
+
+    std::ifstream file(this->json_file_path);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    auto in_memory_workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(buffer.str(), "1Gf", false);
+
+    ASSERT_EQ(streamed_workflow->getNumberOfTasks(), in_memory_workflow->getNumberOfTasks());
+    for (auto const &t: in_memory_workflow->getTaskMapView()) {
+        auto task = streamed_workflow->getTaskByID(t.first);
+        ASSERT_DOUBLE_EQ(task->getFlops(), t.second->getFlops());
+        ASSERT_EQ(task->getMinNumCores(), t.second->getMinNumCores());
+        ASSERT_EQ(task->getPriority(), t.second->getPriority());
+        ASSERT_EQ(task->getInputFiles().size(), t.second->getInputFiles().size());
+        ASSERT_EQ(task->getOutputFiles().size(), t.second->getOutputFiles().size());
+        ASSERT_EQ(task->getNumberOfParents(), t.second->getNumberOfParents());
+        ASSERT_EQ(task->getNumberOfChildren(), t.second->getNumberOfChildren());
+    }
+
+    // A truncated document
+    std::string truncated_file_path = UNIQUE_TMP_PATH_PREFIX + "truncated_workflow.json";
+    std::ofstream truncated_file(truncated_file_path);
+    truncated_file << buffer.str().substr(0, buffer.str().size() / 2);
+    truncated_file.close();
+    ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(truncated_file_path, "1Gf", false),
+                 nlohmann::json::parse_error);
+    ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(
+                         buffer.str().substr(0, buffer.str().size() / 2), "1Gf", false),
+                 nlohmann::json::parse_error);
+
+    // A document without a workflow/specification key
+    auto json = nlohmann::json::parse(buffer.str());
+    json["workflow"].erase("specification");
+    std::string no_specification_file_path = UNIQUE_TMP_PATH_PREFIX + "no_specification_workflow.json";
+    std::ofstream no_specification_file(no_specification_file_path);
+    no_specification_file << json.dump();
+    no_specification_file.close();
+    ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(no_specification_file_path, "1Gf", false),
+                 std::invalid_argument);
+    ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(json.dump(), "1Gf", false),
+                 std::invalid_argument);
+
+    std::remove(truncated_file_path.c_str());
+    std::remove(no_specification_file_path.c_str());
+}
+
+TEST_F(WorkflowLoadFromJSONTest, RetryAfterInvalidDocument) {
+
+    nlohmann::json json;
+    json["schemaVersion"] = "1.5";
+    json["workflow"]["specification"]["files"] = nlohmann::json::array(
+            {{{"id", "retry_input_file"}, {"sizeInBytes", 100}}, {{"id", "retry_output_file"}, {"sizeInBytes", 200}}});
+    json["workflow"]["specification"]["tasks"] = nlohmann::json::array(
+            {{{"name", "retry_task"},
+              {"id", "retry_task"},
+              {"parents", nlohmann::json::array()},
+              {"children", nlohmann::json::array()},
+              {"inputFiles", nlohmann::json::array({"retry_input_file"})},
+              {"outputFiles", nlohmann::json::array({"retry_output_file"})}}});
+
+    // Without a workflow/execution key, the document is rejected, and its files are not kept
+    std::string file_path = UNIQUE_TMP_PATH_PREFIX + "retry_workflow.json";
+    std::ofstream file(file_path);
+    file << json.dump();
+    file.close();
+    ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(file_path, "1Gf", false), std::invalid_argument);
+    ASSERT_THROW(wrench::Simulation::getFileByID("retry_input_file"), std::invalid_argument);
+    ASSERT_THROW(wrench::Simulation::getFileByID("retry_output_file"), std::invalid_argument);
+    ASSERT_THROW(wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(json.dump(), "1Gf", false),
+                 std::invalid_argument);
+    ASSERT_THROW(wrench::Simulation::getFileByID("retry_input_file"), std::invalid_argument);
+
+    // Once fixed, the document can be loaded, with the right file sizes
+    json["workflow"]["execution"]["tasks"] = nlohmann::json::array(
+            {{{"id", "retry_task"}, {"runtimeInSeconds", 10.0}, {"coreCount", 1}}});
+    file.open(file_path);
+    file << json.dump();
+    file.close();
+    std::shared_ptr<wrench::Workflow> workflow;
+    ASSERT_NO_THROW(workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(file_path, "1Gf", false));
+    ASSERT_EQ(workflow->getNumberOfTasks(), 1);
+    ASSERT_EQ(wrench::Simulation::getFileByID("retry_output_file")->getSize(), 200);
+
+    std::remove(file_path.c_str());
+}
+
+TEST_F(WorkflowLoadFromJSONTest, ParallelAndSerialLoadsMatch) {
+
+    auto serial_workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(this->json_file_path, "1Gf", false);
+
+    for (unsigned long num_threads: {2, 4, 0}) {
+        auto parallel_workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(
+                this->json_file_path, "1Gf", false, false, false, 1, 1, false, false, false, num_threads);
+
+        ASSERT_EQ(parallel_workflow->getNumberOfTasks(), serial_workflow->getNumberOfTasks());
+        for (auto const &t: serial_workflow->getTaskMapView()) {
+            auto task = parallel_workflow->getTaskByID(t.first);
+            ASSERT_DOUBLE_EQ(task->getFlops(), t.second->getFlops());
+            ASSERT_EQ(task->getMinNumCores(), t.second->getMinNumCores());
+            ASSERT_EQ(task->getMaxNumCores(), t.second->getMaxNumCores());
+            ASSERT_EQ(task->getPriority(), t.second->getPriority());
+            ASSERT_EQ(task->getInputFiles(), t.second->getInputFiles());
+            ASSERT_EQ(task->getOutputFiles(), t.second->getOutputFiles());
+            ASSERT_EQ(task->getNumberOfParents(), t.second->getNumberOfParents());
+            ASSERT_EQ(task->getNumberOfChildren(), t.second->getNumberOfChildren());
+            ASSERT_EQ(task->getTopLevel(), t.second->getTopLevel());
+        }
+    }
+}
+
+TEST_F(WorkflowLoadFromJSONTest, ParallelLoadOfManyTasks) {
+
+    // Generate a workflow with enough tasks for several parsing threads to be used
+    const int num_tasks = 300;
+    nlohmann::json json;
+    json["name"] = "many_tasks";
+    json["schemaVersion"] = "1.5";
+    json["workflow"]["execution"]["machines"] = nlohmann::json::array(
+            {{{"nodeName", "machine"}, {"cpu", {{"coreCount", 4}, {"speedInMHz", 1000}}}}});
+    for (int i = 0; i < num_tasks; i++) {
+        std::string id = "task_" + std::to_string(i);
+        std::string input_file = "many_tasks_file_" + std::to_string(i);
+        std::string output_file = "many_tasks_file_" + std::to_string(i + 1);
+        json["workflow"]["specification"]["files"].push_back({{"id", output_file}, {"sizeInBytes", 1000 + i}});
+        if (i == 0) {
+            json["workflow"]["specification"]["files"].push_back({{"id", input_file}, {"sizeInBytes", 1000}});
+        }
+        nlohmann::json parents = nlohmann::json::array();
+        nlohmann::json children = nlohmann::json::array();
+        if (i % 10 != 0) {
+            parents.push_back("task_" + std::to_string(i - 1));
+        }
+        if ((i + 1) % 10 != 0 and i + 1 < num_tasks) {
+            children.push_back("task_" + std::to_string(i + 1));
+        }
+        json["workflow"]["specification"]["tasks"].push_back({{"name", id},
+                                                              {"id", id},
+                                                              {"parents", parents},
+                                                              {"children", children},
+                                                              {"inputFiles", nlohmann::json::array({input_file})},
+                                                              {"outputFiles", nlohmann::json::array({output_file})}});
+        json["workflow"]["execution"]["tasks"].push_back({{"id", id},
+                                                          {"runtimeInSeconds", 10.0 + i},
+                                                          {"coreCount", 1 + i % 4},
+                                                          {"avgCPU", 50.0 + i % 100},
+                                                          {"machines", nlohmann::json::array({"machine"})}});
+    }
+
+    auto serial_workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(json.dump(), "1Gf", false);
+    ASSERT_EQ(serial_workflow->getNumberOfTasks(), num_tasks);
+
+    for (unsigned long num_threads: {2, 3, 8}) {
+        auto parallel_workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(
+                json.dump(), "1Gf", false, false, false, 1, 1, false, false, false, num_threads);
+
+        ASSERT_EQ(parallel_workflow->getNumberOfTasks(), serial_workflow->getNumberOfTasks());
+        for (auto const &t: serial_workflow->getTaskMapView()) {
+            auto task = parallel_workflow->getTaskByID(t.first);
+            ASSERT_DOUBLE_EQ(task->getFlops(), t.second->getFlops());
+            ASSERT_EQ(task->getMinNumCores(), t.second->getMinNumCores());
+            ASSERT_EQ(task->getMaxNumCores(), t.second->getMaxNumCores());
+            ASSERT_EQ(task->getInputFiles(), t.second->getInputFiles());
+            ASSERT_EQ(task->getOutputFiles(), t.second->getOutputFiles());
+            ASSERT_EQ(task->getNumberOfParents(), t.second->getNumberOfParents());
+            ASSERT_EQ(task->getNumberOfChildren(), t.second->getNumberOfChildren());
+            ASSERT_EQ(task->getTopLevel(), t.second->getTopLevel());
+        }
+    }
+
+    // Two malformed tasks, in different chunks: the error for the first one (in document order)
+    // should be reported, whichever thread parses it
+    json["workflow"]["execution"]["tasks"][10]["avgCPU"] = "not a number";
+    json["workflow"]["execution"]["tasks"][250]["coreCount"] = "not a number";
+    std::string serial_error;
+    try {
+        wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(json.dump(), "1Gf", false);
+        FAIL() << "A malformed workflow should not be loaded";
+    } catch (std::invalid_argument &e) {
+        serial_error = e.what();
+    }
+    ASSERT_NE(serial_error.find("Invalid avgCPU value"), std::string::npos);
+    for (unsigned long num_threads: {2, 3, 8}) {
+        try {
+            wrench::WfCommonsWorkflowParser::createWorkflowFromJSONString(
+                    json.dump(), "1Gf", false, false, false, 1, 1, false, false, false, num_threads);
+            FAIL() << "A malformed workflow should not be loaded";
+        } catch (std::invalid_argument &e) {
+            ASSERT_EQ(std::string(e.what()), serial_error);
+        }
+    }
+}
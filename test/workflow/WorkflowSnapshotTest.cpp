@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+
+#include <wrench/data_file/DataFile.h>
+#include <wrench/simulation/Simulation.h>
+#include <wrench/workflow/Workflow.h>
+#include <wrench/workflow/WorkflowSnapshot.h>
+#include "../include/UniqueTmpPathPrefix.h"
+#include <wrench/tools/wfcommons/WfCommonsWorkflowParser.h>
+
+class WorkflowSnapshotTest : public ::testing::Test {
+protected:
+    WorkflowSnapshotTest() {
+    }
+
+    void assertSameWorkflows(const std::shared_ptr<wrench::Workflow> &expected,
+                             const std::shared_ptr<wrench::Workflow> &actual) {
+        ASSERT_EQ(expected->getNumberOfTasks(), actual->getNumberOfTasks());
+        ASSERT_EQ(expected->getFileMap().size(), actual->getFileMap().size());
+        for (auto const &t: expected->getTaskMapView()) {
+            auto const &task = t.second;
+            auto loaded_task = actual->getTaskByID(t.first);
+            ASSERT_DOUBLE_EQ(task->getFlops(), loaded_task->getFlops());
+            ASSERT_EQ(task->getMinNumCores(), loaded_task->getMinNumCores());
+            ASSERT_EQ(task->getMaxNumCores(), loaded_task->getMaxNumCores());
+            ASSERT_EQ(task->getMemoryRequirement(), loaded_task->getMemoryRequirement());
+            ASSERT_EQ(task->getPriority(), loaded_task->getPriority());
+            ASSERT_EQ(task->getClusterID(), loaded_task->getClusterID());
+            ASSERT_EQ(task->getColor(), loaded_task->getColor());
+            ASSERT_EQ(task->getBytesRead(), loaded_task->getBytesRead());
+            ASSERT_EQ(task->getBytesWritten(), loaded_task->getBytesWritten());
+            ASSERT_EQ(task->getTopLevel(), loaded_task->getTopLevel());
+            ASSERT_EQ(task->getBottomLevel(), loaded_task->getBottomLevel());
+            ASSERT_EQ(task->getInputFiles(), loaded_task->getInputFiles());
+            ASSERT_EQ(task->getOutputFiles(), loaded_task->getOutputFiles());
+            std::set<std::string> children, loaded_children;
+            for (auto const &child: task->getChildren()) {
+                children.insert(child->getID());
+            }
+            for (auto const &child: loaded_task->getChildren()) {
+                loaded_children.insert(child->getID());
+            }
+            ASSERT_EQ(children, loaded_children);
+        }
+    }
+
+    // data members
+    std::string json_file_path = "../test/wfcommons_instances/1000genome-chameleon-2ch-100k-001.json";
+};
+
+TEST_F(WorkflowSnapshotTest, RoundTrip) {
+
+    auto workflow = wrench::Workflow::createWorkflow();
+    auto f1 = wrench::Simulation::addFile("snapshot_f1", 100);
+    auto f2 = wrench::Simulation::addFile("snapshot_f2", 200);
+    auto t1 = workflow->addTask("t1", 10.0, 1, 4, 50);
+    auto t2 = workflow->addTask("t2", 20.0, 2, 2, 0);
+    auto t3 = workflow->addTask("t3", 30.0, 1, 1, 0);
+    auto t4 = workflow->addTask("t4", 40.0, 1, 1, 0);
+    t1->setClusterID("cluster");
+    t2->setColor("#FF0000");
+    t3->setPriority(7);
+    t3->setParallelModel(wrench::ParallelModel::AMDAHL(0.5));
+    t1->addOutputFile(f1);
+    t2->addInputFile(f1);
+    t2->addOutputFile(f2);
+    t3->addInputFile(f1);
+    t3->addInputFile(f2);
+    workflow->addControlDependency(t3, t4);
+    workflow->addControlDependency(t1, t4, true);
+
+    std::string snapshot_path = UNIQUE_TMP_PATH_PREFIX + "workflow.snapshot";
+    ASSERT_NO_THROW(wrench::WorkflowSnapshot::save(workflow, snapshot_path));
+
+    std::shared_ptr<wrench::Workflow> loaded_workflow;
+    ASSERT_NO_THROW(loaded_workflow = wrench::WorkflowSnapshot::load(snapshot_path));
+    assertSameWorkflows(workflow, loaded_workflow);
+
+    // Files are shared, and the redundant dependency is kept
+    ASSERT_EQ(loaded_workflow->getTaskByID("t2")->getInputFiles().front(), f1);
+    ASSERT_TRUE(loaded_workflow->pathExists(loaded_workflow->getTaskByID("t1"), loaded_workflow->getTaskByID("t4")));
+    ASSERT_EQ(loaded_workflow->getTaskByID("t4")->getNumberOfParents(), 2);
+
+    auto amdahl = std::dynamic_pointer_cast<wrench::AmdahlParallelModel>(
+            loaded_workflow->getTaskByID("t3")->getParallelModel());
+    ASSERT_NE(amdahl, nullptr);
+    ASSERT_DOUBLE_EQ(amdahl->getAlpha(), 0.5);
+
+    // Custom parallel models cannot be saved
+    t4->setParallelModel(wrench::ParallelModel::CUSTOM(
+            [](double work, long num_threads) { return 0.0; },
+            [](double work, long num_threads) { return work / (double) num_threads; }));
+    ASSERT_THROW(wrench::WorkflowSnapshot::save(workflow, snapshot_path), std::invalid_argument);
+
+    remove(snapshot_path.c_str());
+}
+
+TEST_F(WorkflowSnapshotTest, RoundTripWfCommonsWorkflow) {
+
+    auto workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(this->json_file_path, "1Gf", false);
+
+    std::string snapshot_path = UNIQUE_TMP_PATH_PREFIX + "wfcommons_workflow.snapshot";
+    ASSERT_NO_THROW(wrench::WorkflowSnapshot::save(workflow, snapshot_path));
+
+    std::shared_ptr<wrench::Workflow> loaded_workflow;
+    ASSERT_NO_THROW(loaded_workflow = wrench::WorkflowSnapshot::load(snapshot_path));
+    assertSameWorkflows(workflow, loaded_workflow);
+    ASSERT_EQ(loaded_workflow->getNumLevels(), workflow->getNumLevels());
+
+    remove(snapshot_path.c_str());
+}
+
+TEST_F(WorkflowSnapshotTest, InvalidSnapshots) {
+
+    ASSERT_THROW(wrench::WorkflowSnapshot::save(nullptr, "whatever"), std::invalid_argument);
+    ASSERT_THROW(wrench::WorkflowSnapshot::load("bogus"), std::invalid_argument);
+    ASSERT_THROW(wrench::WorkflowSnapshot::load(this->json_file_path), std::invalid_argument);
+
+    auto workflow = wrench::Workflow::createWorkflow();
+    auto t1 = workflow->addTask("t1", 10.0, 1, 1, 0);
+    auto t2 = workflow->addTask("t2", 10.0, 1, 1, 0);
+    workflow->addControlDependency(t1, t2);
+
+    std::string snapshot_path = UNIQUE_TMP_PATH_PREFIX + "valid.snapshot";
+    wrench::WorkflowSnapshot::save(workflow, snapshot_path);
+    std::ifstream snapshot_file(snapshot_path, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(snapshot_file)), std::istreambuf_iterator<char>());
+
+    // A truncated snapshot
+    std::string truncated_path = UNIQUE_TMP_PATH_PREFIX + "truncated.snapshot";
+    std::ofstream truncated_file(truncated_path, std::ios::binary);
+    truncated_file << content.substr(0, content.size() - 16);
+    truncated_file.close();
+    ASSERT_THROW(wrench::WorkflowSnapshot::load(truncated_path), std::invalid_argument);
+
+    remove(snapshot_path.c_str());
+    remove(truncated_path.c_str());
+}
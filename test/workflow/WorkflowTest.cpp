@@ -170,6 +170,13 @@ TEST_F(WorkflowTest, WorkflowStructure) {
     ASSERT_EQ(exit_tasks.size(), 1);
     ASSERT_TRUE(*(exit_tasks.begin()) == t4);
 
+    // Non-copying views
+    ASSERT_EQ(4, workflow->getTaskMapView().size());
+    ASSERT_EQ(t1, workflow->getEntryTaskMapView().at(t1->getID()));
+    ASSERT_EQ(t4, workflow->getExitTaskMapView().at(t4->getID()));
+    ASSERT_EQ(f1, workflow->getInputFileMapView().at(f1->getID()));
+    ASSERT_EQ(f5, workflow->getOutputFileMapView().at(f5->getID()));
+
     // remove tasks
     workflow->removeTask(t4);
     ASSERT_EQ(0, workflow->getTaskChildren(t3).size());
@@ -177,6 +184,17 @@ TEST_F(WorkflowTest, WorkflowStructure) {
 
     ASSERT_EQ(3, workflow->getTasks().size());
 
+    // Cached entry/exit tasks and input/output files are updated
+    ASSERT_EQ(2, workflow->getExitTaskMapView().size());
+    ASSERT_EQ(1, workflow->getExitTaskMapView().count(t2->getID()));
+    ASSERT_EQ(1, workflow->getExitTaskMapView().count(t3->getID()));
+    ASSERT_EQ(0, workflow->getOutputFileMapView().count(f5->getID()));
+    ASSERT_EQ(1, workflow->getOutputFileMapView().count(f3->getID()));
+    ASSERT_EQ(1, workflow->getOutputFileMapView().count(f4->getID()));
+    workflow->addControlDependency(t2, t3);
+    ASSERT_EQ(1, workflow->getExitTasks().size());
+    ASSERT_EQ(t3, workflow->getExitTasks().at(0));
+
     workflow->removeTask(t1);
 }
 
@@ -267,6 +285,30 @@ void doTopBottomLevelsTest(bool dynamic_updates) {
 
     ASSERT_EQ(wf->getTasksInTopLevelRange(1, 2).size(), 3);
     ASSERT_EQ(wf->getTasksInBottomLevelRange(0, 2).size(), 5);
+
+    // Weighted critical paths
+    ASSERT_DOUBLE_EQ(wf->getCriticalPathFlops(), 4.0);
+    ASSERT_DOUBLE_EQ(t4->getFlopWeightedBottomLevel(), 2.0);
+    ASSERT_DOUBLE_EQ(wf->getCriticalPathBytes(), 0.0);
+    t2->setFlops(10.0);
+    t4->addInputFile(wrench::Simulation::addFile("critical_path_file", 100));
+
+    if (not dynamic_updates) {
+        wf->updateAllTopBottomLevels();
+    }
+
+    ASSERT_DOUBLE_EQ(wf->getCriticalPathFlops(), 12.0);
+    ASSERT_DOUBLE_EQ(t1->getFlopWeightedBottomLevel(), 11.0);
+    ASSERT_DOUBLE_EQ(wf->getCriticalPathBytes(), 100.0);
+    ASSERT_DOUBLE_EQ(t3->getByteWeightedBottomLevel(), 100.0);
+    ASSERT_DOUBLE_EQ(t5->getByteWeightedBottomLevel(), 0.0);
+
+    wf->removeTask(t2);
+    if (not dynamic_updates) {
+        wf->updateAllTopBottomLevels();
+    }
+    ASSERT_DOUBLE_EQ(wf->getCriticalPathFlops(), 4.0);
+    wrench::Simulation::removeFile(wrench::Simulation::getFileByID("critical_path_file"));
 }
 
 TEST_F(WorkflowTest, TopBottomLevelsDynamic) {
@@ -275,6 +317,72 @@ TEST_F(WorkflowTest, TopBottomLevelsDynamic) {
 }
 
 
+TEST_F(WorkflowTest, BulkDependencyInsertion) {
+    auto wf = wrench::Workflow::createWorkflow();
+    auto t1 = wf->addTask("t1", 1.0, 1, 1, 0.0);
+    auto t2 = wf->addTask("t2", 1.0, 1, 1, 0.0);
+    auto t3 = wf->addTask("t3", 1.0, 1, 1, 0.0);
+    auto t4 = wf->addTask("t4", 1.0, 1, 1, 0.0);
+
+    ASSERT_THROW(wf->commitBulkDependencyInsertion(), std::runtime_error);
+    wf->beginBulkDependencyInsertion();
+    ASSERT_TRUE(wf->isBulkDependencyInsertionInProgress());
+    ASSERT_THROW(wf->beginBulkDependencyInsertion(), std::runtime_error);
+    wf->addControlDependency(t1, t3);// redundant, will be dropped
+    wf->addControlDependency(t1, t2);
+    wf->addControlDependency(t2, t3);
+    wf->addControlDependency(t2, t3);// duplicate
+    wf->addControlDependency(t3, t4);
+    wf->addControlDependency(t1, t4, true);// redundant, but kept
+    ASSERT_EQ(0, wf->getTaskNumberOfParents(t4));
+    ASSERT_THROW(wf->removeTask(t4), std::runtime_error);
+    ASSERT_THROW(wf->removeControlDependency(t3, t4), std::runtime_error);
+    wf->commitBulkDependencyInsertion();
+    ASSERT_FALSE(wf->isBulkDependencyInsertionInProgress());
+
+    ASSERT_EQ(2, wf->getTaskNumberOfChildren(t1));
+    ASSERT_EQ(1, wf->getTaskNumberOfParents(t3));
+    ASSERT_EQ(2, wf->getTaskNumberOfParents(t4));
+    ASSERT_EQ(wrench::WorkflowTask::State::READY, t1->getState());
+    ASSERT_EQ(wrench::WorkflowTask::State::NOT_READY, t4->getState());
+    ASSERT_EQ(3, t4->getTopLevel());
+    ASSERT_EQ(3, t1->getBottomLevel());
+
+    // Cycle-creating dependencies
+    wf->beginBulkDependencyInsertion();
+    wf->addControlDependency(t4, t1);
+    ASSERT_THROW(wf->commitBulkDependencyInsertion(), std::runtime_error);
+    ASSERT_EQ(0, wf->getTaskNumberOfChildren(t4));
+
+    auto t5 = wf->addTask("t5", 1.0, 1, 1, 0.0);
+    wf->beginBulkDependencyInsertion();
+    wf->addControlDependency(t4, t1);
+    wf->addControlDependency(t4, t5);
+    ASSERT_NO_THROW(wf->commitBulkDependencyInsertion(true));
+    ASSERT_EQ(1, wf->getTaskNumberOfChildren(t4));
+    ASSERT_EQ(4, t5->getTopLevel());
+
+    wf->clear();
+}
+
+TEST_F(WorkflowTest, TasksOutlivingClear) {
+    auto wf = wrench::Workflow::createWorkflow();
+    auto t1 = wf->addTask("t1", 1.0, 1, 1, 0.0);
+    auto t2 = wf->addTask("t2", 1.0, 1, 1, 0.0);
+    t2->setClusterID("cluster");
+    ASSERT_EQ(2, wf->getReadyTasks().size());
+
+    wf->clear();
+
+    // Tasks that outlive the clearing of their workflow are no longer in its ready tasks
+    ASSERT_TRUE(wf->getReadyTasks().empty());
+    ASSERT_TRUE(wf->getReadyClusters().empty());
+    ASSERT_NO_THROW(t1->setState(wrench::WorkflowTask::State::COMPLETED));
+    ASSERT_NO_THROW(t2->setClusterID("other_cluster"));
+    ASSERT_NO_THROW(t2->setState(wrench::WorkflowTask::State::COMPLETED));
+    ASSERT_TRUE(wf->getReadyTasks().empty());
+}
+
 TEST_F(WorkflowTest, WorkflowTaskThrow) {
     // testing invalid task1 creation
     ASSERT_THROW(workflow->addTask("task1-error", -100, 1, 1, 0), std::invalid_argument);
@@ -344,6 +452,42 @@ TEST_F(WorkflowTest, IsDone) {
     ASSERT_TRUE(workflow->isDone());
 }
 
+TEST_F(WorkflowTest, ReadyTasksAndClusters) {
+    ASSERT_EQ(1, workflow->getReadyTasksView().size());
+    ASSERT_EQ(t1, workflow->getReadyTasksView().at(0));
+    ASSERT_TRUE(workflow->getReadyClustersView().empty());
+    ASSERT_TRUE(workflow->getReadyClusterView("cluster-01").empty());
+
+    t1->setInternalState(wrench::WorkflowTask::InternalState::TASK_COMPLETED);
+    t1->setState(wrench::WorkflowTask::State::COMPLETED);
+    wrench::Workflow::updateReadiness(t2.get());
+    wrench::Workflow::updateReadiness(t3.get());
+    wrench::Workflow::updateReadiness(t4.get());
+
+    ASSERT_EQ(2, workflow->getReadyTasksView().size());
+    ASSERT_EQ(2, workflow->getReadyTasks().size());
+    ASSERT_EQ(2, workflow->getReadyClusterView("cluster-01").size());
+    ASSERT_EQ(1, workflow->getReadyClusters().size());
+
+    // Changing the cluster ID of a ready task moves it to another cluster
+    t2->setClusterID("cluster-02");
+    ASSERT_EQ(1, workflow->getReadyClusterView("cluster-01").size());
+    ASSERT_EQ(t3, workflow->getReadyClusterView("cluster-01").at(0));
+    ASSERT_EQ(1, workflow->getReadyClusterView("cluster-02").size());
+    t3->setClusterID("");
+    ASSERT_EQ(1, workflow->getReadyClustersView().size());
+    auto clusters = workflow->getReadyClusters();
+    ASSERT_EQ(2, clusters.size());
+    ASSERT_EQ(1, clusters[t3->getID()].size());
+
+    // A task that is no longer ready leaves its cluster
+    t2->setState(wrench::WorkflowTask::State::PENDING);
+    ASSERT_TRUE(workflow->getReadyClustersView().empty());
+    ASSERT_EQ(1, workflow->getReadyTasksView().size());
+    workflow->removeTask(t3);
+    ASSERT_TRUE(workflow->getReadyTasksView().empty());
+}
+
 TEST_F(WorkflowTest, SumFlops) {
 
     double sum_flops = 0;
@@ -352,6 +496,21 @@ TEST_F(WorkflowTest, SumFlops) {
     ASSERT_EQ(sum_flops, 4.0);
 }
 
+TEST_F(WorkflowTest, MutateRemovedTask) {
+    workflow->removeTask(t4);
+    ASSERT_EQ(0, t2->getBottomLevel());
+
+    // A task that is no longer in the DAG can still be mutated
+    ASSERT_NO_THROW(t4->setFlops(10.0));
+    ASSERT_NO_THROW(t4->addInputFile(wrench::Simulation::addFile("file-06", 100)));
+    ASSERT_NO_THROW(t4->addOutputFile(wrench::Simulation::addFile("file-07", 100)));
+
+    // And the remaining tasks are unaffected
+    ASSERT_EQ(3, workflow->getNumberOfTasks());
+    ASSERT_EQ(0, t2->getBottomLevel());
+    ASSERT_DOUBLE_EQ(2.0, workflow->getCriticalPathFlops());
+}
+
 
 class AllDependenciesWorkflowTest : public ::testing::Test {
 protected:
@@ -406,10 +565,21 @@ TEST_F(AllDependenciesWorkflowTest, AllDependenciesWorkflowStructure) {
 
     ASSERT_EQ(4, workflow->getNumLevels());
 
+    // testing level-range queries
+    ASSERT_EQ(2, workflow->getTasksInTopLevelRange(1, 2).size());
+    ASSERT_EQ(4, workflow->getTasksInTopLevelRange(-10, 10).size());
+    ASSERT_EQ(0, workflow->getTasksInTopLevelRange(4, 10).size());
+    ASSERT_EQ(t1, workflow->getTasksInBottomLevelRange(3, 3).at(0));
+    ASSERT_EQ(workflow->getTasks(), workflow->getTasksInTopLevelRange(-10, 10));
+    ASSERT_EQ(workflow->getTasks(), workflow->getTasksInBottomLevelRange(-10, 10));
+
     // remove tasks
     workflow->removeTask(t4);
     ASSERT_EQ(0, workflow->getTaskChildren(t3).size());
     ASSERT_EQ(1, workflow->getTaskChildren(t2).size());
+    ASSERT_EQ(3, workflow->getNumLevels());
+    ASSERT_EQ(t3, workflow->getTasksInBottomLevelRange(0, 0).at(0));
+    ASSERT_EQ(1, workflow->getTasksInTopLevelRange(2, 2).size());
 
     ASSERT_EQ(3, workflow->getTasks().size());
 
@@ -453,3 +623,70 @@ TEST_F(WorkflowTest, LowLevelDagOfTasksTest) {
     ASSERT_NO_THROW(dag.getParents((wrench::WorkflowTask *) 1));
     ASSERT_THROW(dag.getParents((wrench::WorkflowTask *) 3), std::invalid_argument);
 }
+
+TEST_F(WorkflowTest, LowLevelDagOfTasksCompactionTest) {
+    wrench::DagOfTasks dag;
+    const unsigned long num_vertices = 3000;
+
+    // A chain of vertices
+    for (unsigned long i = 1; i <= num_vertices; i++) {
+        ASSERT_EQ(i - 1, dag.addVertex((wrench::WorkflowTask *) i));
+    }
+    for (unsigned long i = 1; i < num_vertices; i++) {
+        dag.addEdge((wrench::WorkflowTask *) i, (wrench::WorkflowTask *) (i + 1));
+    }
+    ASSERT_TRUE(dag.doesPathExist((wrench::WorkflowTask *) 1, (wrench::WorkflowTask *) num_vertices));
+
+    // Remove every other vertex, and reconnect the remaining ones
+    for (unsigned long i = 2; i <= num_vertices; i += 2) {
+        dag.removeVertex((wrench::WorkflowTask *) i);
+    }
+    ASSERT_FALSE(dag.doesPathExist((wrench::WorkflowTask *) 1, (wrench::WorkflowTask *) 3));
+    ASSERT_EQ(0, dag.getNumberOfChildren((wrench::WorkflowTask *) 1));
+    for (unsigned long i = 1; i + 2 < num_vertices; i += 2) {
+        dag.addEdge((wrench::WorkflowTask *) i, (wrench::WorkflowTask *) (i + 2));
+    }
+
+    ASSERT_TRUE(dag.shouldBeCompacted());
+    auto new_indices = dag.compact();
+    ASSERT_FALSE(dag.shouldBeCompacted());
+    ASSERT_EQ(0, new_indices[0]);
+    ASSERT_EQ(wrench::DagOfTasks::NO_VERTEX, new_indices[1]);
+    ASSERT_EQ(1, new_indices[2]);
+
+    ASSERT_TRUE(dag.doesPathExist((wrench::WorkflowTask *) 1, (wrench::WorkflowTask *) (num_vertices - 1)));
+    ASSERT_EQ(1, dag.getVertexNumberOfChildren(0));
+    ASSERT_EQ((wrench::WorkflowTask *) 3, dag.getVertexChildren(0).at(0));
+    ASSERT_EQ((wrench::WorkflowTask *) 1, dag.getVertexParents(1).at(0));
+    ASSERT_THROW(dag.getVertexChildren(num_vertices), std::invalid_argument);
+}
+
+TEST_F(WorkflowTest, LowLevelDagOfTasksEdgeChurnTest) {
+    wrench::DagOfTasks dag;
+    const unsigned long num_vertices = 3000;
+
+    for (unsigned long i = 1; i <= num_vertices; i++) {
+        dag.addVertex((wrench::WorkflowTask *) i);
+    }
+
+    // Repeatedly add and remove a chain of edges (so that the CSR arrays are rebuilt
+    // both because of added edges and because of removed edges)
+    for (int round = 0; round < 3; round++) {
+        for (unsigned long i = 1; i < num_vertices; i++) {
+            dag.addEdge((wrench::WorkflowTask *) i, (wrench::WorkflowTask *) (i + 1));
+        }
+        ASSERT_TRUE(dag.doesPathExist((wrench::WorkflowTask *) 1, (wrench::WorkflowTask *) num_vertices));
+        for (unsigned long i = 1; i < num_vertices; i += 2) {
+            dag.removeEdge((wrench::WorkflowTask *) i, (wrench::WorkflowTask *) (i + 1));
+        }
+        ASSERT_FALSE(dag.doesPathExist((wrench::WorkflowTask *) 1, (wrench::WorkflowTask *) 3));
+        ASSERT_TRUE(dag.doesEdgeExist((wrench::WorkflowTask *) 2, (wrench::WorkflowTask *) 3));
+        for (unsigned long i = 2; i < num_vertices; i += 2) {
+            dag.removeEdge((wrench::WorkflowTask *) i, (wrench::WorkflowTask *) (i + 1));
+        }
+        for (unsigned long i = 1; i <= num_vertices; i++) {
+            ASSERT_EQ(0, dag.getNumberOfChildren((wrench::WorkflowTask *) i));
+            ASSERT_EQ(0, dag.getNumberOfParents((wrench::WorkflowTask *) i));
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+#include <wrench/tools/wfcommons/WfCommonsWorkflowParser.h>
+
+#include <iostream>
+#include <string>
+
+
+int main(int argc, char **argv) {
+
+    bool ignore_machine_specs = false;
+    bool redundant_dependencies = false;
+    bool ignore_cycle_creating_dependencies = false;
+    bool ignore_avg_cpu = false;
+    unsigned long num_parsing_threads = 1;
+    bool valid_args = (argc >= 4);
+
+    for (int i = 4; valid_args and (i < argc); i++) {
+        std::string option(argv[i]);
+        if (option == "--ignore-machine-specs") {
+            ignore_machine_specs = true;
+        } else if (option == "--redundant-dependencies") {
+            redundant_dependencies = true;
+        } else if (option == "--ignore-cycle-creating-dependencies") {
+            ignore_cycle_creating_dependencies = true;
+        } else if (option == "--ignore-avg-cpu") {
+            ignore_avg_cpu = true;
+        } else if ((option == "--num-parsing-threads") and (i + 1 < argc)) {
+            try {
+                num_parsing_threads = std::stoul(argv[++i]);
+            } catch (std::exception &e) {
+                valid_args = false;
+            }
+        } else {
+            valid_args = false;
+        }
+    }
+
+    if (not valid_args) {
+        std::cerr << "Usage: " << argv[0] << " <path to JSON workflow> <path to snapshot file> <reference flop rate> "
+                                             "[--ignore-machine-specs] [--redundant-dependencies] "
+                                             "[--ignore-cycle-creating-dependencies] [--ignore-avg-cpu] "
+                                             "[--num-parsing-threads <n>]\n";
+        std::cerr << "  This program takes as input a WfCommons workflow instance JSON file and writes a binary workflow "
+                     "snapshot file (see wrench::WorkflowSnapshot) that can be loaded much faster than the JSON file. "
+                     "The reference flop rate (e.g., \"100Gf\") and options have the same meaning as the arguments of "
+                     "wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(), and must be chosen at conversion time "
+                     "since the snapshot holds task flops and dependencies, not the original JSON. Passing "
+                     "--num-parsing-threads 0 parses tasks with as many threads as there are hardware threads.\n";
+        exit(1);
+    }
+
+    std::shared_ptr<wrench::Workflow> workflow;
+    try {
+        workflow = wrench::WfCommonsWorkflowParser::createWorkflowFromJSON(
+                argv[1], argv[3], ignore_machine_specs, redundant_dependencies, ignore_cycle_creating_dependencies,
+                1, 1, false, ignore_avg_cpu, true, num_parsing_threads);
+    } catch (std::exception &e) {
+        std::cerr << "Error reading in workflow file at " + std::string(argv[1]) + ": " + std::string(e.what()) + "\n";
+        exit(1);
+    }
+
+    try {
+        wrench::WorkflowSnapshot::save(workflow, argv[2]);
+    } catch (std::exception &e) {
+        std::cerr << "Error writing snapshot file at " + std::string(argv[2]) + ": " + std::string(e.what()) + "\n";
+        exit(1);
+    }
+
+    std::cerr << "Wrote a snapshot of " << workflow->getNumberOfTasks() << " tasks to " << argv[2] << "\n";
+}
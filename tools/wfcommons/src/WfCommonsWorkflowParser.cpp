@@ -11,7 +11,13 @@
 #include <wrench-dev.h>
 #include <wrench/util/UnitParser.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <iostream>
+#include <sstream>
+#include <thread>
 #include <vector>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -21,187 +27,454 @@ WRENCH_LOG_CATEGORY(wfcommons_workflow_parser, "Log category for WfCommonsWorkfl
 
 
 namespace wrench {
+
     /**
-     * Documentation in .h file
+     * @brief Helper class that builds a workflow from the pieces of a WfFormat JSON document
+     *        (machines, files, task specifications, task executions) one piece at a time, and in whatever
+     *        order these pieces are found in the document. Tasks and files are created as soon as they are
+     *        added, while task executions (which may require machine descriptions found later in the document)
+     *        and dependencies on tasks not created yet are resolved when the workflow is finalized.
+     *        Task specifications and task executions can be parsed by multiple threads, in batches, in
+     *        which case they are still committed to the workflow in document order (and warnings are
+     *        shown in that order), so that the resulting workflow does not depend on the number of threads.
      */
-    std::shared_ptr<Workflow> WfCommonsWorkflowParser::createWorkflowFromJSON(const std::string& filename,
-                                                                              const std::string& reference_flop_rate,
-                                                                              bool ignore_machine_specs,
-                                                                              bool redundant_dependencies,
-                                                                              bool ignore_cycle_creating_dependencies,
-                                                                              unsigned long min_cores_per_task,
-                                                                              unsigned long max_cores_per_task,
-                                                                              bool enforce_num_cores,
-                                                                              bool ignore_avg_cpu,
-                                                                              bool show_warnings) {
-        std::ifstream file;
-        // handle exceptions when opening the json file
-        file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-        try {
-            file.open(filename);
-            std::stringstream buffer;
-            buffer << file.rdbuf();
-            return WfCommonsWorkflowParser::createWorkflowFromJSONString(
-                buffer.str(), reference_flop_rate, ignore_machine_specs,
-                redundant_dependencies,
-                ignore_cycle_creating_dependencies,
-                min_cores_per_task,
-                max_cores_per_task,
-                enforce_num_cores,
-                ignore_avg_cpu,
-                show_warnings);
-        }
-        catch (const std::ifstream::failure& e) {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid JSON file (" + std::string(e.what()) + ")");
-        }
-    }
+    class WfCommonsWorkflowBuilder {
 
-    /**
-    * Documentation in .h file
-    */
-    std::shared_ptr<Workflow> WfCommonsWorkflowParser::createWorkflowFromJSONString(const std::string& json_string,
-        const std::string& reference_flop_rate,
-        bool ignore_machine_specs,
-        bool redundant_dependencies,
-        bool ignore_cycle_creating_dependencies,
-        unsigned long min_cores_per_task,
-        unsigned long max_cores_per_task,
-        bool enforce_num_cores,
-        bool ignore_avg_cpu,
-        bool show_warnings) {
-        std::set<std::string> ignored_auxiliary_jobs;
-        std::set<std::string> ignored_transfer_jobs;
+    public:
+        /**
+         * @brief Constructor
+         * @param reference_flop_rate: a reference compute speed (see WfCommonsWorkflowParser)
+         * @param ignore_machine_specs: whether to ignore machine specs (see WfCommonsWorkflowParser)
+         * @param redundant_dependencies: whether to add redundant dependencies (see WfCommonsWorkflowParser)
+         * @param ignore_cycle_creating_dependencies: whether to ignore cycle-creating dependencies (see WfCommonsWorkflowParser)
+         * @param min_cores_per_task: default min number of cores per task (see WfCommonsWorkflowParser)
+         * @param max_cores_per_task: default max number of cores per task (see WfCommonsWorkflowParser)
+         * @param enforce_num_cores: whether to enforce the default numbers of cores (see WfCommonsWorkflowParser)
+         * @param ignore_avg_cpu: whether to ignore avgCPU values (see WfCommonsWorkflowParser)
+         * @param show_warnings: whether to show warnings (see WfCommonsWorkflowParser)
+         * @param num_parsing_threads: the number of threads used to parse tasks (see WfCommonsWorkflowParser)
+         */
+        WfCommonsWorkflowBuilder(const std::string &reference_flop_rate,
+                                 bool ignore_machine_specs,
+                                 bool redundant_dependencies,
+                                 bool ignore_cycle_creating_dependencies,
+                                 unsigned long min_cores_per_task,
+                                 unsigned long max_cores_per_task,
+                                 bool enforce_num_cores,
+                                 bool ignore_avg_cpu,
+                                 bool show_warnings,
+                                 unsigned long num_parsing_threads) : ignore_machine_specs(ignore_machine_specs),
+                                                       redundant_dependencies(redundant_dependencies),
+                                                       ignore_cycle_creating_dependencies(ignore_cycle_creating_dependencies),
+                                                       min_cores_per_task(min_cores_per_task),
+                                                       max_cores_per_task(max_cores_per_task),
+                                                       enforce_num_cores(enforce_num_cores),
+                                                       ignore_avg_cpu(ignore_avg_cpu),
+                                                       show_warnings(show_warnings),
+                                                       num_parsing_threads(num_parsing_threads) {
+            this->flop_rate = UnitParser::parse_compute_speed(reference_flop_rate);
+            if (this->num_parsing_threads == 0) {
+                this->num_parsing_threads = std::max<unsigned long>(1, std::thread::hardware_concurrency());
+            }
+            this->start_time = std::chrono::steady_clock::now();
 
-        // Create a new workflow object. Note that we do not use the name
-        // in the WfInstance but instead generate a generic unique name
-        // in the constructor below
-        auto workflow = Workflow::createWorkflow();
-        workflow->enableTopBottomLevelDynamicUpdates(false);
+            // Create a new workflow object. Note that we do not use the name
+            // in the WfInstance but instead generate a generic unique name
+            // in the constructor below
+            this->workflow = Workflow::createWorkflow();
+            this->workflow->enableTopBottomLevelDynamicUpdates(false);
 
-        double flop_rate;
+            // All dependencies (file-induced or explicit) are added in bulk once all tasks have been created
+            this->workflow->beginBulkDependencyInsertion();
+        }
 
-        try {
-            flop_rate = UnitParser::parse_compute_speed(reference_flop_rate);
+        /**
+         * @brief Check the schema version of the document
+         * @param schema_version: the schema version
+         */
+        void setSchemaVersion(const nlohmann::json &schema_version) {
+            if (schema_version != "1.5") {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Only handles WfFormat schema version 1.5 "
+                        "(use the script at https://github.com/wfcommons/WfFormat/tree/main/tools/ to update your workflow instances).");
+            }
+            this->found_schema_version = true;
         }
-        catch (std::invalid_argument&) {
-            throw;
+
+        /**
+         * @brief Record that the document has a 'workflow' key
+         */
+        void setFoundWorkflow() {
+            this->found_workflow = true;
         }
 
-        nlohmann::json j = nlohmann::json::parse(json_string);
+        /**
+         * @brief Record that the document has a 'workflow/execution' key
+         */
+        void setFoundExecution() {
+            this->found_execution = true;
+        }
 
-        // Check schema version
-        nlohmann::json schema_version;
-        try {
-            schema_version = j.at("schemaVersion");
-        } catch (std::out_of_range&) {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'schema_version' key");
+        /**
+         * @brief Record that the document has a 'workflow/specification' key
+         */
+        void setFoundSpecification() {
+            this->found_specification = true;
         }
-        if (schema_version != "1.5") {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): Only handles WfFormat schema version 1.5 "
-                "(use the script at https://github.com/wfcommons/WfFormat/tree/main/tools/ to update your workflow instances).");
+
+        /**
+         * @brief Add a machine description
+         * @param machine_spec: the JSON machine description
+         */
+        void addMachine(const nlohmann::json &machine_spec) {
+            // Keep warnings in document order
+            this->flushPendingTasks();
+
+            std::string name = machine_spec.at("nodeName");
+            nlohmann::json core_spec = machine_spec.at("cpu");
+            unsigned long num_cores;
+            try {
+                num_cores = core_spec.at("coreCount");
+            }
+            catch (nlohmann::detail::out_of_range&) {
+                num_cores = 1;
+            } catch (nlohmann::detail::type_error& e) {
+                throw std::invalid_argument(
+                    "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid coreCount value: " + std::string(
+                        e.what()));
+            }
+            double mhz;
+            try {
+                mhz = core_spec.at("speedInMHz");
+            }
+            catch (nlohmann::detail::out_of_range&) {
+                if (show_warnings) std::cerr << "[WARNING]: Machine " + name + " does not define a speed\n";
+                mhz = -1.0; // unknown
+            } catch (nlohmann::detail::type_error& e) {
+                throw std::invalid_argument(
+                    "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid speedInMhz value: " + std::string(
+                        e.what()));
+            }
+            this->machines[name] = std::make_pair(num_cores, mhz);
         }
 
-        nlohmann::json workflow_spec;
-        try {
-            workflow_spec = j.at("workflow");
+        /**
+         * @brief Add a file description (the file is created right away, unless it already exists)
+         * @param file_spec: the JSON file description
+         */
+        void addFile(const nlohmann::json &file_spec) {
+            std::string file_name = file_spec.at("id");
+            try {
+                Simulation::getFileByID(file_name);
+            }
+            catch (const std::invalid_argument&) {
+                // making a new file
+                sg_size_t file_size = file_spec.at("sizeInBytes");
+                this->added_files.push_back(Simulation::addFile(file_name, file_size));
+            }
+            this->num_files++;
         }
-        catch (std::out_of_range&) {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'workflow' key");
+
+        /**
+         * @brief Remove the files that this builder added to the simulation (used when the document
+         *        turns out to be invalid, so that a corrected document can then be loaded)
+         */
+        void removeAddedFiles() {
+            for (auto const &file: this->added_files) {
+                Simulation::removeFile(file);
+            }
+            this->added_files.clear();
         }
 
+        /**
+         * @brief Add a task specification (the task is created right away, or when the current batch
+         *        of task specifications is full if tasks are parsed by multiple threads)
+         * @param task_spec: the JSON task specification
+         */
+        void addTaskSpecification(nlohmann::json task_spec) {
+            if (this->num_parsing_threads == 1) {
+                this->commitTaskSpecification(parseTaskSpecification(task_spec));
+                return;
+            }
+            this->pending_task_specs.push_back(std::move(task_spec));
+            if (this->pending_task_specs.size() >= this->num_parsing_threads * PARSING_BATCH_SIZE_PER_THREAD) {
+                this->flushPendingTasks();
+            }
+        }
 
-        // Require the workflow/execution key
-        if (not workflow_spec.contains("execution")) {
-            throw std::invalid_argument(
-                "WfCommonsWorkflowParser::createWorkflowFromJson(): The WfInstance doesn't contain a 'workflow/execution' key. "
-                "Although this key isn't required in the WfInstances format, WRENCH requires it to determine task "
-                "flop rates based on measured task execution times.");
+        /**
+         * @brief Add a task execution (applied to its task when the workflow is finalized)
+         * @param task_exec: the JSON task execution
+         */
+        void addTaskExecution(nlohmann::json task_exec) {
+            if (this->num_parsing_threads == 1) {
+                this->commitTaskExecution(parseTaskExecution(task_exec, this->show_warnings, this->ignore_avg_cpu,
+                                                             this->enforce_num_cores, this->min_cores_per_task,
+                                                             this->max_cores_per_task));
+                return;
+            }
+            this->pending_task_execs.push_back(std::move(task_exec));
+            if (this->pending_task_execs.size() >= this->num_parsing_threads * PARSING_BATCH_SIZE_PER_THREAD) {
+                this->flushPendingTasks();
+            }
         }
 
-        // Gather machine information if any
-        std::map<std::string, std::pair<unsigned long, double>> machines;
-        if (workflow_spec.at("execution").contains("machines")) {
-            auto machine_specs = workflow_spec.at("execution").at("machines");
-            for (auto const& machine_spec : machine_specs) {
-                std::string name = machine_spec.at("nodeName");
-                nlohmann::json core_spec = machine_spec.at("cpu");
-                unsigned long num_cores;
-                try {
-                    num_cores = core_spec.at("coreCount");
-                }
-                catch (nlohmann::detail::out_of_range&) {
-                    num_cores = 1;
-                } catch (nlohmann::detail::type_error& e) {
-                    throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid coreCount value: " + std::string(
-                            e.what()));
+        /**
+         * @brief Finalize the workflow: check that all required pieces were found, resolve task files,
+         *        apply task executions, and add all dependencies at once
+         * @param num_bytes: the size of the JSON document (only used to report throughput)
+         * @return the workflow
+         */
+        std::shared_ptr<Workflow> finalize(unsigned long num_bytes) {
+            this->flushPendingTasks();
+
+            if (not this->found_schema_version) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'schema_version' key");
+            }
+            if (not this->found_workflow) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'workflow' key");
+            }
+            // Require the workflow/execution key
+            if (not this->found_execution) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): The WfInstance doesn't contain a 'workflow/execution' key. "
+                        "Although this key isn't required in the WfInstances format, WRENCH requires it to determine task "
+                        "flop rates based on measured task execution times.");
+            }
+            if (not this->found_specification) {
+                throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'workflow/specification' key");
+            }
+
+            // Add input/output files to the tasks, now that all files have been created
+            for (auto const &task_file: this->pending_task_files) {
+                auto file = Simulation::getFileByID(task_file.file_id);
+                if (task_file.input) {
+                    task_file.task->addInputFile(file);
+                } else {
+                    task_file.task->addOutputFile(file);
                 }
-                double mhz;
+            }
+            this->pending_task_files.clear();
+
+            // Fill in the task specifications based on the execution
+            for (auto const &execution: this->task_executions) {
+                this->applyTaskExecution(execution);
+            }
+            this->task_executions.clear();
+
+            // Deal with task dependencies
+            for (auto const &dependency: this->pending_dependencies) {
                 try {
-                    mhz = core_spec.at("speedInMHz");
+                    auto parent_task = this->workflow->getTaskByID(dependency.first);
+                    auto child_task = this->workflow->getTaskByID(dependency.second);
+                    this->workflow->addControlDependency(parent_task, child_task, this->redundant_dependencies);
                 }
-                catch (nlohmann::detail::out_of_range&) {
-                    if (show_warnings) std::cerr << "[WARNING]: Machine " + name + " does not define a speed\n";
-                    mhz = -1.0; // unknown
-                } catch (nlohmann::detail::type_error& e) {
-                    throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid speedInMhz value: " + std::string(
-                            e.what()));
+                catch (std::invalid_argument&) {
+                    // do nothing
                 }
-                machines[name] = std::make_pair(num_cores, mhz);
             }
+            this->pending_dependencies.clear();
+
+            // Check for cycles and add all dependencies at once
+            this->workflow->commitBulkDependencyInsertion(this->ignore_cycle_creating_dependencies);
+
+            // Update all top/bottom levels computations again
+            this->workflow->enableTopBottomLevelDynamicUpdates(true);
+            this->workflow->updateAllTopBottomLevels();
+
+            // Report load throughput
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - this->start_time).count();
+            WRENCH_INFO("Loaded %lu tasks and %lu files (%.2lf MB of JSON) in %.3lf seconds (%.2lf MB/sec, %.0lf tasks/sec)",
+                        this->workflow->getNumberOfTasks(), this->num_files,
+                        (double) num_bytes / (1000.0 * 1000.0), elapsed,
+                        (elapsed > 0 ? (double) num_bytes / (1000.0 * 1000.0 * elapsed) : 0.0),
+                        (elapsed > 0 ? (double) this->workflow->getNumberOfTasks() / elapsed : 0.0));
+
+            return this->workflow;
         }
 
-        // Process the files, if any
-        if (workflow_spec.at("specification").contains("files")) {
-            auto file_specs = workflow_spec.at("specification").at("files");
-            for (auto const& file_spec : file_specs) {
-                std::string file_name = file_spec.at("id");
-                std::shared_ptr<DataFile> data_file;
-                try {
-                    Simulation::getFileByID(file_name);
-                }
-                catch (const std::invalid_argument&) {
-                    // making a new file
-                    sg_size_t file_size = file_spec.at("sizeInBytes");
-                    Simulation::addFile(file_name, file_size);
-                }
+    private:
+        /** @brief The number of task specifications/executions parsed by each thread in a batch */
+        static constexpr unsigned long PARSING_BATCH_SIZE_PER_THREAD = 1024;
+
+        /**
+         * @brief The information from a task specification that is needed to create a task
+         */
+        struct TaskSpecification {
+            std::string task_id;
+            std::vector<std::string> input_files;
+            std::vector<std::string> output_files;
+            std::vector<std::string> parents;
+            std::vector<std::string> children;
+        };
+
+        /**
+         * @brief The information from a task execution that is needed to set up a task
+         */
+        struct TaskExecution {
+            std::string task_id;
+            double runtime_in_seconds = 0.0;// Runtime, already scaled by avgCPU
+            unsigned long min_num_cores = 1;
+            unsigned long max_num_cores = 1;
+            bool has_machines = false;
+            std::vector<std::string> machines;
+            double ram_in_bytes = 0.0;
+            bool has_priority = false;
+            long priority = 0;
+            bool has_read_bytes = false;
+            unsigned long read_bytes = 0;
+            bool has_written_bytes = false;
+            unsigned long written_bytes = 0;
+            std::vector<std::string> warnings;// Warnings, shown when the execution is committed
+        };
+
+        /**
+         * @brief Parse a task specification (does not touch the workflow, and can thus be called concurrently)
+         * @param task_spec: the JSON task specification
+         * @return the task specification
+         */
+        static TaskSpecification parseTaskSpecification(const nlohmann::json &task_spec) {
+            TaskSpecification specification;
+            task_spec.at("name");// Not used, but required
+            specification.task_id = task_spec.at("id").get<std::string>();
+            if (task_spec.contains("inputFiles")) {
+                specification.input_files = task_spec.at("inputFiles").get<std::vector<std::string>>();
+            }
+            if (task_spec.contains("outputFiles")) {
+                specification.output_files = task_spec.at("outputFiles").get<std::vector<std::string>>();
             }
+            specification.parents = task_spec.at("parents").get<std::vector<std::string>>();
+            specification.children = task_spec.at("children").get<std::vector<std::string>>();
+            return specification;
         }
 
-        // Create the tasks with input/output files
-        auto task_specs = workflow_spec.at("specification").at("tasks");
-        for (const auto& task_spec : task_specs) {
-            auto task_name = task_spec.at("name");
-            auto task_id = task_spec.at("id");
+        /**
+         * @brief Commit a parsed task specification (the task is created right away)
+         * @param specification: the task specification
+         */
+        void commitTaskSpecification(TaskSpecification &&specification) {
             // Create a task with all kinds of default fields for now
-            //            std::cerr << "CREATED TASK: " << task_id << "\n";
-            auto task = workflow->addTask(task_id, 0.0, 1, 1, 0.0);
+            auto task = this->workflow->addTask(specification.task_id, 0.0, 1, 1, 0.0);
 
-            if (task_spec.contains("inputFiles")) {
-                for (auto const& f : task_spec.at("inputFiles")) {
-                    auto file = Simulation::getFileByID(f);
-                    task->addInputFile(file);
-                    //                    std::cerr << "  ADDED INPUT FILE: " << file->getID() << "\n";
+            for (auto &f: specification.input_files) {
+                this->pending_task_files.push_back({task, std::move(f), true});
+            }
+            for (auto &f: specification.output_files) {
+                this->pending_task_files.push_back({task, std::move(f), false});
+            }
+            for (auto &parent: specification.parents) {
+                this->pending_dependencies.emplace_back(std::move(parent), task->getID());
+            }
+            for (auto &child: specification.children) {
+                this->pending_dependencies.emplace_back(task->getID(), std::move(child));
+            }
+        }
+
+        /**
+         * @brief Commit a parsed task execution (shows its warnings, if any)
+         * @param execution: the task execution
+         */
+        void commitTaskExecution(TaskExecution &&execution) {
+            for (auto const &warning: execution.warnings) {
+                std::cerr << warning;
+            }
+            execution.warnings.clear();
+            this->task_executions.push_back(std::move(execution));
+        }
+
+        /**
+         * @brief Parse elements with multiple threads. Exceptions are deterministic: if parsing fails
+         *        for several elements, the exception for the first one (in document order) is re-thrown.
+         * @param elements: the JSON elements
+         * @param parse: the parsing function
+         * @return the parsed elements, in order
+         */
+        template<typename Result, typename Parse>
+        std::vector<Result> parseInParallel(const std::vector<nlohmann::json> &elements, const Parse &parse) const {
+            static constexpr size_t CHUNK_SIZE = 64;
+            std::vector<Result> results(elements.size());
+            std::vector<std::exception_ptr> errors(elements.size());
+            std::atomic<size_t> next_chunk(0);
+
+            auto worker = [&]() {
+                size_t begin;
+                while ((begin = next_chunk.fetch_add(CHUNK_SIZE)) < elements.size()) {
+                    size_t end = std::min(begin + CHUNK_SIZE, elements.size());
+                    for (size_t i = begin; i < end; i++) {
+                        try {
+                            results[i] = parse(elements[i]);
+                        } catch (...) {
+                            errors[i] = std::current_exception();
+                        }
+                    }
                 }
+            };
+
+            unsigned long num_threads = std::min<unsigned long>(this->num_parsing_threads,
+                                                                (elements.size() + CHUNK_SIZE - 1) / CHUNK_SIZE);
+            std::vector<std::thread> threads;
+            for (unsigned long i = 1; i < num_threads; i++) {
+                threads.emplace_back(worker);
             }
-            if (task_spec.contains("outputFiles")) {
-                for (auto const& f : task_spec.at("outputFiles")) {
-                    auto file = Simulation::getFileByID(f);
-                    task->addOutputFile(file);
-                    //                    std::cerr << "  ADDED OUTPUT FILE: " << file->getID() << "\n";
+            worker();
+            for (auto &thread: threads) {
+                thread.join();
+            }
+
+            for (auto const &error: errors) {
+                if (error) {
+                    std::rethrow_exception(error);
                 }
             }
+            return results;
         }
 
-        // Fill in the task specifications based on the execution
-        auto task_execs = workflow_spec.at("execution").at("tasks");
-        for (const auto& task_exec : task_execs) {
-            auto task = workflow->getTaskByID(task_exec.at("id"));
+        /**
+         * @brief Parse pending task specifications and executions in parallel, and commit them in order
+         */
+        void flushPendingTasks() {
+            if (not this->pending_task_specs.empty()) {
+                auto specifications = this->parseInParallel<TaskSpecification>(this->pending_task_specs, &parseTaskSpecification);
+                this->pending_task_specs.clear();
+                for (auto &specification: specifications) {
+                    this->commitTaskSpecification(std::move(specification));
+                }
+            }
+            if (not this->pending_task_execs.empty()) {
+                auto executions = this->parseInParallel<TaskExecution>(
+                        this->pending_task_execs, [this](const nlohmann::json &task_exec) {
+                            return parseTaskExecution(task_exec, this->show_warnings, this->ignore_avg_cpu,
+                                                      this->enforce_num_cores, this->min_cores_per_task,
+                                                      this->max_cores_per_task);
+                        });
+                this->pending_task_execs.clear();
+                for (auto &execution: executions) {
+                    this->commitTaskExecution(std::move(execution));
+                }
+            }
+        }
+
+        /**
+         * @brief Parse a task execution (does not touch the workflow, and can thus be called concurrently)
+         * @param task_exec: the JSON task execution
+         * @param show_warnings: whether to record warnings
+         * @param ignore_avg_cpu: whether to ignore avgCPU values
+         * @param enforce_num_cores: whether to enforce the default numbers of cores
+         * @param min_cores_per_task: default min number of cores per task
+         * @param max_cores_per_task: default max number of cores per task
+         * @return the task execution
+         */
+        static TaskExecution parseTaskExecution(const nlohmann::json &task_exec,
+                                                bool show_warnings,
+                                                bool ignore_avg_cpu,
+                                                bool enforce_num_cores,
+                                                unsigned long min_cores_per_task,
+                                                unsigned long max_cores_per_task) {
+            TaskExecution execution;
+            execution.task_id = task_exec.at("id").get<std::string>();
 
             // Deal with the runtime
             double avg_cpu = -1.0;
@@ -226,9 +499,9 @@ namespace wrench {
                         e.what()));
             }
             if (num_cores == 0) {
-                if (show_warnings) std::cerr << "[WARNING]: Task " << task->getID() <<
+                if (show_warnings) execution.warnings.push_back("[WARNING]: Task " + execution.task_id +
                     " specifies an invalid number of cores (" + std::to_string(num_cores) +
-                    "): Assuming 1 core instead.\n";
+                    "): Assuming 1 core instead.\n");
                 num_cores = 1;
             }
 
@@ -245,15 +518,17 @@ namespace wrench {
             if (not ignore_avg_cpu) {
                 if (avg_cpu < 0) {
                     if (show_warnings)
-                        std::cerr << "[WARNING]: Task " << task->getID() <<
+                        execution.warnings.push_back("[WARNING]: Task " + execution.task_id +
                             " does not specify an avgCPU: "
-                            "Assuming avgCPU at 100%.\n";
+                            "Assuming avgCPU at 100%.\n");
                     avg_cpu = 100.0;
                 } else if (avg_cpu > 100.0 * num_cores) {
                     if (show_warnings) {
-                        std::cerr << "[WARNING]: Task " << task->getID() << " specifies " << static_cast<unsigned long>(
+                        std::ostringstream warning;
+                        warning << "[WARNING]: Task " << execution.task_id << " specifies " << static_cast<unsigned long>(
                                 num_cores) << " cores and avgCPU " << avg_cpu << "%, "
                             << "which is impossible: Assuming avgCPU " << 100.0 * num_cores << " instead.\n";
+                        execution.warnings.push_back(warning.str());
                     }
                     avg_cpu = 100.0 * num_cores;
                 }
@@ -261,58 +536,28 @@ namespace wrench {
                 avg_cpu = 100.0 * num_cores;
             }
 
-            runtimeInSeconds = runtimeInSeconds * avg_cpu / (100.0 * num_cores);
+            execution.runtime_in_seconds = runtimeInSeconds * avg_cpu / (100.0 * num_cores);
 
             // Deal with the number of cores
-            unsigned long min_num_cores, max_num_cores;
             // Set the default values
-            min_num_cores = min_cores_per_task;
-            max_num_cores = max_cores_per_task;
+            execution.min_num_cores = min_cores_per_task;
+            execution.max_num_cores = max_cores_per_task;
             // Overwrite the default is we don't enforce the default values AND the JSON specifies core numbers
             if ((not enforce_num_cores) and task_exec.contains("coreCount")) {
-                min_num_cores = num_cores;
-                max_num_cores = num_cores;
+                execution.min_num_cores = num_cores;
+                execution.max_num_cores = num_cores;
             }
 
-            // Deal with the flop amount
-            double flop_amount;
-            std::string execution_machine;
-            if (task_exec.contains("machines") and !machines.empty()) {
-                std::vector<std::string> task_machines = task_exec.at("machines");
-                if (task_machines.size() > 1) {
-                    throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJSON(): Task " + task->getID() +
-                        " was executed on multiple machines, which WRENCH currently does not support");
-                }
-                execution_machine = task_machines.at(0);
-            }
-            if (ignore_machine_specs or execution_machine.empty()) {
-                flop_amount = runtimeInSeconds * flop_rate;
-            }
-            else {
-                if (machines.find(execution_machine) == machines.end()) {
-                    throw std::invalid_argument(
-                        "WfCommonsWorkflowParser::createWorkflowFromJSON(): Task " + task->getID() +
-                        " is said to have been executed on machine " + execution_machine +
-                        " but no description for that machine is found on the JSON file");
-                }
-                if (machines[execution_machine].second >= 0) {
-                    double core_ghz = (machines[execution_machine].second) / 1000.0;
-                    double total_compute_power_used = core_ghz * static_cast<double>(min_num_cores);
-                    double actual_flop_rate = total_compute_power_used * 1000.0 * 1000.0 * 1000.0;
-                    flop_amount = runtimeInSeconds * actual_flop_rate;
-                }
-                else {
-                    flop_amount = static_cast<double>(min_num_cores) * runtimeInSeconds * flop_rate;
-                    // Assume a min-core execution
-                }
+            // Deal with the machines, if any (the flop amount is computed once all machines are known)
+            if (task_exec.contains("machines")) {
+                execution.has_machines = true;
+                execution.machines = task_exec.at("machines").get<std::vector<std::string>>();
             }
 
             // Deal with RAM, if any
-            double ram_in_bytes = 0.0;
             if (task_exec.contains("memoryInBytes")) {
                 try {
-                    ram_in_bytes = task_exec.at("memoryInBytes");
+                    execution.ram_in_bytes = task_exec.at("memoryInBytes");
                 }
                 catch (nlohmann::detail::type_error& e) {
                     throw std::invalid_argument(
@@ -321,97 +566,542 @@ namespace wrench {
                 }
             }
 
-            // Update the actual task data structure
-            task->setFlops(flop_amount);
-            task->setMinNumCores(min_num_cores);
-            task->setMaxNumCores(max_num_cores);
-            task->setMemoryRequirement(static_cast<sg_size_t>(ram_in_bytes));
-
             // Deal with the priority, if any
             if (task_exec.contains("priority")) {
-                long priority;
                 try {
-                    priority = task_exec.at("priority");
+                    execution.priority = task_exec.at("priority");
+                    execution.has_priority = true;
                 }
                 catch (nlohmann::detail::type_error& e) {
                     throw std::invalid_argument(
                         "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid priority value: " + std::string(
                             e.what()));
                 }
-                task->setPriority(priority);
             }
 
             // Deal with written/read bytes, if any
             if (task_exec.contains("readBytes")) {
-                unsigned long readBytes;
                 try {
-                    readBytes = task_exec.at("readBytes");
+                    execution.read_bytes = task_exec.at("readBytes");
+                    execution.has_read_bytes = true;
                 }
                 catch (nlohmann::detail::type_error& e) {
                     throw std::invalid_argument(
                         "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid readBytes value: " + std::string(
                             e.what()));
                 }
-                task->setBytesRead(readBytes);
             }
             if (task_exec.contains("writtenBytes")) {
-                unsigned long readBytes;
                 try {
-                    readBytes = task_exec.at("writtenBytes");
+                    execution.written_bytes = task_exec.at("writtenBytes");
+                    execution.has_written_bytes = true;
                 }
                 catch (nlohmann::detail::type_error& e) {
                     throw std::invalid_argument(
                         "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid writtenBytes value: " + std::string(
                             e.what()));
                 }
-                task->setBytesWritten(readBytes);
             }
+
+            return execution;
         }
 
-        // Deal with task dependencies
-        for (auto const& task_spec : task_specs) {
-            auto task = workflow->getTaskByID(task_spec.at("id"));
+        /**
+         * @brief A task file that has yet to be added to its task
+         */
+        struct TaskFile {
+            std::shared_ptr<WorkflowTask> task;
+            std::string file_id;
+            bool input;
+        };
 
-            for (auto const& parent : task_spec.at("parents")) {
-                try {
-                    auto parent_task = workflow->getTaskByID(parent);
-                    workflow->addControlDependency(parent_task, task, redundant_dependencies);
+        /**
+         * @brief Apply a task execution to its task
+         * @param execution: the task execution
+         */
+        void applyTaskExecution(const TaskExecution &execution) {
+            auto task = this->workflow->getTaskByID(execution.task_id);
+
+            // Deal with the flop amount
+            double flop_amount;
+            std::string execution_machine;
+            if (execution.has_machines and !machines.empty()) {
+                if (execution.machines.size() > 1) {
+                    throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJSON(): Task " + task->getID() +
+                        " was executed on multiple machines, which WRENCH currently does not support");
                 }
-                catch (std::invalid_argument&) {
-                    // do nothing
-                } catch (std::runtime_error&) {
-                    if (ignore_cycle_creating_dependencies) {
-                        // nothing
-                    }
-                    else {
-                        throw;
-                    }
+                execution_machine = execution.machines.at(0);
+            }
+            if (ignore_machine_specs or execution_machine.empty()) {
+                flop_amount = execution.runtime_in_seconds * flop_rate;
+            }
+            else {
+                if (machines.find(execution_machine) == machines.end()) {
+                    throw std::invalid_argument(
+                        "WfCommonsWorkflowParser::createWorkflowFromJSON(): Task " + task->getID() +
+                        " is said to have been executed on machine " + execution_machine +
+                        " but no description for that machine is found on the JSON file");
+                }
+                if (machines[execution_machine].second >= 0) {
+                    double core_ghz = (machines[execution_machine].second) / 1000.0;
+                    double total_compute_power_used = core_ghz * static_cast<double>(execution.min_num_cores);
+                    double actual_flop_rate = total_compute_power_used * 1000.0 * 1000.0 * 1000.0;
+                    flop_amount = execution.runtime_in_seconds * actual_flop_rate;
+                }
+                else {
+                    flop_amount = static_cast<double>(execution.min_num_cores) * execution.runtime_in_seconds * flop_rate;
+                    // Assume a min-core execution
                 }
             }
 
-            for (auto const& child : task_spec.at("children")) {
-                try {
-                    auto child_task = workflow->getTaskByID(child);
-                    workflow->addControlDependency(task, child_task, redundant_dependencies);
+            // Update the actual task data structure
+            task->setFlops(flop_amount);
+            task->setMinNumCores(execution.min_num_cores);
+            task->setMaxNumCores(execution.max_num_cores);
+            task->setMemoryRequirement(static_cast<sg_size_t>(execution.ram_in_bytes));
+            if (execution.has_priority) {
+                task->setPriority(execution.priority);
+            }
+            if (execution.has_read_bytes) {
+                task->setBytesRead(execution.read_bytes);
+            }
+            if (execution.has_written_bytes) {
+                task->setBytesWritten(execution.written_bytes);
+            }
+        }
+
+        bool ignore_machine_specs;
+        bool redundant_dependencies;
+        bool ignore_cycle_creating_dependencies;
+        unsigned long min_cores_per_task;
+        unsigned long max_cores_per_task;
+        bool enforce_num_cores;
+        bool ignore_avg_cpu;
+        bool show_warnings;
+        unsigned long num_parsing_threads;
+        double flop_rate;
+        std::chrono::steady_clock::time_point start_time;
+
+        std::shared_ptr<Workflow> workflow;
+        bool found_schema_version = false;
+        bool found_workflow = false;
+        bool found_execution = false;
+        bool found_specification = false;
+        unsigned long num_files = 0;
+        std::vector<std::shared_ptr<DataFile>> added_files;
+
+        std::map<std::string, std::pair<unsigned long, double>> machines;
+        std::vector<nlohmann::json> pending_task_specs;// Task specifications yet to be parsed (multi-threaded parsing only)
+        std::vector<nlohmann::json> pending_task_execs;// Task executions yet to be parsed (multi-threaded parsing only)
+        std::vector<TaskFile> pending_task_files;
+        std::vector<TaskExecution> task_executions;
+        std::vector<std::pair<std::string, std::string>> pending_dependencies;
+    };
+
+    /**
+     * @brief A SAX handler that streams a WfFormat JSON document into a WfCommonsWorkflowBuilder. Only
+     *        one element (a machine, a file, a task specification, or a task execution) is held in
+     *        memory as a JSON object at a time (or one batch of task elements, if tasks are parsed by
+     *        multiple threads), so that the full document never needs to be loaded.
+     */
+    class WfCommonsJSONStreamHandler : public nlohmann::json_sax<nlohmann::json> {
+
+    public:
+        /**
+         * @brief Constructor
+         * @param builder: the workflow builder
+         */
+        explicit WfCommonsJSONStreamHandler(WfCommonsWorkflowBuilder &builder) : builder(builder) {}
+
+        /** @brief SAX event */
+        bool null() override { return this->handleValue(nullptr); }
+        /** @brief SAX event */
+        bool boolean(bool val) override { return this->handleValue(val); }
+        /** @brief SAX event */
+        bool number_integer(number_integer_t val) override { return this->handleValue(val); }
+        /** @brief SAX event */
+        bool number_unsigned(number_unsigned_t val) override { return this->handleValue(val); }
+        /** @brief SAX event */
+        bool number_float(number_float_t val, const string_t &) override { return this->handleValue(val); }
+        /** @brief SAX event */
+        bool string(string_t &val) override { return this->handleValue(val); }
+        /** @brief SAX event */
+        bool binary(binary_t &val) override { return this->handleValue(nlohmann::json::binary(val)); }
+
+        /** @brief SAX event */
+        bool start_object(std::size_t) override {
+            return this->startContainer(nlohmann::json::object());
+        }
+
+        /** @brief SAX event */
+        bool end_object() override {
+            return this->endContainer();
+        }
+
+        /** @brief SAX event */
+        bool start_array(std::size_t) override {
+            return this->startContainer(nlohmann::json::array());
+        }
+
+        /** @brief SAX event */
+        bool end_array() override {
+            return this->endContainer();
+        }
+
+        /** @brief SAX event */
+        bool key(string_t &val) override {
+            if (not this->element_stack.empty()) {
+                this->element_key = val;
+            } else {
+                this->contexts.back().key = val;
+            }
+            return true;
+        }
+
+        /** @brief SAX event */
+        bool parse_error(std::size_t position, const std::string &last_token, const nlohmann::detail::exception &ex) override {
+            // Rethrow the exception as is, just like nlohmann::json::parse() does
+            if (auto parse_ex = dynamic_cast<const nlohmann::json::parse_error *>(&ex)) {
+                throw *parse_ex;
+            }
+            if (auto range_ex = dynamic_cast<const nlohmann::json::out_of_range *>(&ex)) {
+                throw *range_ex;
+            }
+            return false;
+        }
+
+    private:
+        /**
+         * @brief Where we are in the document
+         */
+        enum class Location {
+            ROOT,
+            WORKFLOW,
+            SPECIFICATION,
+            EXECUTION,
+            SPECIFICATION_TASKS,
+            SPECIFICATION_FILES,
+            EXECUTION_TASKS,
+            EXECUTION_MACHINES,
+            OTHER
+        };
+
+        /**
+         * @brief An open container outside of an element
+         */
+        struct Context {
+            Location location;
+            std::string key;// Current key (if the container is an object)
+        };
+
+        /**
+         * @brief Determine the location of a container that's being opened
+         * @return a location
+         */
+        Location getNewContainerLocation() const {
+            if (this->contexts.empty()) {
+                return Location::ROOT;
+            }
+            auto const &parent = this->contexts.back();
+            switch (parent.location) {
+                case Location::ROOT:
+                    return (parent.key == "workflow") ? Location::WORKFLOW : Location::OTHER;
+                case Location::WORKFLOW:
+                    if (parent.key == "specification") return Location::SPECIFICATION;
+                    if (parent.key == "execution") return Location::EXECUTION;
+                    return Location::OTHER;
+                case Location::SPECIFICATION:
+                    if (parent.key == "tasks") return Location::SPECIFICATION_TASKS;
+                    if (parent.key == "files") return Location::SPECIFICATION_FILES;
+                    return Location::OTHER;
+                case Location::EXECUTION:
+                    if (parent.key == "tasks") return Location::EXECUTION_TASKS;
+                    if (parent.key == "machines") return Location::EXECUTION_MACHINES;
+                    return Location::OTHER;
+                default:
+                    return Location::OTHER;
+            }
+        }
+
+        /**
+         * @brief Determine whether the current container is an array of elements of interest
+         * @return true or false
+         */
+        bool inElementArray() const {
+            if (this->contexts.empty()) {
+                return false;
+            }
+            auto location = this->contexts.back().location;
+            return (location == Location::SPECIFICATION_TASKS) or (location == Location::SPECIFICATION_FILES) or
+                   (location == Location::EXECUTION_TASKS) or (location == Location::EXECUTION_MACHINES);
+        }
+
+        /**
+         * @brief Pass a complete element to the builder
+         * @param location: the location of the array that contains the element
+         * @param element: the element
+         */
+        void dispatchElement(Location location, nlohmann::json &&element) {
+            switch (location) {
+                case Location::SPECIFICATION_TASKS:
+                    this->builder.addTaskSpecification(std::move(element));
+                    break;
+                case Location::SPECIFICATION_FILES:
+                    this->builder.addFile(element);
+                    break;
+                case Location::EXECUTION_TASKS:
+                    this->builder.addTaskExecution(std::move(element));
+                    break;
+                case Location::EXECUTION_MACHINES:
+                    this->builder.addMachine(element);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        /**
+         * @brief Handle a scalar value
+         * @param value: the value
+         * @return true
+         */
+        bool handleValue(nlohmann::json &&value) {
+            if (not this->element_stack.empty()) {
+                auto container = this->element_stack.back();
+                if (container->is_array()) {
+                    container->push_back(std::move(value));
+                } else {
+                    (*container)[this->element_key] = std::move(value);
                 }
-                catch (std::invalid_argument&) {
-                    // do nothing
-                } catch (std::runtime_error&) {
-                    if (ignore_cycle_creating_dependencies) {
-                        // nothing
-                    }
-                    else {
-                        throw;
-                    }
+            } else if (this->inElementArray()) {
+                this->dispatchElement(this->contexts.back().location, std::move(value));
+            } else if ((not this->contexts.empty()) and (this->contexts.back().location == Location::ROOT) and
+                       (this->contexts.back().key == "schemaVersion")) {
+                this->builder.setSchemaVersion(value);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Handle the opening of a container
+         * @param container: an empty container
+         * @return true
+         */
+        bool startContainer(nlohmann::json &&container) {
+            // Within an element: add the container to the element
+            if (not this->element_stack.empty()) {
+                auto parent = this->element_stack.back();
+                nlohmann::json *inserted;
+                if (parent->is_array()) {
+                    parent->push_back(std::move(container));
+                    inserted = &parent->back();
+                } else {
+                    inserted = &((*parent)[this->element_key] = std::move(container));
                 }
+                this->element_stack.push_back(inserted);
+                return true;
+            }
+
+            // Beginning of an element
+            if (this->inElementArray()) {
+                this->element = std::move(container);
+                this->element_location = this->contexts.back().location;
+                this->element_stack.push_back(&this->element);
+                return true;
+            }
+
+            // Some other container
+            auto location = this->getNewContainerLocation();
+            if (location == Location::WORKFLOW) {
+                this->builder.setFoundWorkflow();
+            } else if (location == Location::EXECUTION) {
+                this->builder.setFoundExecution();
+            } else if (location == Location::SPECIFICATION) {
+                this->builder.setFoundSpecification();
+            }
+            this->contexts.push_back({location, ""});
+            return true;
+        }
+
+        /**
+         * @brief Handle the closing of a container
+         * @return true
+         */
+        bool endContainer() {
+            if (not this->element_stack.empty()) {
+                this->element_stack.pop_back();
+                if (this->element_stack.empty()) {
+                    this->dispatchElement(this->element_location, std::move(this->element));
+                    this->element = nullptr;
+                }
+            } else {
+                this->contexts.pop_back();
+            }
+            return true;
+        }
+
+        WfCommonsWorkflowBuilder &builder;
+
+        std::vector<Context> contexts;
+
+        nlohmann::json element;
+        Location element_location = Location::OTHER;
+        std::vector<nlohmann::json *> element_stack;
+        std::string element_key;
+    };
+
+    /**
+     * Documentation in .h file
+     */
+    std::shared_ptr<Workflow> WfCommonsWorkflowParser::createWorkflowFromJSON(const std::string& filename,
+                                                                              const std::string& reference_flop_rate,
+                                                                              bool ignore_machine_specs,
+                                                                              bool redundant_dependencies,
+                                                                              bool ignore_cycle_creating_dependencies,
+                                                                              unsigned long min_cores_per_task,
+                                                                              unsigned long max_cores_per_task,
+                                                                              bool enforce_num_cores,
+                                                                              bool ignore_avg_cpu,
+                                                                              bool show_warnings,
+                                                                              unsigned long num_parsing_threads) {
+        std::ifstream file;
+        unsigned long num_bytes;
+        // handle exceptions when opening the json file
+        file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        try {
+            file.open(filename, std::ios::binary);
+            file.seekg(0, std::ios::end);
+            num_bytes = file.tellg();
+            file.seekg(0, std::ios::beg);
+        }
+        catch (const std::ifstream::failure& e) {
+            throw std::invalid_argument(
+                "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid JSON file (" + std::string(e.what()) + ")");
+        }
+        // The SAX parser reads until end-of-file, which should not be treated as a failure
+        file.exceptions(std::ifstream::badbit);
+
+        WfCommonsWorkflowBuilder builder(reference_flop_rate,
+                                         ignore_machine_specs,
+                                         redundant_dependencies,
+                                         ignore_cycle_creating_dependencies,
+                                         min_cores_per_task,
+                                         max_cores_per_task,
+                                         enforce_num_cores,
+                                         ignore_avg_cpu,
+                                         show_warnings,
+                                         num_parsing_threads);
+
+        // Stream the document through the builder, one element at a time
+        // Files are added to the simulation as the document is streamed, and must be removed if it turns out to be invalid
+        WfCommonsJSONStreamHandler handler(builder);
+        try {
+            if (not nlohmann::json::sax_parse(file, &handler)) {
+                throw std::invalid_argument(
+                    "WfCommonsWorkflowParser::createWorkflowFromJson(): Invalid JSON file '" + filename + "'");
+            }
+            return builder.finalize(num_bytes);
+        } catch (...) {
+            builder.removeAddedFiles();
+            throw;
+        }
+    }
+
+    /**
+    * Documentation in .h file
+    */
+    std::shared_ptr<Workflow> WfCommonsWorkflowParser::createWorkflowFromJSONString(const std::string& json_string,
+        const std::string& reference_flop_rate,
+        bool ignore_machine_specs,
+        bool redundant_dependencies,
+        bool ignore_cycle_creating_dependencies,
+        unsigned long min_cores_per_task,
+        unsigned long max_cores_per_task,
+        bool enforce_num_cores,
+        bool ignore_avg_cpu,
+        bool show_warnings,
+        unsigned long num_parsing_threads) {
+
+        WfCommonsWorkflowBuilder builder(reference_flop_rate,
+                                         ignore_machine_specs,
+                                         redundant_dependencies,
+                                         ignore_cycle_creating_dependencies,
+                                         min_cores_per_task,
+                                         max_cores_per_task,
+                                         enforce_num_cores,
+                                         ignore_avg_cpu,
+                                         show_warnings,
+                                         num_parsing_threads);
+
+        nlohmann::json j = nlohmann::json::parse(json_string);
+
+        // Check schema version
+        nlohmann::json schema_version;
+        try {
+            schema_version = j.at("schemaVersion");
+        } catch (std::out_of_range&) {
+            throw std::invalid_argument(
+                "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'schema_version' key");
+        }
+        builder.setSchemaVersion(schema_version);
+
+        nlohmann::json workflow_spec;
+        try {
+            workflow_spec = j.at("workflow");
+        }
+        catch (std::out_of_range&) {
+            throw std::invalid_argument(
+                "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'workflow' key");
+        }
+        builder.setFoundWorkflow();
+
+        // Require the workflow/execution key
+        if (not workflow_spec.contains("execution")) {
+            throw std::invalid_argument(
+                "WfCommonsWorkflowParser::createWorkflowFromJson(): The WfInstance doesn't contain a 'workflow/execution' key. "
+                "Although this key isn't required in the WfInstances format, WRENCH requires it to determine task "
+                "flop rates based on measured task execution times.");
+        }
+        builder.setFoundExecution();
+
+        if (not workflow_spec.contains("specification")) {
+            throw std::invalid_argument(
+                "WfCommonsWorkflowParser::createWorkflowFromJson(): Could not find a 'workflow/specification' key");
+        }
+        builder.setFoundSpecification();
+
+        // Gather machine information if any
+        if (workflow_spec.at("execution").contains("machines")) {
+            for (auto const& machine_spec : workflow_spec.at("execution").at("machines")) {
+                builder.addMachine(machine_spec);
             }
         }
 
-        // Update all top/bottom levels computations again
-        workflow->enableTopBottomLevelDynamicUpdates(true);
-        workflow->updateAllTopBottomLevels();
+        // Files are added to the simulation as they are processed, and must be removed if the workflow cannot be created
+        try {
+            // Process the files, if any
+            if (workflow_spec.at("specification").contains("files")) {
+                for (auto const& file_spec : workflow_spec.at("specification").at("files")) {
+                    builder.addFile(file_spec);
+                }
+            }
 
-        return workflow;
+            // Create the tasks
+            for (auto& task_spec : workflow_spec.at("specification").at("tasks")) {
+                builder.addTaskSpecification(std::move(task_spec));
+            }
+
+            // Fill in the task specifications based on the execution
+            for (auto& task_exec : workflow_spec.at("execution").at("tasks")) {
+                builder.addTaskExecution(std::move(task_exec));
+            }
+
+            return builder.finalize(json_string.size());
+        } catch (...) {
+            builder.removeAddedFiles();
+            throw;
+        }
     }
 
     /**
@@ -424,7 +1114,8 @@ namespace wrench {
 
         // Tasks
         json_specification["tasks"] = nlohmann::json::array();
-        for (const auto& task : workflow->getTasks()) {
+        for (const auto& t : workflow->getTaskMapView()) {
+            const auto& task = t.second;
             nlohmann::json json_task;
             json_task["name"] = task->getID();
             json_task["id"] = task->getID();
@@ -481,7 +1172,8 @@ namespace wrench {
 
         // Tasks
         json_execution["tasks"] = nlohmann::json::array();
-        for (const auto& task : workflow->getTasks()) {
+        for (const auto& t : workflow->getTaskMapView()) {
+            const auto& task = t.second;
             nlohmann::json json_task;
             json_task["id"] = task->getID();
             json_task["runtimeInSeconds"] = task->getEndDate() - task->getStartDate();
@@ -62,13 +62,9 @@ namespace wrench {
 
                 /* Create a map of file locations, stating for each file (could be none)
                  * where it should be read/written */
-                std::map<std::shared_ptr<DataFile>, std::shared_ptr<FileLocation>> file_locations;
-                for (auto const &f: ready_task->getInputFiles()) {
-                    file_locations[f] = FileLocation::LOCATION(storage_service, f);
-                }
-                for (auto const &f: ready_task->getOutputFiles()) {
-                    file_locations[f] = FileLocation::LOCATION(storage_service, f);
-                }
+                auto file_locations = FileLocation::LOCATIONS(storage_service, ready_task->getInputFiles());
+                auto output_file_locations = FileLocation::LOCATIONS(storage_service, ready_task->getOutputFiles());
+                file_locations.insert(output_file_locations.begin(), output_file_locations.end());
 
                 /* Create the job  */
                 auto standard_job = job_manager->createStandardJob(ready_task, file_locations);
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench/simulation/SimulationTraceFileSink.h>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+
+int main(int argc, char **argv) {
+
+    std::string part = "unified";
+    bool valid_args = (argc == 3) or (argc == 4);
+
+    if (valid_args and (argc == 4)) {
+        std::string option(argv[3]);
+        if (option == "--disk-operations") {
+            part = "disk_operations";
+        } else if (option == "--energy-consumption") {
+            part = "energy_consumption";
+        } else if (option == "--link-usage") {
+            part = "link_usage";
+        } else {
+            valid_args = false;
+        }
+    }
+
+    if (not valid_args) {
+        std::cerr << "Usage: " << argv[0] << " <path to trace file> <path to JSON file> "
+                                             "[--disk-operations | --energy-consumption | --link-usage]\n";
+        std::cerr << "  This program takes as input a trace file written during a simulation by a "
+                     "wrench::SimulationTraceFileSink (in any format), and writes the JSON output that "
+                     "wrench::SimulationOutput::dumpUnifiedJSON() would have written for disk operations, energy "
+                     "consumption and link usage had the timestamps been kept in memory. With an option, only the "
+                     "corresponding part is written, in the format of wrench::SimulationOutput::dumpDiskOperationsJSON(), "
+                     "dumpHostEnergyConsumptionJSON() or dumpLinkUsageJSON(). Hosts and links for which nothing was "
+                     "recorded, and host pstate/wattage descriptions (which come from the platform), are not included.\n";
+        exit(1);
+    }
+
+    nlohmann::json trace_json;
+    try {
+        trace_json = wrench::SimulationTraceFileSink::reconstructJSON(argv[1]);
+    } catch (std::exception &e) {
+        std::cerr << "Error reading trace file at " + std::string(argv[1]) + ": " + std::string(e.what()) + "\n";
+        exit(1);
+    }
+
+    nlohmann::json output_json;
+    if (part == "unified") {
+        output_json = trace_json;
+    } else if (part == "disk_operations") {
+        output_json = trace_json["disk_operations"];
+    } else {
+        output_json[part] = trace_json[part];
+    }
+
+    std::ofstream output(argv[2]);
+    output << std::setw(4) << output_json << std::endl;
+    output.close();
+    if (not output) {
+        std::cerr << "Error writing JSON file at " + std::string(argv[2]) + "\n";
+        exit(1);
+    }
+}